@@ -0,0 +1,112 @@
+#include "storm-benchmarks/Benchmark.h"
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/Stopwatch.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace benchmarks {
+
+namespace {
+std::map<std::string, BenchmarkFunction>& getMutableBenchmarks() {
+    // Constructed on first use as benchmarks are registered during static initialization.
+    static std::map<std::string, BenchmarkFunction> benchmarks;
+    return benchmarks;
+}
+
+uint64_t getMedian(std::vector<uint64_t> values) {
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+}  // namespace
+
+BenchmarkState::BenchmarkState(std::string const& name, BenchmarkParameters const& parameters) : name(name), parameters(parameters) {
+    // Intentionally left empty.
+}
+
+BenchmarkParameters const& BenchmarkState::getParameters() const {
+    return parameters;
+}
+
+void BenchmarkState::measure(std::function<void()> const& run) {
+    run();
+    for (uint64_t repetition = 0; repetition < parameters.repetitions; ++repetition) {
+        storm::utility::Stopwatch stopwatch(true);
+        run();
+        stopwatch.stop();
+        times.push_back(stopwatch.getTimeInNanoseconds());
+    }
+}
+
+void BenchmarkState::setCounter(std::string const& counterName, double value) {
+    counters[counterName] = value;
+}
+
+void BenchmarkState::skip(std::string const& reason) {
+    skipReason = reason;
+}
+
+bool BenchmarkState::isSkipped() const {
+    return !skipReason.empty();
+}
+
+std::vector<uint64_t> const& BenchmarkState::getTimes() const {
+    return times;
+}
+
+storm::json<double> BenchmarkState::toJson() const {
+    storm::json<double> result;
+    result["name"] = name;
+    result["scale"] = parameters.scale;
+    result["threads"] = parameters.numberOfThreads;
+    if (isSkipped()) {
+        result["skipped"] = skipReason;
+        return result;
+    }
+    result["repetitions"] = times.size();
+    result["times-ns"] = times;
+    if (!times.empty()) {
+        result["min-ns"] = *std::min_element(times.begin(), times.end());
+        result["median-ns"] = getMedian(times);
+        result["mean-ns"] = static_cast<double>(std::accumulate(times.begin(), times.end(), 0ull)) / times.size();
+    }
+    for (auto const& [counterName, value] : counters) {
+        result["counters"][counterName] = value;
+    }
+    return result;
+}
+
+std::string BenchmarkState::toString() const {
+    std::stringstream stream;
+    stream << name << ": ";
+    if (isSkipped()) {
+        stream << "skipped (" << skipReason << ")";
+    } else if (times.empty()) {
+        stream << "no measurements";
+    } else {
+        double const minimum = static_cast<double>(*std::min_element(times.begin(), times.end()));
+        stream << "median " << static_cast<double>(getMedian(times)) / 1e6 << "ms, min " << minimum / 1e6 << "ms";
+        for (auto const& [counterName, value] : counters) {
+            stream << ", " << counterName << "=" << value;
+        }
+    }
+    return stream.str();
+}
+
+bool registerBenchmark(std::string const& name, BenchmarkFunction const& function) {
+    bool inserted = getMutableBenchmarks().emplace(name, function).second;
+    STORM_LOG_THROW(inserted, storm::exceptions::InvalidArgumentException, "Benchmark '" << name << "' is registered twice.");
+    return inserted;
+}
+
+std::map<std::string, BenchmarkFunction> const& getBenchmarks() {
+    return getMutableBenchmarks();
+}
+
+}  // namespace benchmarks
+}  // namespace storm
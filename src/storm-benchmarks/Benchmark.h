@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "storm/adapters/JsonForward.h"
+
+namespace storm {
+namespace benchmarks {
+
+/*!
+ * The parameters that are passed to each benchmark.
+ */
+struct BenchmarkParameters {
+    // A factor that scales the size of the (synthetic) models.
+    uint64_t scale = 1;
+    // The number of threads that multi-threaded code shall use.
+    uint64_t numberOfThreads = 1;
+    // The number of measured repetitions (after one warm-up run).
+    uint64_t repetitions = 5;
+};
+
+/*!
+ * Collects the measurements of a single benchmark.
+ */
+class BenchmarkState {
+   public:
+    BenchmarkState(std::string const& name, BenchmarkParameters const& parameters);
+
+    BenchmarkParameters const& getParameters() const;
+
+    /*!
+     * Runs the given function once without measuring it and then measures the configured number of repetitions.
+     * The setup of the benchmark (e.g. building the input model) should happen before calling this method.
+     */
+    void measure(std::function<void()> const& run);
+
+    /*!
+     * Attaches a counter (e.g. the number of states or matrix entries) to the benchmark result.
+     * Counters are reported together with the measurements, which allows to compute throughputs.
+     */
+    void setCounter(std::string const& name, double value);
+
+    /*!
+     * Marks the benchmark as skipped (e.g. because required input is not available).
+     */
+    void skip(std::string const& reason);
+
+    bool isSkipped() const;
+
+    /*!
+     * Retrieves the measured times in nanoseconds.
+     */
+    std::vector<uint64_t> const& getTimes() const;
+
+    storm::json<double> toJson() const;
+
+    /*!
+     * Retrieves a single line that summarizes the result.
+     */
+    std::string toString() const;
+
+   private:
+    std::string name;
+    BenchmarkParameters parameters;
+    std::vector<uint64_t> times;
+    std::map<std::string, double> counters;
+    std::string skipReason;
+};
+
+typedef std::function<void(BenchmarkState&)> BenchmarkFunction;
+
+/*!
+ * Registers the given benchmark. Benchmark names are hierarchical, separated by '/' (e.g. "graph/scc/chain").
+ */
+bool registerBenchmark(std::string const& name, BenchmarkFunction const& function);
+
+/*!
+ * Retrieves all registered benchmarks (sorted by name).
+ */
+std::map<std::string, BenchmarkFunction> const& getBenchmarks();
+
+}  // namespace benchmarks
+}  // namespace storm
+
+#define STORM_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define STORM_BENCHMARK_CONCAT(a, b) STORM_BENCHMARK_CONCAT_IMPL(a, b)
+
+/*!
+ * Registers the given function (with signature void(BenchmarkState&)) as a benchmark with the given name.
+ */
+#define STORM_BENCHMARK(name, function) \
+    static bool const STORM_BENCHMARK_CONCAT(stormBenchmarkRegistered, __LINE__) = storm::benchmarks::registerBenchmark(name, function)
@@ -0,0 +1,79 @@
+#include "storm-benchmarks/Benchmark.h"
+#include "storm-benchmarks/ModelGenerators.h"
+
+#include <optional>
+
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/builder.h"
+#include "storm/builder/BuilderType.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/exceptions/BaseException.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/Qvbs.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/storage/prism/Program.h"
+
+namespace storm {
+namespace benchmarks {
+
+namespace {
+storm::builder::ExplicitModelBuilder<double>::Options getBuilderOptions(BenchmarkParameters const& parameters) {
+    storm::builder::ExplicitModelBuilder<double>::Options options;
+    options.numberOfThreads = parameters.numberOfThreads;
+    return options;
+}
+
+void setModelCounters(BenchmarkState& state, storm::models::sparse::Model<double> const& model) {
+    state.setCounter("states", model.getNumberOfStates());
+    state.setCounter("transitions", model.getNumberOfTransitions());
+}
+
+void benchmarkGridWorld(BenchmarkState& state) {
+    auto program = storm::parser::PrismParser::parseFromString(createGridWorldPrismProgram(8 * state.getParameters().scale + 4), "gridworld.prism");
+    std::shared_ptr<storm::models::sparse::Model<double>> model;
+    state.measure([&]() {
+        storm::builder::ExplicitModelBuilder<double> builder(program, storm::generator::NextStateGeneratorOptions(), getBuilderOptions(state.getParameters()));
+        model = builder.build();
+    });
+    setModelCounters(state, *model);
+}
+
+/*!
+ * Builds the first instance of the given model from the Quantitative Verification Benchmark Set. The benchmark is skipped if QVBS is not available,
+ * e.g., because neither STORM_LOAD_QVBS nor STORM_QVBS_ROOT was set when configuring the build and --qvbsroot was not given.
+ */
+void benchmarkQvbsModel(BenchmarkState& state, std::string const& modelName) {
+    std::optional<storm::jani::Model> janiModel;
+    try {
+        storm::storage::QvbsBenchmark benchmark(modelName);
+        auto janiInput = storm::api::parseJaniModel(benchmark.getJaniFile(), storm::api::getSupportedJaniFeatures(storm::builder::BuilderType::Explicit));
+        storm::storage::SymbolicModelDescription description(janiInput.first);
+        description = description.preprocess(benchmark.getConstantDefinition());
+        janiModel = description.asJaniModel();
+        storm::api::simplifyJaniModel(janiModel.value(), janiInput.second, storm::api::getSupportedJaniFeatures(storm::builder::BuilderType::Explicit));
+    } catch (storm::exceptions::BaseException const& exception) {
+        state.skip(std::string("QVBS model is not available: ") + exception.what());
+        return;
+    }
+
+    std::shared_ptr<storm::models::sparse::Model<double>> model;
+    state.measure([&]() {
+        storm::builder::ExplicitModelBuilder<double> builder(janiModel.value(), storm::generator::NextStateGeneratorOptions(),
+                                                             getBuilderOptions(state.getParameters()));
+        model = builder.build();
+    });
+    setModelCounters(state, *model);
+}
+}  // namespace
+
+STORM_BENCHMARK("builder/prism/gridworld", benchmarkGridWorld);
+STORM_BENCHMARK("builder/qvbs/brp", [](BenchmarkState& state) { benchmarkQvbsModel(state, "brp"); });
+STORM_BENCHMARK("builder/qvbs/consensus", [](BenchmarkState& state) { benchmarkQvbsModel(state, "consensus"); });
+STORM_BENCHMARK("builder/qvbs/csma", [](BenchmarkState& state) { benchmarkQvbsModel(state, "csma"); });
+STORM_BENCHMARK("builder/qvbs/zeroconf", [](BenchmarkState& state) { benchmarkQvbsModel(state, "zeroconf"); });
+
+}  // namespace benchmarks
+}  // namespace storm
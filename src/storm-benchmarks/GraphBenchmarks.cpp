@@ -0,0 +1,66 @@
+#include "storm-benchmarks/Benchmark.h"
+#include "storm-benchmarks/ModelGenerators.h"
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/graph.h"
+
+namespace storm {
+namespace benchmarks {
+
+namespace {
+uint64_t const statesPerScale = 250000;
+
+void benchmarkSccDecomposition(BenchmarkState& state, uint64_t blockSize) {
+    auto matrix = createBlockMatrix(statesPerScale * state.getParameters().scale, 1, 3, blockSize);
+    state.setCounter("states", matrix.getRowCount());
+    state.setCounter("entries", matrix.getEntryCount());
+    uint64_t numberOfSccs = 0;
+    state.measure([&]() {
+        storm::storage::StronglyConnectedComponentDecompositionOptions options;
+        options.numberOfThreads(state.getParameters().numberOfThreads);
+        storm::storage::StronglyConnectedComponentDecomposition<double> decomposition(matrix, options);
+        numberOfSccs = decomposition.size();
+    });
+    state.setCounter("sccs", numberOfSccs);
+}
+
+void benchmarkMecDecomposition(BenchmarkState& state) {
+    auto matrix = createBlockMatrix(statesPerScale * state.getParameters().scale / 4, 3, 3, 100);
+    auto backwardTransitions = matrix.transpose(true);
+    state.setCounter("states", matrix.getRowGroupCount());
+    state.setCounter("choices", matrix.getRowCount());
+    uint64_t numberOfMecs = 0;
+    state.measure([&]() {
+        storm::storage::MaximalEndComponentDecomposition<double> decomposition(matrix, backwardTransitions);
+        numberOfMecs = decomposition.size();
+    });
+    state.setCounter("mecs", numberOfMecs);
+}
+
+void benchmarkProb01(BenchmarkState& state) {
+    auto matrix = createBlockMatrix(statesPerScale * state.getParameters().scale, 3, 3, 100);
+    auto backwardTransitions = matrix.transpose(true);
+    storm::storage::BitVector phiStates(matrix.getRowGroupCount(), true);
+    storm::storage::BitVector psiStates(matrix.getRowGroupCount());
+    for (uint64_t stateIndex = 99; stateIndex < matrix.getRowGroupCount(); stateIndex += 100) {
+        psiStates.set(stateIndex);
+    }
+    state.setCounter("states", matrix.getRowGroupCount());
+    state.setCounter("choices", matrix.getRowCount());
+    uint64_t const numberOfThreads = state.getParameters().numberOfThreads;
+    state.measure([&]() {
+        storm::utility::graph::performProb01Max(matrix, matrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates, numberOfThreads);
+    });
+}
+}  // namespace
+
+STORM_BENCHMARK("graph/scc/small-components", [](BenchmarkState& state) { benchmarkSccDecomposition(state, 10); });
+STORM_BENCHMARK("graph/scc/large-components", [](BenchmarkState& state) { benchmarkSccDecomposition(state, 10000); });
+STORM_BENCHMARK("graph/mec", benchmarkMecDecomposition);
+STORM_BENCHMARK("graph/prob01max", benchmarkProb01);
+
+}  // namespace benchmarks
+}  // namespace storm
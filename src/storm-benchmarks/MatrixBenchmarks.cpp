@@ -0,0 +1,55 @@
+#include "storm-benchmarks/Benchmark.h"
+#include "storm-benchmarks/ModelGenerators.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/solver/multiplier/Multiplier.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace benchmarks {
+
+namespace {
+uint64_t const statesPerScale = 250000;
+
+storm::storage::SparseMatrix<double> createBenchmarkMatrix(BenchmarkParameters const& parameters, uint64_t choicesPerState) {
+    return createBlockMatrix(statesPerScale * parameters.scale, choicesPerState, 4, 1000);
+}
+
+void setMatrixCounters(BenchmarkState& state, storm::storage::SparseMatrix<double> const& matrix) {
+    state.setCounter("rows", matrix.getRowCount());
+    state.setCounter("entries", matrix.getEntryCount());
+}
+
+void benchmarkSparseMatrixMultiply(BenchmarkState& state) {
+    auto matrix = createBenchmarkMatrix(state.getParameters(), 1);
+    setMatrixCounters(state, matrix);
+    std::vector<double> x(matrix.getColumnCount(), 0.5), result(matrix.getRowCount());
+    state.measure([&]() { matrix.multiplyWithVector(x, result); });
+}
+
+void benchmarkSparseMatrixMultiplyAndReduce(BenchmarkState& state) {
+    auto matrix = createBenchmarkMatrix(state.getParameters(), 3);
+    setMatrixCounters(state, matrix);
+    std::vector<double> x(matrix.getColumnCount(), 0.5), result(matrix.getRowGroupCount());
+    state.measure([&]() { matrix.multiplyAndReduce(storm::OptimizationDirection::Maximize, matrix.getRowGroupIndices(), x, nullptr, result, nullptr); });
+}
+
+void benchmarkMultiplier(BenchmarkState& state, storm::solver::MultiplierType type) {
+    auto matrix = createBenchmarkMatrix(state.getParameters(), 3);
+    setMatrixCounters(state, matrix);
+    storm::Environment env;
+    env.solver().multiplier().setType(type);
+    auto multiplier = storm::solver::MultiplierFactory<double>().create(env, matrix);
+    std::vector<double> x(matrix.getColumnCount(), 0.5), result(matrix.getRowGroupCount());
+    state.measure([&]() { multiplier->multiplyAndReduce(env, storm::OptimizationDirection::Maximize, x, nullptr, result); });
+}
+}  // namespace
+
+STORM_BENCHMARK("matrix/sparse/multiply", benchmarkSparseMatrixMultiply);
+STORM_BENCHMARK("matrix/sparse/multiply-reduce", benchmarkSparseMatrixMultiplyAndReduce);
+STORM_BENCHMARK("multiplier/native", [](BenchmarkState& state) { benchmarkMultiplier(state, storm::solver::MultiplierType::Native); });
+STORM_BENCHMARK("multiplier/vioperator", [](BenchmarkState& state) { benchmarkMultiplier(state, storm::solver::MultiplierType::ViOperator); });
+
+}  // namespace benchmarks
+}  // namespace storm
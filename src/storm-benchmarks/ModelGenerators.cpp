@@ -0,0 +1,74 @@
+#include "storm-benchmarks/ModelGenerators.h"
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace benchmarks {
+
+storm::storage::SparseMatrix<double> createBlockMatrix(uint64_t numberOfStates, uint64_t choicesPerState, uint64_t successorsPerChoice, uint64_t blockSize,
+                                                       uint64_t seed) {
+    STORM_LOG_THROW(numberOfStates > 0 && choicesPerState > 0 && successorsPerChoice > 0 && blockSize > 0, storm::exceptions::InvalidArgumentException,
+                    "Invalid parameters for the generation of a block matrix.");
+    std::mt19937_64 generator(seed);
+    bool const hasRowGrouping = choicesPerState > 1;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates * choicesPerState, numberOfStates, 0, true, hasRowGrouping,
+                                                        hasRowGrouping ? numberOfStates : 0);
+    std::vector<uint64_t> successors;
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (hasRowGrouping) {
+            builder.newRowGroup(row);
+        }
+        uint64_t const blockStart = state - state % blockSize;
+        uint64_t const blockEnd = std::min(blockStart + blockSize, numberOfStates);
+        for (uint64_t choice = 0; choice < choicesPerState; ++choice, ++row) {
+            successors.clear();
+            for (uint64_t successor = 0; successor < successorsPerChoice; ++successor) {
+                successors.push_back(blockStart + generator() % (blockEnd - blockStart));
+            }
+            // With a small probability, a choice leaves the block.
+            if (blockEnd < numberOfStates && generator() % 8 == 0) {
+                successors.back() = blockEnd + generator() % std::min(blockSize, numberOfStates - blockEnd);
+            }
+            std::sort(successors.begin(), successors.end());
+            successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+            double const probability = 1.0 / successors.size();
+            for (auto const& successor : successors) {
+                builder.addNextValue(row, successor, probability);
+            }
+        }
+    }
+    return builder.build();
+}
+
+std::string createGridWorldPrismProgram(uint64_t gridSize) {
+    STORM_LOG_THROW(gridSize >= 2, storm::exceptions::InvalidArgumentException, "The grid needs to have a size of at least two.");
+    std::stringstream program;
+    program << "mdp\n\n";
+    program << "const int N = " << gridSize - 1 << ";\n\n";
+    program << "module robot\n";
+    program << "    x : [0..N] init 0;\n";
+    program << "    y : [0..N] init 0;\n";
+    program << "    [step] x<N -> 0.9: (x'=x+1) + 0.1: true;\n";
+    program << "    [step] x>0 -> 0.9: (x'=x-1) + 0.1: true;\n";
+    program << "    [step] y<N -> 0.9: (y'=y+1) + 0.1: true;\n";
+    program << "    [step] y>0 -> 0.9: (y'=y-1) + 0.1: true;\n";
+    program << "endmodule\n\n";
+    program << "module adversary\n";
+    program << "    ax : [0..N] init N;\n";
+    program << "    ay : [0..N] init N;\n";
+    program << "    [step] true -> 0.25: (ax'=min(ax+1,N)) + 0.25: (ax'=max(ax-1,0)) + 0.25: (ay'=min(ay+1,N)) + 0.25: (ay'=max(ay-1,0));\n";
+    program << "endmodule\n\n";
+    program << "label \"goal\" = x=N & y=N;\n";
+    program << "label \"crash\" = x=ax & y=ay;\n";
+    return program.str();
+}
+
+}  // namespace benchmarks
+}  // namespace storm
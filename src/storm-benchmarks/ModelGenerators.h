@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace benchmarks {
+
+/*!
+ * Creates the transition matrix of a random Markov chain (if choicesPerState is one) or MDP with the given number of states.
+ * The states are partitioned into blocks of consecutive states. Each choice leads to states of its own block and, with a small probability, to the next
+ * block. Hence, blocks of more than one state typically form SCCs. All successors of a choice have the same probability, so the matrix has few distinct
+ * values (as is the case for most real-world models).
+ *
+ * @param numberOfStates The number of states.
+ * @param choicesPerState The number of choices of each state.
+ * @param successorsPerChoice The number of successors of each choice.
+ * @param blockSize The size of the blocks.
+ * @param seed The seed of the random number generator.
+ */
+storm::storage::SparseMatrix<double> createBlockMatrix(uint64_t numberOfStates, uint64_t choicesPerState, uint64_t successorsPerChoice, uint64_t blockSize,
+                                                       uint64_t seed = 42);
+
+/*!
+ * Creates a PRISM program for an MDP in which a robot moves on a grid with the given size. In each step, the robot may move into one of the four directions,
+ * where it slips (and remains at its position) with some probability. An adversary moves on the grid as well, which makes the number of states
+ * grow quadratically in the number of grid cells.
+ */
+std::string createGridWorldPrismProgram(uint64_t gridSize);
+
+}  // namespace benchmarks
+}  // namespace storm
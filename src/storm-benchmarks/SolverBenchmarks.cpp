@@ -0,0 +1,91 @@
+#include "storm-benchmarks/Benchmark.h"
+#include "storm-benchmarks/ModelGenerators.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
+#include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
+#include "storm/solver/MinMaxLinearEquationSolver.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+
+namespace storm {
+namespace benchmarks {
+
+namespace {
+uint64_t const statesPerScale = 100000;
+
+void benchmarkMinMaxSolver(BenchmarkState& state, storm::solver::MinMaxMethod method) {
+    // Each choice reaches a target with probability 0.1, which makes value iteration converge in a reasonable number of iterations.
+    auto matrix = createBlockMatrix(statesPerScale * state.getParameters().scale, 3, 4, 1000);
+    for (auto& entry : matrix) {
+        entry.setValue(entry.getValue() * 0.9);
+    }
+    std::vector<double> b(matrix.getRowCount(), 0.1);
+    state.setCounter("states", matrix.getRowGroupCount());
+    state.setCounter("choices", matrix.getRowCount());
+    state.setCounter("entries", matrix.getEntryCount());
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(method);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+    env.solver().native().setNumberOfThreads(state.getParameters().numberOfThreads);
+    env.solver().topological().setNumberOfThreads(state.getParameters().numberOfThreads);
+    env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+
+    auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, matrix);
+    solver->setHasUniqueSolution(true);
+    solver->setHasNoEndComponents(true);
+    solver->setBounds(0.0, 1.0);
+    solver->setRequirementsChecked();
+    std::vector<double> x(matrix.getRowGroupCount());
+    state.measure([&]() {
+        std::fill(x.begin(), x.end(), 0.0);
+        solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b);
+    });
+}
+
+void benchmarkCtmcTransient(BenchmarkState& state, bool batched) {
+    // Rates are the transition probabilities of the block matrix, so each state has exit rate one.
+    auto rateMatrix = createBlockMatrix(statesPerScale * state.getParameters().scale / 5, 1, 4, 1000);
+    std::vector<double> exitRates = rateMatrix.getRowSumVector();
+    storm::storage::BitVector initialStates(rateMatrix.getRowCount());
+    initialStates.set(0);
+    storm::storage::BitVector phiStates(rateMatrix.getRowCount(), true);
+    storm::storage::BitVector psiStates(rateMatrix.getRowCount());
+    std::vector<double> timeBounds;
+    for (uint64_t timeBound = 1; timeBound <= 20; ++timeBound) {
+        timeBounds.push_back(static_cast<double>(timeBound));
+    }
+    state.setCounter("states", rateMatrix.getRowCount());
+    state.setCounter("time-bounds", timeBounds.size());
+
+    // The individual computations serve as the baseline and thus use the sequential single-bound algorithm.
+    storm::Environment env;
+    env.solver().timeBounded().setNumberOfThreads(batched ? state.getParameters().numberOfThreads : 1);
+    using Helper = storm::modelchecker::helper::SparseCtmcCslHelper;
+    state.measure([&]() {
+        if (batched) {
+            Helper::computeAllTransientProbabilities(env, rateMatrix, initialStates, phiStates, psiStates, exitRates, timeBounds);
+        } else {
+            for (auto const& timeBound : timeBounds) {
+                Helper::computeAllTransientProbabilities(env, rateMatrix, initialStates, phiStates, psiStates, exitRates, timeBound);
+            }
+        }
+    });
+}
+}  // namespace
+
+STORM_BENCHMARK("solver/minmax/value-iteration", [](BenchmarkState& state) { benchmarkMinMaxSolver(state, storm::solver::MinMaxMethod::ValueIteration); });
+STORM_BENCHMARK("solver/minmax/optimistic-value-iteration",
+                [](BenchmarkState& state) { benchmarkMinMaxSolver(state, storm::solver::MinMaxMethod::OptimisticValueIteration); });
+STORM_BENCHMARK("solver/minmax/topological", [](BenchmarkState& state) { benchmarkMinMaxSolver(state, storm::solver::MinMaxMethod::Topological); });
+STORM_BENCHMARK("solver/ctmc-transient/individual", [](BenchmarkState& state) { benchmarkCtmcTransient(state, false); });
+STORM_BENCHMARK("solver/ctmc-transient/batched", [](BenchmarkState& state) { benchmarkCtmcTransient(state, true); });
+
+}  // namespace benchmarks
+}  // namespace storm
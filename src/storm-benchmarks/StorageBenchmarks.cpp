@@ -0,0 +1,71 @@
+#include "storm-benchmarks/Benchmark.h"
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+#include "storm/utility/ThreadPool.h"
+
+namespace storm {
+namespace benchmarks {
+
+namespace {
+uint64_t const keysPerScale = 500000;
+uint64_t const bitsPerKey = 128;
+
+std::vector<storm::storage::BitVector> createKeys(uint64_t numberOfKeys) {
+    std::mt19937_64 generator(42);
+    std::vector<storm::storage::BitVector> keys;
+    keys.reserve(numberOfKeys);
+    for (uint64_t keyIndex = 0; keyIndex < numberOfKeys; ++keyIndex) {
+        storm::storage::BitVector key(bitsPerKey);
+        for (uint64_t word = 0; word + 1 < bitsPerKey / 64; ++word) {
+            key.setBucket(word, generator());
+        }
+        // Make sure that the keys are distinct.
+        key.setBucket(bitsPerKey / 64 - 1, keyIndex);
+        keys.push_back(std::move(key));
+    }
+    return keys;
+}
+
+// Each key is inserted once and then looked up once, which resembles the access pattern of the state storage during exploration.
+void benchmarkBitVectorHashMap(BenchmarkState& state) {
+    auto keys = createKeys(keysPerScale * state.getParameters().scale);
+    state.setCounter("keys", keys.size());
+    state.measure([&]() {
+        storm::storage::BitVectorHashMap<uint64_t> map(bitsPerKey);
+        for (uint64_t round = 0; round < 2; ++round) {
+            for (uint64_t keyIndex = 0; keyIndex < keys.size(); ++keyIndex) {
+                map.findOrAdd(keys[keyIndex], keyIndex);
+            }
+        }
+    });
+}
+
+void benchmarkConcurrentBitVectorHashMap(BenchmarkState& state) {
+    auto keys = createKeys(keysPerScale * state.getParameters().scale);
+    auto threadPool = storm::utility::ThreadPool::getShared(state.getParameters().numberOfThreads);
+    uint64_t const numberOfChunks = 64 * threadPool->getNumberOfWorkers();
+    state.setCounter("keys", keys.size());
+    state.measure([&]() {
+        storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(bitsPerKey);
+        for (uint64_t round = 0; round < 2; ++round) {
+            threadPool->parallelFor(numberOfChunks, [&](uint64_t chunk, uint64_t) {
+                for (uint64_t keyIndex = chunk * keys.size() / numberOfChunks; keyIndex < (chunk + 1) * keys.size() / numberOfChunks; ++keyIndex) {
+                    map.findOrAdd(keys[keyIndex], keyIndex);
+                }
+            });
+        }
+    });
+}
+}  // namespace
+
+STORM_BENCHMARK("storage/bitvector-hashmap/sequential", benchmarkBitVectorHashMap);
+STORM_BENCHMARK("storage/bitvector-hashmap/concurrent", benchmarkConcurrentBitVectorHashMap);
+
+}  // namespace benchmarks
+}  // namespace storm
@@ -0,0 +1,96 @@
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "storm-benchmarks/Benchmark.h"
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/exceptions/BaseException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/io/file.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/utility/initialize.h"
+#include "storm/utility/macros.h"
+
+namespace {
+void printUsage() {
+    std::cout << "Usage: storm-benchmarks [options] [-- storm options]\n"
+              << "Options:\n"
+              << "  --list                 Lists the available benchmarks.\n"
+              << "  --filter <regex>       Only runs benchmarks whose name matches the given regular expression.\n"
+              << "  --scale <n>            Scales the size of the synthetic models (default: 1).\n"
+              << "  --threads <n>          The number of threads used by multi-threaded code (default: 1, 0 means auto-detect).\n"
+              << "  --repetitions <n>      The number of measured repetitions of each benchmark (default: 5).\n"
+              << "  --json <file>          Writes the results in JSON format to the given file.\n"
+              << "All arguments after '--' are passed to storm (e.g. '-- --qvbsroot <path>' or '-- --multiplier:type native').\n";
+}
+}  // namespace
+
+int main(int argc, char const** argv) {
+    try {
+        storm::utility::setUp();
+        storm::settings::initializeAll("Storm Benchmarks", "storm-benchmarks");
+
+        storm::benchmarks::BenchmarkParameters parameters;
+        std::regex filter(".*");
+        std::string jsonFilename;
+        std::vector<std::string> stormArguments;
+        for (int argumentIndex = 1; argumentIndex < argc; ++argumentIndex) {
+            std::string argument(argv[argumentIndex]);
+            auto nextArgument = [&]() {
+                STORM_LOG_THROW(argumentIndex + 1 < argc, storm::exceptions::InvalidArgumentException, "Missing value for argument " << argument << ".");
+                return std::string(argv[++argumentIndex]);
+            };
+            if (argument == "--") {
+                stormArguments.assign(argv + argumentIndex + 1, argv + argc);
+                break;
+            } else if (argument == "--list") {
+                for (auto const& benchmark : storm::benchmarks::getBenchmarks()) {
+                    std::cout << benchmark.first << '\n';
+                }
+                return 0;
+            } else if (argument == "--filter") {
+                filter = std::regex(nextArgument());
+            } else if (argument == "--scale") {
+                parameters.scale = std::stoull(nextArgument());
+            } else if (argument == "--threads") {
+                parameters.numberOfThreads = std::stoull(nextArgument());
+            } else if (argument == "--repetitions") {
+                parameters.repetitions = std::stoull(nextArgument());
+            } else if (argument == "--json") {
+                jsonFilename = nextArgument();
+            } else {
+                printUsage();
+                return argument == "--help" ? 0 : 1;
+            }
+        }
+        storm::settings::mutableManager().setFromExplodedString(stormArguments);
+
+        storm::json<double> results = storm::json<double>::array();
+        for (auto const& [name, function] : storm::benchmarks::getBenchmarks()) {
+            if (!std::regex_search(name, filter)) {
+                continue;
+            }
+            storm::benchmarks::BenchmarkState state(name, parameters);
+            function(state);
+            std::cout << state.toString() << '\n';
+            results.push_back(state.toJson());
+        }
+
+        if (!jsonFilename.empty()) {
+            std::ofstream jsonFile;
+            storm::io::openFile(jsonFilename, jsonFile);
+            jsonFile << storm::dumpJson(results) << '\n';
+            storm::io::closeFile(jsonFile);
+        }
+        storm::utility::cleanUp();
+        return 0;
+    } catch (storm::exceptions::BaseException const& exception) {
+        STORM_LOG_ERROR("An exception caused the benchmarks to terminate. The message of the exception is: " << exception.what());
+        return 1;
+    } catch (std::exception const& exception) {
+        STORM_LOG_ERROR("An unexpected exception occurred and caused the benchmarks to terminate. The message of this exception is: " << exception.what());
+        return 2;
+    }
+}
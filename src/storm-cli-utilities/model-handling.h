@@ -570,6 +570,18 @@ std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const&
                         "Can not build interval model for the provided value type.");
         return storm::api::buildSparseModel<storm::Interval>(input.model.get(), options);
     } else {
+        if constexpr (!storm::IsIntervalType<ValueType>) {
+            auto modelType = input.model->getModelType();
+            if (storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() &&
+                (modelType == storm::storage::SymbolicModelDescription::ModelType::DTMC ||
+                 modelType == storm::storage::SymbolicModelDescription::ModelType::CTMC)) {
+                auto const& bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
+                if (bisimulationSettings.isOnTheFlySet() && bisimulationSettings.isStrongBisimulationSet()) {
+                    STORM_PRINT_AND_LOG("Building the bisimulation quotient during state-space exploration.\n");
+                    return storm::api::buildSparseBisimulationQuotient<ValueType>(input.model.get(), options);
+                }
+            }
+        }
         return storm::api::buildSparseModel<ValueType>(input.model.get(), options);
     }
 }
@@ -689,8 +701,12 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> preprocessSparseModelBi
         bisimType = storm::storage::BisimulationType::Weak;
     }
 
+    bool signatureRefinement =
+        bisimulationSettings.getSparseRefinementMode() == storm::settings::modules::BisimulationSettings::SparseRefinementMode::Signature;
+
     STORM_LOG_INFO("Performing bisimulation minimization...");
-    return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType, graphPreserving);
+    return storm::api::performBisimulationMinimization<ValueType>(model, createFormulasToRespect(input.properties), bisimType, graphPreserving,
+                                                                  signatureRefinement, bisimulationSettings.getNumberOfThreads());
 }
 
 template<typename ValueType>
@@ -780,6 +796,7 @@ void exportModel(std::shared_ptr<storm::models::sparse::Model<ValueType>> const&
             case storm::io::ModelExportFormat::Umb: {
                 storm::umb::ExportOptions options;
                 options.compression = ioSettings.getCompressionMode();
+                options.numberOfThreads = ioSettings.getCompressionThreads();
                 storm::api::exportSparseModelAsUmb(model, ioSettings.getExportBuildFilename(), options);
                 break;
             }
@@ -1570,6 +1587,52 @@ inline std::shared_ptr<storm::models::ModelBase> buildPreprocessExportModel(Symb
     return model;
 }
 
+/*!
+ * Checks whether the model can be written to a UMB archive during state-space exploration, i.e., without building the model in memory.
+ * This is only possible if the model is exported as is and not needed afterwards.
+ */
+inline bool canExportModelDuringExploration(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+    auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+    auto buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+    auto transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
+
+    if (!input.model || !input.properties.empty() || !ioSettings.isExportBuildSet() || ioSettings.getExportBuildFormat() != storm::io::ModelExportFormat::Umb) {
+        return false;
+    }
+    if (mpi.engine != storm::utility::Engine::Sparse || mpi.buildValueType != ModelProcessingInformation::ValueType::FinitePrecision ||
+        mpi.applyBisimulation) {
+        return false;
+    }
+    // Markov automata are closed (and possibly transformed) before they are exported.
+    auto modelType = input.model->getModelType();
+    if (modelType != storm::storage::SymbolicModelDescription::ModelType::DTMC && modelType != storm::storage::SymbolicModelDescription::ModelType::CTMC &&
+        modelType != storm::storage::SymbolicModelDescription::ModelType::MDP) {
+        return false;
+    }
+    if (input.model->isPrismProgram() && input.model->asPrismProgram().hasIntervalUpdates()) {
+        return false;
+    }
+    return !buildSettings.isNoBuildModelSet() && buildSettings.getExplorationOrder() == storm::builder::ExplorationOrder::Bfs &&
+           !buildSettings.isBuildStateValuationsSet() && !transformationSettings.getModelPermutation().has_value() &&
+           !transformationSettings.isToDiscreteTimeModelSet() && !transformationSettings.isToNondeterministicModelSet() && !ioSettings.isExportExplicitSet() &&
+           !ioSettings.isExportDotSet() && !ioSettings.isExportDdSet();
+}
+
+/*!
+ * Explores the model and writes it to the UMB archive given by the --exportbuild option without building the model in memory.
+ */
+inline void exportModelDuringExploration(SymbolicInput const& input) {
+    auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+    storm::utility::Stopwatch modelExportWatch(true);
+    STORM_PRINT("Exporting model to '" << ioSettings.getExportBuildFilename() << "' during state-space exploration.\n");
+    storm::umb::ExportOptions options;
+    options.compression = ioSettings.getCompressionMode();
+    options.numberOfThreads = ioSettings.getCompressionThreads();
+    storm::api::buildSparseModelAsUmb<double>(input.model.get(), createBuildOptionsSparseFromSettings(input), ioSettings.getExportBuildFilename(), options);
+    modelExportWatch.stop();
+    STORM_PRINT("Time for model construction and export: " << modelExportWatch << ".\n\n");
+}
+
 inline void processInput(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto abstractionSettings = storm::settings::getModule<storm::settings::modules::AbstractionSettings>();
     auto counterexampleSettings = storm::settings::getModule<storm::settings::modules::CounterexampleGeneratorSettings>();
@@ -1581,6 +1644,9 @@ inline void processInput(SymbolicInput const& input, ModelProcessingInformation
                             [&input, &mpi]<storm::dd::DdType DD, typename VT>() { verifyWithAbstractionRefinementEngine<DD, VT>(input, mpi); });
     } else if (mpi.engine == storm::utility::Engine::Exploration) {
         applyValueType(mpi.verificationValueType, [&input, &mpi]<typename VT>() { verifyWithExplorationEngine<VT>(input, mpi); });
+    } else if (canExportModelDuringExploration(input, mpi)) {
+        // As no property is checked, the model does not need to be kept in memory.
+        exportModelDuringExploration(input);
     } else {
         std::shared_ptr<storm::models::ModelBase> model = buildPreprocessExportModel(input, mpi);
         if (model) {
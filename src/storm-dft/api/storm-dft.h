@@ -243,13 +243,20 @@ typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analy
  * @param chunksize
  * The size of the chunks of doubles to work on at a time
  *
+ * @param numberOfThreads
+ * The number of threads used to analyse independent dynamic modules when using modularisation (0 means auto-detect)
+ *
+ * @param numberOfBddThreads
+ * The number of threads used to evaluate chunks of timepoints on the BDD (0 means auto-detect)
+ *
  */
 template<typename ValueType>
 void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<ValueType>> const& dft, bool const exportToDot, std::string const& filename,
                    bool const calculateMttf, double const mttfPrecision, double const mttfStepsize, std::string const mttfAlgorithmName,
                    bool const calculateMCS, bool const calculateProbability, bool const useModularisation, std::string const importanceMeasureName,
                    std::vector<double> const& timepoints, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties,
-                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize);
+                   std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize, uint64_t const numberOfThreads = 1,
+                   uint64_t const numberOfBddThreads = 1);
 
 /*!
  * Analyze the DFT using the SMT encoding
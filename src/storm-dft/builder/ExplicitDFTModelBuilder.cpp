@@ -40,7 +40,8 @@ ExplicitDFTModelBuilder<ValueType, StateType>::ExplicitDFTModelBuilder(storm::df
       generator(dft, *stateGenerationInfo),
       matrixBuilder(!generator.isDeterministicModel()),
       stateStorage(dft.stateBitVectorSize()),
-      explorationQueue(1, 0, 0.9, false) {
+      explorationQueue(1, 0, 0.9, false),
+      statePool(dft.stateBitVectorSize()) {
     // Set relevant events
     STORM_LOG_DEBUG("Relevant events: " << this->dft.getRelevantEventsString());
     if (dft.getRelevantEvents().size() <= 1) {
@@ -187,7 +188,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::buildModel(size_t iteration,
         }
 
         // Initialize heuristic values for inital state
-        STORM_LOG_ASSERT(!statesNotExplored.at(initialStateIndex).second, "Heuristic for initial state is already initialized");
+        STORM_LOG_ASSERT(!statesNotExplored.at(initialStateIndex).heuristic, "Heuristic for initial state is already initialized");
         ExplorationHeuristicPointer heuristic;
         switch (usedHeuristic) {
             case storm::dft::builder::ApproximationHeuristic::DEPTH:
@@ -203,7 +204,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::buildModel(size_t iteration,
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
         }
         heuristic->markExpand();
-        statesNotExplored[initialStateIndex].second = heuristic;
+        statesNotExplored.at(initialStateIndex).heuristic = heuristic;
         explorationQueue.push(heuristic);
     } else {
         initializeNextIteration();
@@ -265,8 +266,8 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::initializeNextIteration() {
     // Push skipped states to explore queue
     // TODO: remove
     for (auto const& skippedState : skippedStates) {
-        statesNotExplored[skippedState.second.first->getId()] = skippedState.second;
-        explorationQueue.push(skippedState.second.second);
+        statesNotExplored[skippedState.second.heuristic->getId()] = skippedState.second;
+        explorationQueue.push(skippedState.second.heuristic);
     }
 
     // Initialize matrix builder again
@@ -295,7 +296,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::initializeNextIteration() {
     matrixBuilder.mappingOffset = nrStates;
     STORM_LOG_TRACE("# expanded states: " << nrExpandedStates);
     StateType skippedIndex = nrExpandedStates;
-    std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> skippedStatesNew;
+    std::map<StateType, PendingState> skippedStatesNew;
     for (size_t id = 0; id < matrixBuilder.stateRemapping.size(); ++id) {
         StateType index = matrixBuilder.getRemapping(id);
         auto itFind = skippedStates.find(index);
@@ -345,7 +346,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::initializeNextIteration() {
                     auto itFind = skippedStates.find(itEntry->getColumn());
                     if (itFind != skippedStates.end()) {
                         // Set id for skipped states as we remap it later
-                        matrixBuilder.addTransition(matrixBuilder.mappingOffset + itFind->second.first->getId(), itEntry->getValue());
+                        matrixBuilder.addTransition(matrixBuilder.mappingOffset + itFind->second.heuristic->getId(), itEntry->getValue());
                     } else {
                         // Set newly remapped index for expanded states
                         matrixBuilder.addTransition(indexRemapping[itEntry->getColumn()], itEntry->getValue());
@@ -375,21 +376,16 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
         StateType currentId = currentExplorationHeuristic->getId();
         auto itFind = statesNotExplored.find(currentId);
         STORM_LOG_ASSERT(itFind != statesNotExplored.end(), "Id " << currentId << " not found");
-        DFTStatePointer currentState = itFind->second.first;
-        STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.second, "Exploration heuristics do not match");
-        STORM_LOG_ASSERT(currentState->getId() == currentId, "Ids do not match");
+        STORM_LOG_ASSERT(currentExplorationHeuristic == itFind->second.heuristic, "Exploration heuristics do not match");
+        PendingState pendingState = itFind->second;
         // Remove it from the list of not explored states
         statesNotExplored.erase(itFind);
+
+        // Decode concrete state from the state pool
+        DFTStatePointer currentState = loadState(currentId, pendingState.slot);
         STORM_LOG_ASSERT(stateStorage.stateToId.contains(currentState->status()), "State is not contained in state storage.");
         STORM_LOG_ASSERT(stateStorage.stateToId.getValue(currentState->status()) == currentId, "Ids of states do not coincide.");
 
-        // Get concrete state if necessary
-        if (currentState->isPseudoState()) {
-            // Create concrete state from pseudo state
-            currentState->construct();
-        }
-        STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
-
         // Remember that the current row group was actually filled with the transitions of a different state
         matrixBuilder.setRemapping(currentId);
 
@@ -409,11 +405,14 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
             // STORM_LOG_ASSERT(this->uniqueFailedState, "Approximation only works with unique failed state");
             matrixBuilder.addTransition(0, storm::utility::zero<ValueType>());
             // Remember skipped state
-            skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = std::make_pair(currentState, currentExplorationHeuristic);
+            // The state remains in the state pool as it might be expanded in a later iteration
+            skippedStates[matrixBuilder.getCurrentRowGroup() - 1] = pendingState;
             matrixBuilder.finishRow();
         } else {
             // Explore the current state
             ++nrExpandedStates;
+            // The compressed state is no longer needed as the state is decoded already
+            statePool.release(pendingState.slot);
             storm::generator::StateBehavior<ValueType, StateType> behavior =
                 generator.expand(std::bind(&ExplicitDFTModelBuilder::getOrAddStateIndex, this, std::placeholders::_1));
             STORM_LOG_ASSERT(!behavior.empty(), "Behavior is empty.");
@@ -430,8 +429,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
                     auto iter = statesNotExplored.find(stateProbabilityPair.first);
                     if (iter != statesNotExplored.end()) {
                         // Update heuristic values
-                        DFTStatePointer state = iter->second.first;
-                        if (!iter->second.second) {
+                        if (!iter->second.heuristic) {
                             // Initialize heuristic values
                             ExplorationHeuristicPointer heuristic;
                             switch (usedHeuristic) {
@@ -451,22 +449,14 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
                                     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Heuristic not known.");
                             }
 
-                            iter->second.second = heuristic;
-                            // if (state->hasFailed(dft.getTopLevelIndex()) || state->isFailsafe(dft.getTopLevelIndex()) ||
-                            // state->getFailableElements().hasDependencies() || (!state->getFailableElements().hasDependencies() &&
-                            // !state->getFailableElements().hasBEs())) {
-                            if (state->getFailableElements().hasDependencies() ||
-                                (!state->getFailableElements().hasDependencies() && !state->getFailableElements().hasBEs())) {
+                            iter->second.heuristic = heuristic;
+                            if (iter->second.mustExpand) {
                                 // Do not skip absorbing state or if reached by dependencies
-                                iter->second.second->markExpand();
+                                iter->second.heuristic->markExpand();
                             }
                             if (usedHeuristic == storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE) {
                                 // Compute bounds for heuristic now
-                                if (state->isPseudoState()) {
-                                    // Create concrete state from pseudo state
-                                    state->construct();
-                                }
-                                STORM_LOG_ASSERT(!currentState->isPseudoState(), "State is pseudo state.");
+                                DFTStatePointer state = loadState(stateProbabilityPair.first, iter->second.slot);
 
                                 // Initialize bounds
                                 // TODO: avoid hack
@@ -476,21 +466,21 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
                             }
 
                             explorationQueue.push(heuristic);
-                        } else if (!iter->second.second->isExpand()) {
+                        } else if (!iter->second.heuristic->isExpand()) {
                             bool changedPriority = false;
-                            double oldPriority = iter->second.second->getPriority();
+                            double oldPriority = iter->second.heuristic->getPriority();
                             switch (usedHeuristic) {
                                 case storm::dft::builder::ApproximationHeuristic::DEPTH:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic,
+                                    changedPriority = iter->second.heuristic->updateHeuristicValues(*currentExplorationHeuristic,
                                                                                                  /* next values are irrelevant */ stateProbabilityPair.second,
                                                                                                  stateProbabilityPair.second);
                                     break;
                                 case storm::dft::builder::ApproximationHeuristic::PROBABILITY:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
+                                    changedPriority = iter->second.heuristic->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
                                                                                                  choice.getTotalMass());
                                     break;
                                 case storm::dft::builder::ApproximationHeuristic::BOUNDDIFFERENCE:
-                                    changedPriority = iter->second.second->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
+                                    changedPriority = iter->second.heuristic->updateHeuristicValues(*currentExplorationHeuristic, stateProbabilityPair.second,
                                                                                                  choice.getTotalMass());
                                     break;
                                 default:
@@ -498,7 +488,7 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::exploreStateSpace(double app
                             }
                             if (changedPriority) {
                                 // Update priority queue
-                                explorationQueue.update(iter->second.second, oldPriority);
+                                explorationQueue.update(iter->second.heuristic, oldPriority);
                             }
                         }
                     }
@@ -635,7 +625,6 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitDFTModelBuilder
             for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
                 auto matrixEntry = matrix.getRow(it->first, 0).begin();
                 STORM_LOG_ASSERT(matrixEntry->getColumn() == 0, "Transition has wrong target state.");
-                STORM_LOG_ASSERT(!it->second.first->isPseudoState(), "State is still pseudo state.");
                 matrixEntry->setValue(storm::utility::one<ValueType>());
                 matrixEntry->setColumn(it->first);
             }
@@ -755,14 +744,14 @@ void ExplicitDFTModelBuilder<ValueType, StateType>::changeMatrixBound(storm::sto
     for (auto it = skippedStates.begin(); it != skippedStates.end(); ++it) {
         auto matrixEntry = matrix.getRow(it->first, 0).begin();
         STORM_LOG_ASSERT(matrixEntry->getColumn() == 0, "Transition has wrong target state.");
-        STORM_LOG_ASSERT(!it->second.first->isPseudoState(), "State is still pseudo state.");
+        DFTStatePointer state = loadState(it->second.heuristic->getId(), it->second.slot);
 
         // Change bound
         // TODO: cache values inbetween iterations
         if (lowerBound) {
-            matrixEntry->setValue(getLowerBound(it->second.first));
+            matrixEntry->setValue(getLowerBound(state));
         } else {
-            matrixEntry->setValue(getUpperBound(it->second.first));
+            matrixEntry->setValue(getUpperBound(state));
         }
     }
 }
@@ -926,17 +915,14 @@ StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTS
         stateId = stateStorage.stateToId.getValue(state->status());
         STORM_LOG_TRACE("State " << dft.getStateString(state) << " with id " << stateId << " already exists");
         if (!changed) {
-            // Check if state is pseudo state
+            // Check if state was only reached as pseudo state so far
             // If state is explored already the possible pseudo state was already constructed
             auto iter = statesNotExplored.find(stateId);
-            if (iter != statesNotExplored.end() && iter->second.first->isPseudoState()) {
-                // Create pseudo state now
-                STORM_LOG_ASSERT(iter->second.first->getId() == stateId, "Ids do not match.");
-                STORM_LOG_ASSERT(iter->second.first->status() == state->status(), "Pseudo states do not coincide.");
+            if (iter != statesNotExplored.end() && iter->second.pseudoState) {
+                // Use information of concrete state now
                 state->setId(stateId);
-                // Update mapping to map to concrete state now
-                // TODO: just change pointer?
-                statesNotExplored[stateId] = std::make_pair(state, iter->second.second);
+                iter->second.pseudoState = false;
+                iter->second.mustExpand = mustExpand(state);
                 // We do not push the new state on the exploration queue as the pseudo state was already pushed
                 STORM_LOG_TRACE("Created pseudo state " << dft.getStateString(state));
             }
@@ -949,8 +935,8 @@ StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTS
         stateId = stateStorage.stateToId.findOrAdd(state->status(), state->getId());
         STORM_LOG_ASSERT(stateId == state->getId(), "Ids do not match.");
         // Insert state as not yet explored
-        ExplorationHeuristicPointer nullHeuristic;
-        statesNotExplored[stateId] = std::make_pair(state, nullHeuristic);
+        // Only the compressed state is kept, the state object itself is discarded by the generator
+        statesNotExplored[stateId] = PendingState{statePool.add(state->status()), nullptr, state->isPseudoState(), mustExpand(state)};
         // Reserve one slot for the new state in the remapping
         matrixBuilder.stateRemapping.push_back(0);
         STORM_LOG_TRACE("New " << (state->isPseudoState() ? "pseudo" : "concrete") << " state: " << dft.getStateString(state));
@@ -958,6 +944,20 @@ StateType ExplicitDFTModelBuilder<ValueType, StateType>::getOrAddStateIndex(DFTS
     return stateId;
 }
 
+template<typename ValueType, typename StateType>
+typename ExplicitDFTModelBuilder<ValueType, StateType>::DFTStatePointer ExplicitDFTModelBuilder<ValueType, StateType>::loadState(StateType id,
+                                                                                                                              uint64_t slot) const {
+    DFTStatePointer state = std::make_shared<storm::dft::storage::DFTState<ValueType>>(statePool.get(slot), dft, *stateGenerationInfo, id);
+    state->construct();
+    return state;
+}
+
+template<typename ValueType, typename StateType>
+bool ExplicitDFTModelBuilder<ValueType, StateType>::mustExpand(DFTStatePointer const& state) const {
+    // For pseudo states no failable elements are known yet. They are therefore always expanded.
+    return state->getFailableElements().hasDependencies() || !state->getFailableElements().hasBEs();
+}
+
 template<typename ValueType, typename StateType>
 void ExplicitDFTModelBuilder<ValueType, StateType>::setMarkovian(bool markovian) {
     if (matrixBuilder.getCurrentRowGroup() > modelComponents.markovianStates.size()) {
@@ -971,7 +971,7 @@ template<typename ValueType, typename StateType>
 void ExplicitDFTModelBuilder<ValueType, StateType>::printNotExplored() const {
     std::cout << "states not explored:\n";
     for (auto it : statesNotExplored) {
-        std::cout << it.first << " -> " << dft.getStateString(it.second.first) << '\n';
+        std::cout << it.first << " -> " << dft.getStateString(statePool.get(it.second.slot), *stateGenerationInfo, it.first) << '\n';
     }
 }
 
@@ -16,6 +16,7 @@
 #include "storm-dft/generator/DftNextStateGenerator.h"
 #include "storm-dft/storage/BucketPriorityQueue.h"
 #include "storm-dft/storage/DFT.h"
+#include "storm-dft/storage/DFTStatePool.h"
 #include "storm-dft/storage/DftSymmetries.h"
 
 namespace storm::dft {
@@ -54,6 +55,22 @@ class ExplicitDFTModelBuilder {
         bool deterministicModel;
     };
 
+    // Information about a state which was discovered but not yet expanded.
+    // The state itself is only kept in compressed form in the state pool and decoded on demand.
+    struct PendingState {
+        // Slot of the state in the state pool.
+        uint64_t slot;
+
+        // Heuristic values (only set once the state is reached during exploration).
+        ExplorationHeuristicPointer heuristic;
+
+        // Flag indicating whether the state was only reached as pseudo state so far.
+        bool pseudoState;
+
+        // Flag indicating whether the state must be expanded, i.e., it cannot be skipped during approximation.
+        bool mustExpand;
+    };
+
     // A class holding the information for building the transition matrix.
     class MatrixBuilder {
        public:
@@ -209,6 +226,27 @@ class ExplicitDFTModelBuilder {
      */
     StateType getOrAddStateIndex(DFTStatePointer const& state);
 
+    /*!
+     * Decode a state from the state pool.
+     * The returned state is a transient object which is not stored in the builder.
+     *
+     * @param id   Id of the state.
+     * @param slot Slot of the state in the state pool.
+     *
+     * @return Concrete state.
+     */
+    DFTStatePointer loadState(StateType id, uint64_t slot) const;
+
+    /*!
+     * Check whether the state must be expanded, i.e., it cannot be skipped during approximation.
+     * This is the case for absorbing states and states reached via dependencies.
+     *
+     * @param state The state.
+     *
+     * @return True iff the state must be expanded.
+     */
+    bool mustExpand(DFTStatePointer const& state) const;
+
     /*!
      * Set markovian flag for the current state.
      *
@@ -304,14 +342,17 @@ class ExplicitDFTModelBuilder {
     // A priority queue of states that still need to be explored.
     storm::dft::storage::BucketPriorityQueue<ExplorationHeuristic> explorationQueue;
 
-    // A mapping of not yet explored states from the id to the tuple (state object, heuristic values).
-    std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> statesNotExplored;
+    // Compressed representation of all states which are not yet expanded (including skipped states).
+    storm::dft::storage::DFTStatePool statePool;
+
+    // A mapping of not yet explored states from the id to the pending state information.
+    std::map<StateType, PendingState> statesNotExplored;
 
     // Holds all skipped states which were not yet expanded. More concretely it is a mapping from matrix indices
     // to the corresponding skipped states.
     // Notice that we need an ordered map here to easily iterate in increasing order over state ids.
     // TODO remove again
-    std::map<StateType, std::pair<DFTStatePointer, ExplorationHeuristicPointer>> skippedStates;
+    std::map<StateType, PendingState> skippedStates;
 
     // List of independent subtrees and the BEs contained in them.
     std::vector<std::vector<size_t>> subtreeBEs;
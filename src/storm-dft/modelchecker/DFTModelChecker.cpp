@@ -1,12 +1,19 @@
 #include "storm-dft/modelchecker/DFTModelChecker.h"
 
+#include <map>
+
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/builder/ExplicitDFTModelBuilder.h"
 #include "storm-dft/settings/modules/DftIOSettings.h"
 #include "storm-dft/utility/SymmetryFinder.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/builder/ParallelCompositionBuilder.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/exceptions/InvalidModelException.h"
+#include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
+#include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/models/ModelType.h"
 #include "storm/settings/modules/GeneralSettings.h"
@@ -453,9 +460,17 @@ std::vector<ValueType> DFTModelChecker<ValueType>::checkModel(std::shared_ptr<st
     modelCheckingTimer.start();
     std::vector<ValueType> results;
 
-    // Check each property
+    // Check time-bounded reachability properties with the same target jointly
+    std::vector<boost::optional<ValueType>> jointResults = checkTimeBoundedReachabilityJointly(model, properties);
+
+    // Check each remaining property
     storm::utility::Stopwatch singleModelCheckingTimer;
-    for (auto property : properties) {
+    for (size_t i = 0; i < properties.size(); ++i) {
+        if (jointResults[i]) {
+            results.push_back(jointResults[i].get());
+            continue;
+        }
+        auto const& property = properties[i];
         singleModelCheckingTimer.reset();
         singleModelCheckingTimer.start();
         // STORM_PRINT_AND_LOG("Model checking property " << *property << " ...\n");
@@ -479,6 +494,69 @@ std::vector<ValueType> DFTModelChecker<ValueType>::checkModel(std::shared_ptr<st
     return results;
 }
 
+template<typename ValueType>
+std::vector<boost::optional<ValueType>> DFTModelChecker<ValueType>::checkTimeBoundedReachabilityJointly(
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, property_vector const& properties) {
+    std::vector<boost::optional<ValueType>> results(properties.size());
+    if constexpr (storm::NumberTraits<ValueType>::SupportsExponential) {
+        storm::Environment env;
+        // The transient analysis starts in the initial state and only supports absolute precision.
+        if (!model->isOfType(storm::models::ModelType::Ctmc) || model->getInitialStates().getNumberOfSetBits() != 1 ||
+            env.solver().timeBounded().getRelativeTerminationCriterion()) {
+            return results;
+        }
+
+        // Group properties of the form P=? [F<=t phi] by their target formula phi
+        std::map<std::string, std::vector<size_t>> propertiesByTarget;
+        for (size_t i = 0; i < properties.size(); ++i) {
+            if (!properties[i]->isProbabilityOperatorFormula() || properties[i]->asProbabilityOperatorFormula().hasBound() ||
+                !properties[i]->asProbabilityOperatorFormula().getSubformula().isBoundedUntilFormula()) {
+                continue;
+            }
+            auto const& pathFormula = properties[i]->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+            if (!pathFormula.isMultiDimensional() && pathFormula.getTimeBoundReference().isTimeBound() && !pathFormula.hasLowerBound() &&
+                pathFormula.hasUpperBound() && pathFormula.getLeftSubformula().isTrueFormula()) {
+                propertiesByTarget[pathFormula.getRightSubformula().toString()].push_back(i);
+            }
+        }
+
+        auto const& ctmc = *model->template as<storm::models::sparse::Ctmc<ValueType>>();
+        storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> checker(ctmc);
+        for (auto const& [target, propertyIndices] : propertiesByTarget) {
+            if (propertyIndices.size() < 2) {
+                continue;
+            }
+            std::vector<ValueType> timeBounds;
+            for (size_t i : propertyIndices) {
+                timeBounds.push_back(
+                    properties[i]->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula().template getNonStrictUpperBound<ValueType>());
+            }
+            auto const& pathFormula = properties[propertyIndices.front()]->asProbabilityOperatorFormula().getSubformula().asBoundedUntilFormula();
+            std::unique_ptr<storm::modelchecker::CheckResult> targetResult = checker.check(env, pathFormula.getRightSubformula());
+            storm::storage::BitVector const& targetStates = targetResult->asExplicitQualitativeCheckResult<ValueType>().getTruthValuesVector();
+            if (targetStates.empty()) {
+                for (size_t i : propertyIndices) {
+                    results[i] = storm::utility::zero<ValueType>();
+                }
+                continue;
+            }
+
+            // The target states are made absorbing, so the probability of reaching them within a time bound is the probability mass on them
+            std::vector<std::vector<ValueType>> transientProbabilities = storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(
+                env, ctmc.getTransitionMatrix(), ctmc.getInitialStates(), storm::storage::BitVector(ctmc.getNumberOfStates(), true), targetStates,
+                ctmc.getExitRateVector(), timeBounds);
+            for (size_t j = 0; j < propertyIndices.size(); ++j) {
+                ValueType probability = storm::utility::zero<ValueType>();
+                for (auto state : targetStates) {
+                    probability += transientProbabilities[j][state];
+                }
+                results[propertyIndices[j]] = probability;
+            }
+        }
+    }
+    return results;
+}
+
 template<typename ValueType>
 bool DFTModelChecker<ValueType>::isApproximationSufficient(ValueType, ValueType, double, bool) {
     STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "Approximation works only for double.");
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <boost/optional.hpp>
+
 #include "storm/api/storm.h"
 #include "storm/logic/Formula.h"
 #include "storm/modelchecker/results/CheckResult.h"
@@ -152,6 +154,18 @@ class DFTModelChecker {
      */
     std::vector<ValueType> checkModel(std::shared_ptr<storm::models::sparse::Model<ValueType>>& model, property_vector const& properties);
 
+    /*!
+     * Check the time-bounded reachability properties P=? [F<=t phi] of the given CTMC which only differ in their time bound t jointly.
+     * All time bounds of such properties are handled by a single transient analysis.
+     *
+     * @param model      Model to check
+     * @param properties Properties to check for
+     *
+     * @return For each property, the result for the initial state or none if the property was not checked jointly
+     */
+    std::vector<boost::optional<ValueType>> checkTimeBoundedReachabilityJointly(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                                                                property_vector const& properties);
+
     /*!
      * Checks if the computed approximation is sufficient, i.e.
      * upperBound - lowerBound <= approximationError * mean(lowerBound, upperBound).
@@ -1,5 +1,7 @@
 #include "DftModularizationChecker.h"
 
+#include <algorithm>
+#include <numeric>
 #include <sstream>
 
 #include "storm-dft/adapters/SFTBDDPropertyFormulaAdapter.h"
@@ -12,13 +14,14 @@
 #include "storm-parsers/api/properties.h"
 #include "storm/api/properties.h"
 #include "storm/exceptions/InvalidModelException.h"
+#include "storm/utility/ThreadPool.h"
 
 namespace storm::dft {
 namespace modelchecker {
 
 template<typename ValueType>
-DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft)
-    : dft{dft}, modelchecker(true), sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()} {
+DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, uint64_t numberOfThreads)
+    : dft{dft}, modelchecker(true), sylvanBddManager{std::make_shared<storm::dft::storage::SylvanBddManager>()}, numberOfThreads{numberOfThreads} {
     // Initialize modules
     storm::dft::utility::DftModularizer<ValueType> modularizer;
     auto topModule = modularizer.computeModules(*dft);
@@ -69,10 +72,41 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
     // Map from module representatives to their sample points
     std::map<size_t, std::map<ValueType, ValueType>> samplePoints;
 
+    // Create properties
+    std::stringstream propertyStream{};
+    for (auto const timebound : timepoints) {
+        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
+    }
+    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
+
     // First analyse all dynamic modules
-    for (auto const& mod : dynamicModules) {
-        STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
-        auto result = analyseDynamicModule(mod, timepoints);
+    std::vector<typename DFTModelChecker<ValueType>::dft_results> moduleResults(dynamicModules.size());
+    if (numberOfThreads == 1 || dynamicModules.size() <= 1) {
+        for (size_t i{0}; i < dynamicModules.size(); ++i) {
+            moduleResults[i] = analyseDynamicModule(dynamicModules[i], props, modelchecker);
+        }
+    } else {
+        // Modules share no elements and can thus be analysed independently. Each worker uses its own model checker.
+        auto threadPool = storm::utility::ThreadPool::getShared(numberOfThreads);
+        std::vector<DFTModelChecker<ValueType>> checkers;
+        for (uint64_t worker{0}; worker < threadPool->getNumberOfWorkers(); ++worker) {
+            checkers.emplace_back(false);
+        }
+        // Start with the largest modules such that the analysis of a large module does not delay the end of the computation.
+        std::vector<size_t> moduleSizes;
+        for (auto const& mod : dynamicModules) {
+            moduleSizes.push_back(mod.getAllElements().size());
+        }
+        std::vector<size_t> order(dynamicModules.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&moduleSizes](size_t lhs, size_t rhs) { return moduleSizes[lhs] > moduleSizes[rhs]; });
+        threadPool->parallelFor(order.size(), [&](uint64_t task, uint64_t worker) {
+            moduleResults[order[task]] = analyseDynamicModule(dynamicModules[order[task]], props, checkers[worker]);
+        });
+    }
+
+    for (size_t moduleIndex{0}; moduleIndex < dynamicModules.size(); ++moduleIndex) {
+        auto const& result = moduleResults[moduleIndex];
         // Remember probabilities for module
         std::map<ValueType, ValueType> activeSamples{};
         for (size_t i{0}; i < timepoints.size(); ++i) {
@@ -80,7 +114,7 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
             auto const timebound{timepoints[i]};
             activeSamples[timebound] = probability;
         }
-        samplePoints.insert({mod.getRepresentative(), activeSamples});
+        samplePoints.insert({dynamicModules[moduleIndex].getRepresentative(), activeSamples});
     }
 
     // Gather all elements contained in dynamic modules
@@ -123,20 +157,13 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
 
 template<typename ValueType>
 typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results DftModularizationChecker<ValueType>::analyseDynamicModule(
-    storm::dft::storage::DftIndependentModule const& module, std::vector<ValueType> const& timepoints) {
+    storm::dft::storage::DftIndependentModule const& module, FormulaVector const& properties, DFTModelChecker<ValueType>& checker) const {
     STORM_LOG_ASSERT(!module.isStatic() && !module.isFullyStatic(), "Module should be dynamic.");
     STORM_LOG_ASSERT(!dft->getElement(module.getRepresentative())->isBasicElement(), "Dynamic module should not be a single BE.");
+    STORM_LOG_DEBUG("Analyse dynamic module " << module.toString(*dft));
 
     auto subDft = module.getSubtree(*dft);
-
-    // Create properties
-    std::stringstream propertyStream{};
-    for (auto const timebound : timepoints) {
-        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
-    }
-    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
-
-    return modelchecker.check(subDft, props, false, false, {});
+    return checker.check(subDft, properties, false, false, {});
 }
 
 // Explicitly instantiate the class.
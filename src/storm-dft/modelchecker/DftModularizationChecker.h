@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -28,8 +29,10 @@ class DftModularizationChecker {
     /*!
      * Initializes and computes all modules.
      * @param dft DFT.
+     * @param numberOfThreads Number of threads used to analyse independent dynamic modules concurrently (0 means auto-detect).
+     *                        Each thread holds the state space of at most one module at a time.
      */
-    DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft);
+    DftModularizationChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, uint64_t numberOfThreads = 1);
 
     /*!
      * Calculate the properties specified by the formulas.
@@ -75,10 +78,12 @@ class DftModularizationChecker {
     /*!
      * Analyse the given dynamic module.
      * @param module Module.
-     * @param timepoints Time points for which the failure probability of element should be computed.
+     * @param properties Properties for the failure probability of the module at the relevant time points.
+     * @param checker Model checker used for the analysis.
      */
     typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(storm::dft::storage::DftIndependentModule const &module,
-                                                                                                    std::vector<ValueType> const &timepoints);
+                                                                                                    FormulaVector const &properties,
+                                                                                                    DFTModelChecker<ValueType> &checker) const;
 
     // DFT.
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft;
@@ -89,6 +94,8 @@ class DftModularizationChecker {
     std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager;
     // Independent modules with their top element
     std::vector<storm::dft::storage::DftIndependentModule> dynamicModules;
+    // Number of threads used to analyse the dynamic modules
+    uint64_t numberOfThreads;
 };
 
 }  // namespace modelchecker
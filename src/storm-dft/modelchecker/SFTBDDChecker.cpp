@@ -1,10 +1,12 @@
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
 #include "storm-dft/transformations/SftToBddTransformator.h"
 #include "storm/adapters/eigen.h"
+#include "storm/utility/ThreadPool.h"
 
 namespace storm::dft {
 namespace modelchecker {
@@ -114,127 +116,151 @@ ValueType recursiveBirnbaumFactor(uint32_t const variableIndex, Bdd const bdd, s
     return birnbaumFactor;
 }
 
+/**
+ * A bdd in a flat representation suited for repeated numerical evaluation.
+ * The inner nodes are stored in topological order, i.e., the children of a node precede the node itself.
+ * Thus, the root is the last node.
+ * The indices 0 and 1 refer to the terminals zero and one,
+ * the inner nodes start at index 2.
+ *
+ * \note
+ * Evaluating a flat bdd does not require any calls to Sylvan
+ * and can therefore be done concurrently from arbitrary threads.
+ */
+struct FlatBdd {
+    // The variable of each inner node
+    std::vector<uint32_t> variables{};
+    // The then and else successors of each inner node
+    std::vector<size_t> thenNodes{};
+    std::vector<size_t> elseNodes{};
+    // The root node
+    size_t root{0};
+
+    /**
+     * \return
+     * The number of nodes including the terminals
+     */
+    size_t size() const {
+        return variables.size() + 2;
+    }
+};
+
+size_t recursiveFlatten(Bdd const bdd, FlatBdd &flatBdd, std::unordered_map<uint64_t, size_t> &bddToNode) {
+    if (bdd.isZero()) {
+        return 0;
+    } else if (bdd.isOne()) {
+        return 1;
+    }
+
+    auto const it{bddToNode.find(bdd.GetBDD())};
+    if (it != bddToNode.end()) {
+        return it->second;
+    }
+
+    auto const thenNode{recursiveFlatten(bdd.Then(), flatBdd, bddToNode)};
+    auto const elseNode{recursiveFlatten(bdd.Else(), flatBdd, bddToNode)};
+
+    flatBdd.variables.push_back(bdd.TopVar());
+    flatBdd.thenNodes.push_back(thenNode);
+    flatBdd.elseNodes.push_back(elseNode);
+    auto const node{flatBdd.size() - 1};
+    bddToNode[bdd.GetBDD()] = node;
+    return node;
+}
+
 /**
  * \returns
- * The probabilities that the bdd is true
+ * The flat representation of the given bdd
+ */
+FlatBdd flattenBdd(Bdd const bdd) {
+    FlatBdd flatBdd{};
+    std::unordered_map<uint64_t, size_t> bddToNode{};
+    flatBdd.root = recursiveFlatten(bdd, flatBdd, bddToNode);
+    return flatBdd;
+}
+
+/**
+ * \returns
+ * The probabilities that the nodes of the bdd are true
  * given the probabilities that the variables are true.
+ * The result is indexed by the nodes of the flat bdd.
  *
  * \param chunksize
  * The width of the Eigen Arrays
  *
- * \param bdd
+ * \param flatBdd
  * The bdd for which to calculate the probabilities
  *
  * \param indexToProbabilities
  * A reference to a mapping
  * that must map every variable in the bdd to probabilities
- *
- * \param bddToProbabilities
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
- *
- * \note
- * Great care was made that all pointers
- * are valid elements in bddToProbabilities.
- *
  */
-Eigen::ArrayXd const *recursiveProbabilities(size_t const chunksize, Bdd const bdd, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
-                                             std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities) {
-    auto const bddId{bdd.GetBDD()};
-    auto const it{bddToProbabilities.find(bddId)};
-    if (it != bddToProbabilities.end() && it->second.first) {
-        return &it->second.second;
+std::vector<Eigen::ArrayXd> flatProbabilities(size_t const chunksize, FlatBdd const &flatBdd, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities) {
+    std::vector<Eigen::ArrayXd> nodeProbabilities(flatBdd.size());
+    nodeProbabilities[0] = Eigen::ArrayXd::Constant(chunksize, 0);
+    nodeProbabilities[1] = Eigen::ArrayXd::Constant(chunksize, 1);
+
+    // Children are evaluated before their parents
+    for (size_t node{2}; node < flatBdd.size(); ++node) {
+        auto const &currentProbabilities{indexToProbabilities.at(flatBdd.variables[node - 2])};
+        auto const &thenProbabilities{nodeProbabilities[flatBdd.thenNodes[node - 2]]};
+        auto const &elseProbabilities{nodeProbabilities[flatBdd.elseNodes[node - 2]]};
+
+        // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
+        nodeProbabilities[node] = currentProbabilities * thenProbabilities + (1 - currentProbabilities) * elseProbabilities;
     }
-
-    auto &bddToProbabilitiesElement{bddToProbabilities[bddId]};
-    if (bdd.isOne()) {
-        bddToProbabilitiesElement.first = true;
-        bddToProbabilitiesElement.second = Eigen::ArrayXd::Constant(chunksize, 1);
-        return &bddToProbabilitiesElement.second;
-    } else if (bdd.isZero()) {
-        bddToProbabilitiesElement.first = true;
-        bddToProbabilitiesElement.second = Eigen::ArrayXd::Constant(chunksize, 0);
-        return &bddToProbabilitiesElement.second;
-    }
-
-    auto const &thenProbabilities{*recursiveProbabilities(chunksize, bdd.Then(), indexToProbabilities, bddToProbabilities)};
-    auto const &elseProbabilities{*recursiveProbabilities(chunksize, bdd.Else(), indexToProbabilities, bddToProbabilities)};
-
-    auto const currentVar{bdd.TopVar()};
-    auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
-
-    // P(Ite(x, f1, f2)) = P(x) * P(f1) + P(!x) * P(f2)
-    bddToProbabilitiesElement.first = true;
-    bddToProbabilitiesElement.second = currentProbabilities * thenProbabilities + (1 - currentProbabilities) * elseProbabilities;
-    return &bddToProbabilitiesElement.second;
+    return nodeProbabilities;
 }
 
 /**
  * \returns
- * The birnbaum importance factors of the given variable
+ * The birnbaum importance factors of all variables occurring in the bdd.
+ * Variables not contained in the result have a birnbaum factor of 0.
+ *
+ * All factors are computed in a single top-down traversal.
+ * The birnbaum factor of a variable x is the sum over all nodes n with variable x of
+ * the probability to reach n from the root times P(Then(n)) - P(Else(n)).
  *
  * \param chunksize
  * The width of the Eigen Arrays
  *
- * \param bdd
+ * \param flatBdd
  * The bdd for which to calculate the factors
  *
- * \param variableIndex
- * The index of the variable the birnbaum factors should be calculated
- *
- * \param indexToProbability
+ * \param indexToProbabilities
  * A reference to a mapping
- * that must map every variable in the bdd to a probabilities
- *
- * \param bddToProbability
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
+ * that must map every variable in the bdd to probabilities
  *
- * \param bddToBirnbaumFactor
- * A cache for common sub Bdds.
- * Must be empty or from an earlier call with a bdd that is an
- * ancestor of the current one.
+ * \param nodeProbabilities
+ * The probabilities of the nodes as computed by flatProbabilities
  */
-Eigen::ArrayXd const *recursiveBirnbaumFactors(size_t const chunksize, uint32_t const variableIndex, Bdd const bdd,
-                                               std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
-                                               std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities,
-                                               std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToBirnbaumFactors) {
-    auto const bddId{bdd.GetBDD()};
-    auto const it{bddToBirnbaumFactors.find(bddId)};
-    if (it != bddToBirnbaumFactors.end() && it->second.first) {
-        return &it->second.second;
-    }
-
-    auto &bddToBirnbaumFactorsElement{bddToBirnbaumFactors[bddId]};
-    if (bdd.isTerminal() || bdd.TopVar() > variableIndex) {
-        // return vector 0;
-        bddToBirnbaumFactorsElement.second = Eigen::ArrayXd::Constant(chunksize, 0);
-        return &bddToBirnbaumFactorsElement.second;
-    }
-
-    auto const currentVar{bdd.TopVar()};
-    auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
-
-    if (currentVar == variableIndex) {
-        auto const &thenProbabilities{*recursiveProbabilities(chunksize, bdd.Then(), indexToProbabilities, bddToProbabilities)};
-        auto const &elseProbabilities{*recursiveProbabilities(chunksize, bdd.Else(), indexToProbabilities, bddToProbabilities)};
-
-        bddToBirnbaumFactorsElement.first = true;
-        bddToBirnbaumFactorsElement.second = thenProbabilities - elseProbabilities;
-        return &bddToBirnbaumFactorsElement.second;
+std::map<uint32_t, Eigen::ArrayXd> flatBirnbaumFactors(size_t const chunksize, FlatBdd const &flatBdd,
+                                                       std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
+                                                       std::vector<Eigen::ArrayXd> const &nodeProbabilities) {
+    std::map<uint32_t, Eigen::ArrayXd> birnbaumFactors{};
+    std::vector<Eigen::ArrayXd> reachProbabilities(flatBdd.size(), Eigen::ArrayXd::Zero(chunksize));
+    reachProbabilities[flatBdd.root] = Eigen::ArrayXd::Constant(chunksize, 1);
+
+    // Parents are processed before their children
+    for (size_t node{flatBdd.size()}; node-- > 2;) {
+        auto const currentVar{flatBdd.variables[node - 2]};
+        auto const thenNode{flatBdd.thenNodes[node - 2]};
+        auto const elseNode{flatBdd.elseNodes[node - 2]};
+        auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
+        auto const &reachProbability{reachProbabilities[node]};
+
+        reachProbabilities[thenNode] += reachProbability * currentProbabilities;
+        reachProbabilities[elseNode] += reachProbability * (1 - currentProbabilities);
+
+        Eigen::ArrayXd contribution{reachProbability * (nodeProbabilities[thenNode] - nodeProbabilities[elseNode])};
+        auto const it{birnbaumFactors.find(currentVar)};
+        if (it == birnbaumFactors.end()) {
+            birnbaumFactors.emplace(currentVar, std::move(contribution));
+        } else {
+            it->second += contribution;
+        }
     }
-
-    // currentVar < variableIndex
-    auto const &thenBirnbaumFactors{
-        *recursiveBirnbaumFactors(chunksize, variableIndex, bdd.Then(), indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-    auto const &elseBirnbaumFactors{
-        *recursiveBirnbaumFactors(chunksize, variableIndex, bdd.Else(), indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
-    bddToBirnbaumFactorsElement.first = true;
-    bddToBirnbaumFactorsElement.second = currentProbabilities * thenBirnbaumFactors + (1 - currentProbabilities) * elseBirnbaumFactors;
-    return &bddToBirnbaumFactorsElement.second;
+    return birnbaumFactors;
 }
 }  // namespace
 
@@ -291,29 +317,33 @@ void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timep
     if (chunksize == 0) {
         chunksize = timepoints.size();
     }
+    if (timepoints.empty()) {
+        return;
+    }
 
-    // caches
     auto const basicElements{getDFT()->getBasicElements()};
-    std::map<uint32_t, Eigen::ArrayXd> indexToProbabilities{};
-
-    // The current timepoints we calculate with
-    Eigen::ArrayXd timepointsArray{chunksize};
+    std::vector<uint32_t> basicElementIndices{};
+    basicElementIndices.reserve(basicElements.size());
+    for (auto const &be : basicElements) {
+        basicElementIndices.push_back(getSylvanBddManager()->getIndex(be->name()));
+    }
 
-    for (size_t currentIndex{0}; currentIndex < timepoints.size(); currentIndex += chunksize) {
-        auto const sizeLeft{timepoints.size() - currentIndex};
-        if (sizeLeft < chunksize) {
-            chunksize = sizeLeft;
-            timepointsArray = Eigen::ArrayXd{chunksize};
-        }
+    auto const numberOfChunks{(timepoints.size() + chunksize - 1) / chunksize};
+    auto calculateChunk{[&](uint64_t const chunk, uint64_t const) {
+        auto const currentIndex{chunk * chunksize};
+        auto const currentChunksize{std::min(chunksize, timepoints.size() - currentIndex)};
 
-        // Update current timepoints
-        for (size_t i{currentIndex}; i < currentIndex + chunksize; ++i) {
-            timepointsArray(i - currentIndex) = timepoints[i];
+        // The current timepoints we calculate with
+        Eigen::ArrayXd timepointsArray{currentChunksize};
+        for (size_t i{0}; i < currentChunksize; ++i) {
+            timepointsArray(i) = timepoints[currentIndex + i];
         }
 
-        // Update the probabilities of the basic elements
-        for (auto const &be : basicElements) {
-            auto const beIndex{getSylvanBddManager()->getIndex(be->name())};
+        // The probabilities of the basic elements
+        std::map<uint32_t, Eigen::ArrayXd> indexToProbabilities{};
+        for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
+            auto const &be{basicElements[basicElementIndex]};
+            auto const beIndex{basicElementIndices[basicElementIndex]};
             // Vectorize known BETypes
             // fallback to getUnreliability() otherwise
             if (be->beType() == storm::dft::storage::elements::BEType::EXPONENTIAL) {
@@ -324,14 +354,23 @@ void SFTBDDChecker::chunkCalculationTemplate(std::vector<ValueType> const &timep
                 indexToProbabilities[beIndex] = 1 - (-failureRate * timepointsArray).exp();
             } else {
                 auto probabilities{timepointsArray};
-                for (size_t i{0}; i < chunksize; ++i) {
+                for (size_t i{0}; i < currentChunksize; ++i) {
                     probabilities(i) = be->getUnreliability(timepointsArray(i));
                 }
                 indexToProbabilities[beIndex] = probabilities;
             }
         }
 
-        func(chunksize, timepointsArray, indexToProbabilities);
+        func(currentIndex, currentChunksize, indexToProbabilities);
+    }};
+
+    // Chunks are independent of each other and can be calculated concurrently
+    if (numberOfThreads != 1 && numberOfChunks > 1) {
+        storm::utility::ThreadPool::getShared(numberOfThreads)->parallelFor(numberOfChunks, calculateChunk);
+    } else {
+        for (size_t chunk{0}; chunk < numberOfChunks; ++chunk) {
+            calculateChunk(chunk, 0);
+        }
     }
 }
 
@@ -348,23 +387,16 @@ ValueType SFTBDDChecker::getProbabilityAtTimebound(Bdd bdd, ValueType timebound)
 }
 
 std::vector<ValueType> SFTBDDChecker::getProbabilitiesAtTimepoints(Bdd bdd, std::vector<ValueType> const &timepoints, size_t chunksize) const {
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::vector<ValueType> resultProbabilities{};
-    resultProbabilities.reserve(timepoints.size());
-
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
+    auto const flatBdd{flattenBdd(bdd)};
+    std::vector<ValueType> resultProbabilities(timepoints.size());
 
-        // Great care was made so that the pointer returned is always valid
-        // and points to an element in bddToProbabilities
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentIndex, auto const currentChunksize, auto const &indexToProbabilities) {
+        auto const nodeProbabilities{flatProbabilities(currentChunksize, flatBdd, indexToProbabilities)};
+        auto const &probabilitiesArray{nodeProbabilities[flatBdd.root]};
 
         // Update result Probabilities
         for (size_t i{0}; i < currentChunksize; ++i) {
-            resultProbabilities.push_back(probabilitiesArray(i));
+            resultProbabilities[currentIndex + i] = probabilitiesArray(i);
         }
     });
 
@@ -392,25 +424,27 @@ ValueType SFTBDDChecker::getImportanceMeasureAtTimebound(std::string const &beNa
 
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueType timebound, FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
-
-    std::vector<ValueType> resultVector{};
-    resultVector.reserve(getDFT()->getBasicElements().size());
+    auto const flatBdd{flattenBdd(getTopLevelElementBdd())};
+    auto const basicElements{getDFT()->getBasicElements()};
 
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
+    std::map<uint32_t, Eigen::ArrayXd> indexToProbabilities{};
+    for (auto const &be : basicElements) {
         auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
+        indexToProbabilities[currentIndex] = Eigen::ArrayXd::Constant(1, be->getUnreliability(timebound));
     }
-    std::map<uint64_t, ValueType> bddToProbability{};
 
-    auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
+    // All birnbaum factors are obtained from a single traversal
+    auto const nodeProbabilities{flatProbabilities(1, flatBdd, indexToProbabilities)};
+    auto const birnbaumFactors{flatBirnbaumFactors(1, flatBdd, indexToProbabilities, nodeProbabilities)};
+    auto const probability{nodeProbabilities[flatBdd.root](0)};
 
-    for (auto const &be : getDFT()->getBasicElements()) {
+    std::vector<ValueType> resultVector{};
+    resultVector.reserve(basicElements.size());
+    for (auto const &be : basicElements) {
         auto const index{getSylvanBddManager()->getIndex(be->name())};
-        std::map<uint64_t, ValueType> bddToBirnbaumFactor{};
-        auto const birnbaumFactor{recursiveBirnbaumFactor(index, bdd, indexToProbability, bddToProbability, bddToBirnbaumFactor)};
-        auto const &beProbability{indexToProbability[index]};
+        auto const it{birnbaumFactors.find(index)};
+        ValueType const birnbaumFactor{it != birnbaumFactors.end() ? it->second(0) : 0};
+        ValueType const beProbability{indexToProbabilities.at(index)(0)};
         resultVector.push_back(func(beProbability, probability, birnbaumFactor));
     }
     return resultVector;
@@ -419,33 +453,23 @@ std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueT
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::string const &beName, std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
-    std::vector<ValueType> resultVector{};
-    resultVector.reserve(timepoints.size());
-
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd caches
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
-        for (auto &i : bddToBirnbaumFactors) {
-            i.second.first = false;
-        }
+    auto const flatBdd{flattenBdd(getTopLevelElementBdd())};
+    auto const index{getSylvanBddManager()->getIndex(beName)};
+    std::vector<ValueType> resultVector(timepoints.size());
 
-        // Great care was made so that the pointer returned is always valid
-        auto const index{getSylvanBddManager()->getIndex(beName)};
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
-        auto const &birnbaumFactorsArray{
-            *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
+    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentIndex, auto const currentChunksize, auto const &indexToProbabilities) {
+        auto const nodeProbabilities{flatProbabilities(currentChunksize, flatBdd, indexToProbabilities)};
+        auto const birnbaumFactors{flatBirnbaumFactors(currentChunksize, flatBdd, indexToProbabilities, nodeProbabilities)};
 
+        auto const &probabilitiesArray{nodeProbabilities[flatBdd.root]};
+        auto const it{birnbaumFactors.find(index)};
+        Eigen::ArrayXd const birnbaumFactorsArray{it != birnbaumFactors.end() ? it->second : Eigen::ArrayXd{Eigen::ArrayXd::Zero(currentChunksize)}};
         auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
-        auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
+        Eigen::ArrayXd const importanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
 
         // Update result Probabilities
         for (size_t i{0}; i < currentChunksize; ++i) {
-            resultVector.push_back(ImportanceMeasureArray(i));
+            resultVector[currentIndex + i] = importanceMeasureArray(i);
         }
     });
 
@@ -455,45 +479,32 @@ std::vector<ValueType> SFTBDDChecker::getImportanceMeasuresAtTimepoints(std::str
 template<typename FuncType>
 std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTimepoints(std::vector<ValueType> const &timepoints, size_t chunksize,
                                                                                         FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
+    auto const flatBdd{flattenBdd(getTopLevelElementBdd())};
     auto const basicElements{getDFT()->getBasicElements()};
-
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
-    std::vector<std::vector<ValueType>> resultVector{};
-    resultVector.resize(getDFT()->getBasicElements().size());
-    for (auto &i : resultVector) {
-        i.reserve(timepoints.size());
+    std::vector<uint32_t> basicElementIndices{};
+    basicElementIndices.reserve(basicElements.size());
+    for (auto const &be : basicElements) {
+        basicElementIndices.push_back(getSylvanBddManager()->getIndex(be->name()));
     }
 
-    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentChunksize, auto const &timepointsArray, auto const &indexToProbabilities) {
-        // Invalidate bdd cache
-        for (auto &i : bddToProbabilities) {
-            i.second.first = false;
-        }
+    std::vector<std::vector<ValueType>> resultVector(basicElements.size(), std::vector<ValueType>(timepoints.size()));
 
-        auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+    chunkCalculationTemplate(timepoints, chunksize, [&](auto const currentIndex, auto const currentChunksize, auto const &indexToProbabilities) {
+        // All birnbaum factors of the chunk are obtained from a single traversal
+        auto const nodeProbabilities{flatProbabilities(currentChunksize, flatBdd, indexToProbabilities)};
+        auto const birnbaumFactors{flatBirnbaumFactors(currentChunksize, flatBdd, indexToProbabilities, nodeProbabilities)};
+        auto const &probabilitiesArray{nodeProbabilities[flatBdd.root]};
 
         for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
-            auto const &be{basicElements[basicElementIndex]};
-            // Invalidate bdd cache
-            for (auto &i : bddToBirnbaumFactors) {
-                i.second.first = false;
-            }
-
-            // Great care was made so that the pointer returned is always
-            // valid and points to an element in bddToProbabilities
-            auto const index{getSylvanBddManager()->getIndex(be->name())};
-            auto const &birnbaumFactorsArray{
-                *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
-
+            auto const index{basicElementIndices[basicElementIndex]};
+            auto const it{birnbaumFactors.find(index)};
+            Eigen::ArrayXd const birnbaumFactorsArray{it != birnbaumFactors.end() ? it->second : Eigen::ArrayXd{Eigen::ArrayXd::Zero(currentChunksize)}};
             auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
-
-            auto const ImportanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
+            Eigen::ArrayXd const importanceMeasureArray{func(beProbabilitiesArray, probabilitiesArray, birnbaumFactorsArray)};
 
             // Update result Probabilities
             for (size_t i{0}; i < currentChunksize; ++i) {
-                resultVector[basicElementIndex].push_back(ImportanceMeasureArray(i));
+                resultVector[basicElementIndex][currentIndex + i] = importanceMeasureArray(i);
             }
         }
     });
@@ -46,6 +46,17 @@ class SFTBDDChecker {
      */
     std::shared_ptr<storm::dft::transformations::SftToBddTransformator<ValueType>> getTransformator() const;
 
+    /**
+     * Sets the number of threads used for the numerical evaluation of the Bdd.
+     * The timepoints are split into chunks which are evaluated concurrently.
+     *
+     * \param threads
+     * The number of threads. A value of 0 uses all available cores.
+     */
+    void setNumberOfThreads(uint64_t threads) {
+        numberOfThreads = threads;
+    }
+
     /**
      * Exports the Bdd that represents the top level event to a file
      * in the dot format.
@@ -406,6 +417,9 @@ class SFTBDDChecker {
 
     std::shared_ptr<storm::dft::transformations::SftToBddTransformator<ValueType>> transformator;
 #endif
+
+    // The number of threads used for evaluating chunks of timepoints
+    uint64_t numberOfThreads{1};
 };
 
 }  // namespace modelchecker
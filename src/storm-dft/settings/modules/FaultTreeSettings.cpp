@@ -18,6 +18,8 @@ const std::string FaultTreeSettings::moduleName = "dft";
 const std::string FaultTreeSettings::noSymmetryReductionOptionName = "nosymmetryreduction";
 const std::string FaultTreeSettings::noSymmetryReductionOptionShortName = "nosymred";
 const std::string FaultTreeSettings::modularisationOptionName = "modularisation";
+const std::string FaultTreeSettings::modularisationThreadsOptionName = "modularisation-threads";
+const std::string FaultTreeSettings::bddThreadsOptionName = "bdd-threads";
 const std::string FaultTreeSettings::disableDCOptionName = "disabledc";
 const std::string FaultTreeSettings::allowDCRelevantOptionName = "allowdcrelevant";
 const std::string FaultTreeSettings::relevantEventsOptionName = "relevantevents";
@@ -42,6 +44,20 @@ FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
                         .build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, modularisationOptionName, false, "Use modularisation (not applicable for expected time).").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, modularisationThreadsOptionName, false,
+                                                   "Sets the number of threads used to analyse dynamic modules in BDD-based modularisation.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, bddThreadsOptionName, false,
+                                                   "Sets the number of threads used to evaluate chunks of timepoints on the BDD of a static fault tree.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, disableDCOptionName, false, "Disable Don't Care propagation.").build());
     this->addOption(
         storm::settings::OptionBuilder(moduleName, firstDependencyOptionName, false, "Avoid non-determinism by always taking the first possible dependency.")
@@ -116,6 +132,14 @@ bool FaultTreeSettings::useModularisation() const {
     return this->getOption(modularisationOptionName).getHasOptionBeenSet();
 }
 
+uint64_t FaultTreeSettings::getModularisationThreads() const {
+    return this->getOption(modularisationThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+uint64_t FaultTreeSettings::getBddThreads() const {
+    return this->getOption(bddThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool FaultTreeSettings::isDisableDC() const {
     return this->getOption(disableDCOptionName).getHasOptionBeenSet();
 }
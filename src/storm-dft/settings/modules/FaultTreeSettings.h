@@ -32,6 +32,20 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
      */
     bool useModularisation() const;
 
+    /*!
+     * Retrieves the number of threads used to analyse independent dynamic modules.
+     *
+     * @return The number of threads (0 means auto-detect).
+     */
+    uint64_t getModularisationThreads() const;
+
+    /*!
+     * Retrieves the number of threads used to evaluate chunks of timepoints on the BDD.
+     *
+     * @return The number of threads (0 means auto-detect).
+     */
+    uint64_t getBddThreads() const;
+
     /*!
      * Retrieves whether the option to disable Dont Care propagation is set.
      *
@@ -179,6 +193,8 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
     static const std::string noSymmetryReductionOptionName;
     static const std::string noSymmetryReductionOptionShortName;
     static const std::string modularisationOptionName;
+    static const std::string modularisationThreadsOptionName;
+    static const std::string bddThreadsOptionName;
     static const std::string disableDCOptionName;
     static const std::string allowDCRelevantOptionName;
     static const std::string relevantEventsOptionName;
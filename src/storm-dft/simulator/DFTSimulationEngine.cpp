@@ -0,0 +1,191 @@
+#include "DFTSimulationEngine.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+
+#include <boost/math/distributions/normal.hpp>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/ThreadPool.h"
+#include "storm/utility/macros.h"
+
+namespace storm::dft {
+namespace simulator {
+
+template<typename ValueType>
+DFTSimulationEngine<ValueType>::DFTSimulationEngine(storm::dft::storage::DFT<ValueType> const& dft,
+                                                    storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo, Options const& options)
+    : dft(dft), stateGenerationInfo(stateGenerationInfo), options(options) {
+    STORM_LOG_THROW(options.batchSize > 0, storm::exceptions::InvalidArgumentException, "The batch size must be positive.");
+    STORM_LOG_THROW(options.confidence > 0 && options.confidence < 1, storm::exceptions::InvalidArgumentException,
+                    "The confidence level must be in (0,1) but is " << options.confidence << ".");
+}
+
+template<typename ValueType>
+SimulationEstimate DFTSimulationEngine<ValueType>::estimateUnreliability(double timebound, uint64_t numberOfTraces) const {
+    return simulate(numberOfTraces, [timebound](DFTTraceSimulator<ValueType>& simulator, BatchResult& batchResult) {
+        ++batchResult.simulatedTraces;
+        if (simulator.simulateCompleteTrace(timebound) == SimulationTraceResult::SUCCESSFUL) {
+            batchResult.sum += 1;
+            batchResult.sumSquares += 1;
+        }
+    });
+}
+
+template<typename ValueType>
+SimulationEstimate DFTSimulationEngine<ValueType>::estimateUnreliability(double timebound, uint64_t numberOfTraces,
+                                                                         ImportanceFunction<ValueType> const& importanceFunction,
+                                                                         std::vector<double> const& thresholds,
+                                                                         std::vector<uint64_t> const& splittingFactors) const {
+    STORM_LOG_THROW(thresholds.size() == splittingFactors.size(), storm::exceptions::InvalidArgumentException,
+                    "Number of thresholds (" << thresholds.size() << ") and splitting factors (" << splittingFactors.size() << ") do not coincide.");
+    STORM_LOG_THROW(std::adjacent_find(thresholds.begin(), thresholds.end(), std::greater_equal<double>()) == thresholds.end(),
+                    storm::exceptions::InvalidArgumentException, "Thresholds must be strictly increasing.");
+    STORM_LOG_THROW(std::find(splittingFactors.begin(), splittingFactors.end(), static_cast<uint64_t>(0)) == splittingFactors.end(),
+                    storm::exceptions::InvalidArgumentException, "Splitting factors must be positive.");
+
+    // A system failure in level i represents the product of the splitting factors of all thresholds up to i
+    std::vector<double> levelWeights(thresholds.size() + 1, 1.0);
+    for (uint64_t level = 1; level < levelWeights.size(); ++level) {
+        levelWeights[level] = levelWeights[level - 1] / splittingFactors[level - 1];
+    }
+
+    return simulate(numberOfTraces, [&](DFTTraceSimulator<ValueType>& simulator, BatchResult& batchResult) {
+        double result = simulateRestartTrace(simulator, batchResult, timebound, importanceFunction, thresholds, splittingFactors, levelWeights);
+        batchResult.sum += result;
+        batchResult.sumSquares += result * result;
+    });
+}
+
+template<typename ValueType>
+double DFTSimulationEngine<ValueType>::simulateRestartTrace(DFTTraceSimulator<ValueType>& simulator, BatchResult& batchResult, double timebound,
+                                                            ImportanceFunction<ValueType> const& importanceFunction, std::vector<double> const& thresholds,
+                                                            std::vector<uint64_t> const& splittingFactors, std::vector<double> const& levelWeights) const {
+    using DFTStatePointer = std::shared_ptr<storm::dft::storage::DFTState<ValueType>>;
+
+    // A trace which still needs to be simulated
+    struct Retrial {
+        DFTStatePointer state;
+        double time;
+        // Level of the threshold at which the retrial was created. The retrial is discarded if it falls below this level.
+        uint64_t creationLevel;
+        // Level of the trace for which retrials were already created.
+        uint64_t level;
+    };
+
+    auto getLevel = [&importanceFunction, &thresholds](DFTStatePointer const& state) -> uint64_t {
+        return std::upper_bound(thresholds.begin(), thresholds.end(), importanceFunction.getImportance(state)) - thresholds.begin();
+    };
+
+    double result = 0;
+    simulator.resetToInitial();
+    std::vector<Retrial> retrials;
+    retrials.push_back({simulator.getCurrentState(), 0, 0, 0});
+
+    while (!retrials.empty()) {
+        Retrial trace = std::move(retrials.back());
+        retrials.pop_back();
+        ++batchResult.simulatedTraces;
+        simulator.resetToState(trace.state);
+        simulator.setTime(trace.time);
+        uint64_t level = trace.level;
+        uint64_t stateLevel = getLevel(trace.state);
+
+        while (true) {
+            // Create retrials for all thresholds which were crossed upwards
+            while (level < stateLevel) {
+                ++level;
+                for (uint64_t i = 1; i < splittingFactors[level - 1]; ++i) {
+                    retrials.push_back({simulator.getCurrentState(), simulator.getCurrentTime(), level, level});
+                }
+            }
+
+            if (simulator.getCurrentState()->hasFailed(dft.getTopLevelIndex())) {
+                result += levelWeights[level];
+                break;
+            }
+
+            if (simulator.simulateNextStep(timebound) == SimulationTraceResult::UNSUCCESSFUL) {
+                break;
+            }
+            stateLevel = getLevel(simulator.getCurrentState());
+            if (stateLevel < trace.creationLevel) {
+                // Retrial left the level it was created for
+                break;
+            }
+            level = std::min(level, stateLevel);
+        }
+    }
+    return result;
+}
+
+template<typename ValueType>
+SimulationEstimate DFTSimulationEngine<ValueType>::simulate(uint64_t numberOfTraces,
+                                                            std::function<void(DFTTraceSimulator<ValueType>&, BatchResult&)> const& simulateTrace) const {
+    STORM_LOG_THROW(numberOfTraces > 0, storm::exceptions::InvalidArgumentException, "At least one trace must be simulated.");
+    uint64_t const numberOfBatches = (numberOfTraces + options.batchSize - 1) / options.batchSize;
+    std::vector<BatchResult> batchResults(numberOfBatches);
+
+    std::shared_ptr<storm::utility::ThreadPool> threadPool;
+    uint64_t numberOfWorkers = 1;
+    if (options.numberOfThreads != 1 && numberOfBatches > 1) {
+        threadPool = storm::utility::ThreadPool::getShared(options.numberOfThreads);
+        numberOfWorkers = threadPool->getNumberOfWorkers();
+    }
+
+    // Each worker uses its own simulator and random number generator
+    std::vector<boost::mt19937> generators(numberOfWorkers);
+    std::vector<std::unique_ptr<DFTTraceSimulator<ValueType>>> simulators;
+    for (uint64_t worker = 0; worker < numberOfWorkers; ++worker) {
+        simulators.push_back(std::make_unique<DFTTraceSimulator<ValueType>>(dft, stateGenerationInfo, generators[worker]));
+    }
+
+    auto simulateBatch = [&](uint64_t batch, uint64_t worker) {
+        // The random number stream only depends on the seed and the batch
+        std::seed_seq seedSequence{static_cast<uint32_t>(options.seed), static_cast<uint32_t>(options.seed >> 32), static_cast<uint32_t>(batch),
+                                   static_cast<uint32_t>(batch >> 32)};
+        generators[worker].seed(seedSequence);
+        uint64_t const end = std::min(numberOfTraces, (batch + 1) * options.batchSize);
+        for (uint64_t trace = batch * options.batchSize; trace < end; ++trace) {
+            simulateTrace(*simulators[worker], batchResults[batch]);
+        }
+    };
+    if (threadPool) {
+        STORM_LOG_INFO("Simulating " << numberOfTraces << " traces in " << numberOfBatches << " batches with " << numberOfWorkers << " threads.");
+        threadPool->parallelFor(numberOfBatches, simulateBatch);
+    } else {
+        for (uint64_t batch = 0; batch < numberOfBatches; ++batch) {
+            simulateBatch(batch, 0);
+        }
+    }
+
+    // Aggregate results in a fixed order to obtain reproducible results
+    SimulationEstimate result;
+    double sum = 0;
+    double sumSquares = 0;
+    for (auto const& batchResult : batchResults) {
+        sum += batchResult.sum;
+        sumSquares += batchResult.sumSquares;
+        result.numberOfSimulatedTraces += batchResult.simulatedTraces;
+    }
+    double const n = static_cast<double>(numberOfTraces);
+    result.numberOfTraces = numberOfTraces;
+    result.estimate = sum / n;
+    double variance = numberOfTraces > 1 ? std::max(0.0, (sumSquares - n * result.estimate * result.estimate) / (n - 1)) : 0.0;
+    result.standardError = std::sqrt(variance / n);
+    double const z = boost::math::quantile(boost::math::normal_distribution<double>(), 0.5 + options.confidence / 2);
+    result.lowerBound = std::max(0.0, result.estimate - z * result.standardError);
+    result.upperBound = std::min(1.0, result.estimate + z * result.standardError);
+    STORM_LOG_DEBUG("Estimated unreliability " << result.estimate << " with " << options.confidence << " confidence interval [" << result.lowerBound << ", "
+                                               << result.upperBound << "] from " << result.numberOfSimulatedTraces << " simulated traces.");
+    return result;
+}
+
+template class DFTSimulationEngine<double>;
+template class DFTSimulationEngine<storm::RationalFunction>;
+
+}  // namespace simulator
+}  // namespace storm::dft
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "storm-dft/simulator/DFTTraceSimulator.h"
+#include "storm-dft/simulator/ImportanceFunction.h"
+#include "storm-dft/storage/DFT.h"
+
+namespace storm::dft {
+namespace simulator {
+
+/*!
+ * Result of a statistical estimation via simulation.
+ */
+struct SimulationEstimate {
+    // Estimated value.
+    double estimate = 0;
+    // Standard error of the estimate.
+    double standardError = 0;
+    // Lower bound of the confidence interval.
+    double lowerBound = 0;
+    // Upper bound of the confidence interval.
+    double upperBound = 0;
+    // Number of independent (root) traces.
+    uint64_t numberOfTraces = 0;
+    // Total number of simulated traces including the traces created by splitting.
+    uint64_t numberOfSimulatedTraces = 0;
+};
+
+/*!
+ * Engine for estimating the unreliability of a DFT via Monte Carlo simulation.
+ * The traces are simulated concurrently. The traces are grouped into batches and each batch uses its own random number stream which only depends
+ * on the seed and the index of the batch. The results are therefore reproducible and independent of the number of threads.
+ *
+ * For rare events, importance splitting (RESTART) can be used. The state space is partitioned into levels via thresholds on an importance function.
+ * Whenever a trace crosses a threshold upwards, additional retrials are started from the crossing state. Retrials are discarded as soon as they fall
+ * below the threshold at which they were created. A system failure in level i is weighted by the inverse of the product of the splitting factors of all
+ * thresholds up to i.
+ */
+template<typename ValueType>
+class DFTSimulationEngine {
+   public:
+    struct Options {
+        // Number of threads (0 means 'auto-detect').
+        uint64_t numberOfThreads = 1;
+        // Seed from which the random number streams are derived.
+        uint64_t seed = 5;
+        // Number of traces which are simulated with the same random number stream.
+        uint64_t batchSize = 1000;
+        // Confidence level of the computed confidence interval.
+        double confidence = 0.95;
+    };
+
+    /*!
+     * Constructor.
+     *
+     * @param dft DFT.
+     * @param stateGenerationInfo Info for state generation.
+     * @param options Options.
+     */
+    DFTSimulationEngine(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo,
+                        Options const& options);
+
+    /*!
+     * Estimate the probability that the DFT fails within the given time bound by standard Monte Carlo simulation.
+     *
+     * @param timebound Time bound.
+     * @param numberOfTraces Number of simulated traces.
+     * @return Estimated unreliability.
+     */
+    SimulationEstimate estimateUnreliability(double timebound, uint64_t numberOfTraces) const;
+
+    /*!
+     * Estimate the probability that the DFT fails within the given time bound by simulation with importance splitting (RESTART).
+     *
+     * @param timebound Time bound.
+     * @param numberOfTraces Number of independent root traces.
+     * @param importanceFunction Importance function. It must be safe to call it concurrently.
+     * @param thresholds Thresholds on the importance separating the levels. Must be strictly increasing.
+     * @param splittingFactors Splitting factor for each threshold, i.e., the number of traces continuing after an upwards crossing of the threshold.
+     * @return Estimated unreliability.
+     */
+    SimulationEstimate estimateUnreliability(double timebound, uint64_t numberOfTraces, ImportanceFunction<ValueType> const& importanceFunction,
+                                             std::vector<double> const& thresholds, std::vector<uint64_t> const& splittingFactors) const;
+
+   private:
+    /*!
+     * Statistics of a batch of traces.
+     */
+    struct BatchResult {
+        // Sum of the trace results.
+        double sum = 0;
+        // Sum of the squared trace results.
+        double sumSquares = 0;
+        // Number of simulated traces including retrials.
+        uint64_t simulatedTraces = 0;
+    };
+
+    /*!
+     * Simulate all traces in batches and aggregate the results.
+     *
+     * @param numberOfTraces Number of root traces.
+     * @param simulateTrace Simulates a single root trace with the given simulator and adds its result to the batch result.
+     * @return Estimate.
+     */
+    SimulationEstimate simulate(uint64_t numberOfTraces, std::function<void(DFTTraceSimulator<ValueType>&, BatchResult&)> const& simulateTrace) const;
+
+    /*!
+     * Simulate a root trace with importance splitting.
+     *
+     * @return Weighted number of system failures.
+     */
+    double simulateRestartTrace(DFTTraceSimulator<ValueType>& simulator, BatchResult& batchResult, double timebound,
+                                ImportanceFunction<ValueType> const& importanceFunction, std::vector<double> const& thresholds,
+                                std::vector<uint64_t> const& splittingFactors, std::vector<double> const& levelWeights) const;
+
+    // The DFT.
+    storm::dft::storage::DFT<ValueType> const& dft;
+
+    // General information for the state generation.
+    storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo;
+
+    // Options.
+    Options options;
+};
+
+}  // namespace simulator
+}  // namespace storm::dft
@@ -0,0 +1,60 @@
+#include "storm-dft/storage/DFTStatePool.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm::dft {
+namespace storage {
+
+DFTStatePool::DFTStatePool(uint64_t stateSize) : stateSize(stateSize), slotSize(std::max<uint64_t>((stateSize + 63) / 64, 1)) {
+    // Intentionally left empty.
+}
+
+uint64_t DFTStatePool::add(storm::storage::BitVector const& status) {
+    STORM_LOG_ASSERT(status.size() == stateSize, "State size " << status.size() << " does not match expected size " << stateSize << ".");
+    uint64_t slot;
+    if (freeSlots.empty()) {
+        slot = arena.size() / slotSize;
+        arena.resize(arena.size() + slotSize, 0);
+    } else {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    }
+
+    uint64_t* words = arena.data() + slot * slotSize;
+    for (uint64_t word = 0; word < slotSize; ++word) {
+        uint64_t bitIndex = word * 64;
+        words[word] = bitIndex < stateSize ? status.getAsInt(bitIndex, std::min<uint64_t>(64, stateSize - bitIndex)) : 0;
+    }
+    return slot;
+}
+
+storm::storage::BitVector DFTStatePool::get(uint64_t slot) const {
+    STORM_LOG_ASSERT((slot + 1) * slotSize <= arena.size(), "Slot " << slot << " is out of range.");
+    storm::storage::BitVector status(stateSize);
+    uint64_t const* words = arena.data() + slot * slotSize;
+    for (uint64_t word = 0; word < slotSize; ++word) {
+        uint64_t bitIndex = word * 64;
+        if (bitIndex < stateSize) {
+            status.setFromInt(bitIndex, std::min<uint64_t>(64, stateSize - bitIndex), words[word]);
+        }
+    }
+    return status;
+}
+
+void DFTStatePool::release(uint64_t slot) {
+    STORM_LOG_ASSERT((slot + 1) * slotSize <= arena.size(), "Slot " << slot << " is out of range.");
+    freeSlots.push_back(slot);
+}
+
+uint64_t DFTStatePool::size() const {
+    return arena.size() / slotSize - freeSlots.size();
+}
+
+uint64_t DFTStatePool::getStateSize() const {
+    return stateSize;
+}
+
+}  // namespace storage
+}  // namespace storm::dft
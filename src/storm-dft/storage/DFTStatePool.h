@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm::dft {
+namespace storage {
+
+/*!
+ * Stores the status bit vectors of DFT states in a single contiguous arena.
+ * Each state occupies a slot of fixed size, such that no heap allocation is performed per state.
+ * Slots of released states are reused for subsequently added states.
+ */
+class DFTStatePool {
+   public:
+    /*!
+     * Create an empty pool.
+     * @param stateSize Number of bits of each state.
+     */
+    explicit DFTStatePool(uint64_t stateSize);
+
+    /*!
+     * Store the given state.
+     * @param status Status of the state. Its size must coincide with the state size of the pool.
+     * @return Slot in which the state is stored.
+     */
+    uint64_t add(storm::storage::BitVector const& status);
+
+    /*!
+     * Retrieve the state stored in the given slot.
+     * @param slot Slot.
+     * @return Status of the state.
+     */
+    storm::storage::BitVector get(uint64_t slot) const;
+
+    /*!
+     * Release the given slot. The slot can be reused for states added afterwards.
+     * @param slot Slot.
+     */
+    void release(uint64_t slot);
+
+    /*!
+     * Get the number of states currently stored.
+     * @return Number of stored states.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Get the number of bits of each state.
+     * @return State size.
+     */
+    uint64_t getStateSize() const;
+
+   private:
+    // Number of bits per state.
+    uint64_t stateSize;
+    // Number of 64-bit words per state.
+    uint64_t slotSize;
+    // The packed states.
+    std::vector<uint64_t> arena;
+    // Slots which were released and can be reused.
+    std::vector<uint64_t> freeSlots;
+};
+
+}  // namespace storage
+}  // namespace storm::dft
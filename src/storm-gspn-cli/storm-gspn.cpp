@@ -25,6 +25,8 @@
 #include <boost/algorithm/string.hpp>
 
 #include "storm/exceptions/FileIoException.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 
 #include "storm-conv/settings/modules/JaniExportSettings.h"
 #include "storm-gspn/settings/modules/GSPNExportSettings.h"
@@ -52,6 +54,25 @@ void initializeSettings(std::string const& name, std::string const& executableNa
     storm::settings::addModule<storm::settings::modules::ResourceSettings>();
 }
 
+/*!
+ * Builds the Markov automaton of the GSPN explicitly and checks the given properties on it.
+ */
+void analyzeExplicitModel(storm::gspn::GSPN const& gspn, std::vector<storm::jani::Property> const& properties) {
+    auto model = storm::api::buildExplicitGspnModel(gspn, storm::api::extractFormulasFromProperties(properties));
+    model->printModelInformationToStream(std::cout);
+
+    for (auto const& property : properties) {
+        std::cout << "\nModel checking property \"" << property.getName() << "\": " << *property.getRawFormula() << " ...\n";
+        auto result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(property.getRawFormula(), true));
+        if (result) {
+            result->filter(storm::modelchecker::ExplicitQualitativeCheckResult<double>(model->getInitialStates()));
+            std::cout << "Result (for initial states): " << *result << '\n';
+        } else {
+            std::cout << "Result: Not available.\n";
+        }
+    }
+}
+
 void processOptions() {
     auto gspnSettings = storm::settings::getModule<storm::settings::modules::GSPNSettings>();
 
@@ -96,10 +117,9 @@ void processOptions() {
 
     storm::api::handleGSPNExportSettings(*gspn, [&](storm::builder::JaniGSPNBuilder const&) { return properties; });
 
-    //        // construct ma
-    //        auto builder = storm::builder::ExplicitGspnModelBuilder<>();
-    //        auto ma = builder.translateGspn(gspn, formula);
-    //
+    if (gspnSettings.isBuildExplicitSet()) {
+        analyzeExplicitModel(*gspn, properties);
+    }
 
     delete gspn;
 }
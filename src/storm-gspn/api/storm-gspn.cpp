@@ -1,12 +1,16 @@
 #include "storm-gspn/api/storm-gspn.h"
 
 #include <boost/algorithm/string.hpp>
+#include <set>
+#include <sstream>
 #include "storm-conv/api/storm-conv.h"
 #include "storm-conv/settings/modules/JaniExportSettings.h"
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
 #include "storm-gspn/settings/modules/GSPNExportSettings.h"
 #include "storm-parsers/parser/ExpressionParser.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/io/file.h"
+#include "storm/logic/AtomicExpressionFormula.h"
 #include "storm/settings/SettingsManager.h"
 
 namespace storm {
@@ -17,6 +21,27 @@ storm::jani::Model* buildJani(storm::gspn::GSPN const& gspn) {
     return builder.build();
 }
 
+std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> buildExplicitGspnModel(
+    storm::gspn::GSPN const& gspn, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas,
+    std::map<std::string, storm::expressions::Expression> const& labels) {
+    storm::builder::ExplicitGspnModelBuilder<double> builder(gspn);
+    for (auto const& [label, expression] : labels) {
+        builder.addLabel(label, expression);
+    }
+    // Atomic expressions are checked via the label that is named like the expression.
+    std::set<std::string> expressionLabels;
+    for (auto const& formula : formulas) {
+        for (auto const& atomicExpressionFormula : formula->getAtomicExpressionFormulas()) {
+            std::stringstream stream;
+            stream << atomicExpressionFormula->getExpression();
+            if (labels.count(stream.str()) == 0 && expressionLabels.insert(stream.str()).second) {
+                builder.addLabel(stream.str(), atomicExpressionFormula->getExpression());
+            }
+        }
+    }
+    return builder.build();
+}
+
 void handleGSPNExportSettings(storm::gspn::GSPN const& gspn,
                               std::function<std::vector<storm::jani::Property>(storm::builder::JaniGSPNBuilder const&)> const& janiProperyGetter) {
     storm::settings::modules::GSPNExportSettings const& exportSettings = storm::settings::getModule<storm::settings::modules::GSPNExportSettings>();
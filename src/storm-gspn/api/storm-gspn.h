@@ -1,9 +1,12 @@
 #pragma once
 
+#include <map>
 #include <unordered_map>
 
 #include "storm-gspn/builder/JaniGSPNBuilder.h"
 #include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/storage/jani/Model.h"
 
 namespace storm {
@@ -14,6 +17,15 @@ namespace api {
  */
 storm::jani::Model* buildJani(storm::gspn::GSPN const& gspn);
 
+/**
+ *    Builds the Markov automaton of the GSPN by explicitly exploring its markings, i.e., without translating it to JANI.
+ *    Each atomic expression occurring in the given formulas becomes a label, such that the formulas can be checked on the result.
+ *    The additional labels map label names to expressions over the places of the GSPN.
+ */
+std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> buildExplicitGspnModel(
+    storm::gspn::GSPN const& gspn, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas = {},
+    std::map<std::string, storm::expressions::Expression> const& labels = {});
+
 void handleGSPNExportSettings(
     storm::gspn::GSPN const& gspn, std::function<std::vector<storm::jani::Property>(storm::builder::JaniGSPNBuilder const&)> const& janiProperyGetter =
                                        [](storm::builder::JaniGSPNBuilder const&) { return std::vector<storm::jani::Property>(); });
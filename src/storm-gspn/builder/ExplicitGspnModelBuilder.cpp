@@ -1,332 +1,286 @@
-// #include "storm/builder/ExplicitGspnModelBuilder.h"
-//
-// #include "storm/models/sparse/StandardRewardModel.h"
-//
-// #include "storm/utility/macros.h"
-// #include "storm/exceptions/NotImplementedException.h"
-// #include "storm/storage/expressions/ExpressionManager.h"
-// #include "storm-parsers/parser/FormulaParser.h"
-// #include "storm/storage/expressions/ExpressionEvaluator.h"
-//
-//  namespace storm {
-//     namespace builder {
-//
-//         template<typename ValueType>
-//         storm::models::sparse::MarkovAutomaton<ValueType> ExplicitGspnModelBuilder<ValueType>::translateGspn(storm::gspn::GSPN const& gspn, std::string
-//         const& formula) {
-//             // set the given gspn and compute the limits of the net
-//             this->gspn = gspn;
-//             computeCapacities(gspn);
-//
-//             // markings maps markings to their corresponding rowgroups (indices)
-//             markings = storm::storage::BitVectorHashMap<uint_fast64_t>(numberOfTotalBits, 100);
-//             builder = storm::storage::SparseMatrixBuilder<double>(0, 0, 0, false, true);
-//
-//             // add initial marking to todo list
-//             auto bitvector = gspn.getInitialMarking(numberOfBits, numberOfTotalBits)->getBitVector();
-//             findOrAddBitvectorToMarkings(*bitvector);
-//             currentRowIndex = 0;
-//
-//             // vector marking markovian states (vector contains an 1 if the state is markovian)
-//             storm::storage::BitVector markovianStates(0);
-//
-//             // vector containing the exit rates for the markovian states
-//             std::vector<ValueType> exitRates;
-//
-//
-//             while (!todo.empty()) {
-//                 // take next element from the todo list
-//                 auto currentBitvector = todo.front();
-//                 todo.pop_front();
-//                 auto currentMarking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, *currentBitvector);
-//
-//                 // increment list of states by one
-//                 markovianStates.resize(markovianStates.size() + 1, 0);
-//
-//                 // create new row group for the current marking
-//                 builder.newRowGroup(markings.getValue(*currentBitvector));
-//
-//                 std::cout << "work on: " << *currentBitvector << '\n';
-//
-//                 auto enabledImmediateTransitions = getEnabledImmediateTransition(currentMarking);
-//                 if (!enabledImmediateTransitions.empty()) {
-//                     markovianStates.set(currentRowIndex, 0);
-//                     exitRates.push_back(0);
-//
-//                     auto partitions = partitonEnabledImmediateTransitions(currentMarking, enabledImmediateTransitions);
-//                     addRowForPartitions(partitions, currentMarking);
-//                 } else {
-//
-//                     auto enabledTimedTransitions = getEnabledTimedTransition(currentMarking);
-//                     if (!enabledTimedTransitions.empty()) {
-//                         markovianStates.set(currentRowIndex, 1);
-//
-//                         auto accRate = getAccumulatedRate(enabledTimedTransitions);
-//                         std::cout << "\t\tacc. rate: " << accRate << '\n';
-//                         exitRates.push_back(accRate);
-//
-//                         addRowForTimedTransitions(enabledTimedTransitions, currentMarking, accRate);
-//                     } else {
-//                         markovianStates.set(currentRowIndex, 1);
-//                     }
-//                 }
-//                 ++currentRowIndex;
-//             }
-//
-//             auto matrix = builder.build();
-//
-//             // create expression manager and add variables from the gspn
-//             auto expressionManager = std::make_shared<storm::expressions::ExpressionManager>();
-//             for (auto& place : gspn.getPlaces()) {
-//                 expressionManager->declareIntegerVariable(place.getName());
-//             }
-//
-//             // parse formula
-//             storm::parser::FormulaParser formulaParser(expressionManager);
-//             auto formulaPtr = formulaParser.parseSingleFormulaFromString(formula);
-//             auto atomicFormulas = formulaPtr->getAtomicExpressionFormulas();
-//
-//             // create empty state labeling
-//             storm::models::sparse::StateLabeling labeling(markings.size());
-//             storm::expressions::ExpressionEvaluator<double> expressionEvaluator(*expressionManager);
-//
-//             std::cout << '\n';
-//             std::cout << "build labeling:\n";
-//             for (auto& atomicFormula : atomicFormulas) {
-//                 std::cout << atomicFormula;
-//                 auto label = atomicFormula->toString();
-//                 labeling.addLabel(label);
-//
-//                 for (auto statePair : markings) {
-//                     auto marking = storm::gspn::Marking(gspn.getNumberOfPlaces(), numberOfBits, statePair.first);
-//                     for (auto& place : gspn.getPlaces()) {
-//                         auto variable = expressionManager->getVariable(place.getName());
-//                         expressionEvaluator.setIntegerValue(variable, marking.getNumberOfTokensAt(place.getID()));
-//                     }
-//                     bool hold = expressionEvaluator.asBool(atomicFormula->getExpression());
-//                     if (hold) {
-//                         labeling.addLabelToState(label, statePair.second);
-//                     }
-//                 }
-//
-//             }
-//
-//             //auto labeling = getStateLabeling();
-//
-//             return storm::models::sparse::MarkovAutomaton<double>(matrix, labeling, markovianStates, exitRates);
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>>
-//         const& partitions, storm::gspn::Marking const& currentMarking) {
-//             for (auto& partition : partitions) {
-//                 std::cout << "\tnew partition:\n";
-//                 auto accWeight = getAccumulatedWeight(partition);
-//                 std::cout << "\t\tacc. weight: " << accWeight << '\n';
-//
-//                 std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> weights;
-//                 for (auto& trans : partition) {
-//                     std::cout << "\t\ttransname: " << trans.getName() << '\n';
-//                     auto newMarking = trans.fire(currentMarking);
-//                     std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << '\n';
-//
-//                     findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                     auto it = weights.find(markings.getValue(*newMarking.getBitVector()));
-//                     double currentWeight = 0;
-//                     if (it != weights.end()) {
-//                         currentWeight = weights.at(markings.getValue(*newMarking.getBitVector()));
-//                     }
-//                     currentWeight += trans.getWeight() / accWeight;
-//                     weights[markings.getValue(*newMarking.getBitVector())] = currentWeight;
-//                 }
-//
-//                 addValuesToBuilder(weights);
-//             }
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const&
-//         enabledTimedTransitions, storm::gspn::Marking const& currentMarking, double const& accRate) {
-//             std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> rates;
-//             for (auto& trans : enabledTimedTransitions) {
-//                 std::cout << "\t\ttransname: " << trans.getName() << '\n';
-//                 auto newMarking = trans.fire(currentMarking);
-//                 std::cout << "\t\t\t target marking: " << *newMarking.getBitVector() << '\n';
-//
-//                 findOrAddBitvectorToMarkings(*newMarking.getBitVector());
-//
-//                 auto it = rates.find(markings.getValue(*newMarking.getBitVector()));
-//                 double currentWeightRate = 0;
-//                 if (it != rates.end()) {
-//                     currentWeightRate = rates.at(markings.getValue(*newMarking.getBitVector()));
-//                 }
-//                 currentWeightRate += trans.getRate() / accRate;
-//                 rates[markings.getValue(*newMarking.getBitVector())] = currentWeightRate;
-//
-//             }
-//
-//             addValuesToBuilder(rates);
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::addValuesToBuilder(std::map<uint_fast64_t , double,
-//         storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values) {
-//             for (auto& it : values) {
-//                 std::cout << "\t\tadd value \"" << it.second << "\" to " << getBitvector(it.first) << '\n';
-//                 builder.addNextValue(currentRowIndex, it.first, it.second);
-//             }
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>>
-//         ExplicitGspnModelBuilder<ValueType>::partitonEnabledImmediateTransitions(
-//                 storm::gspn::Marking const& marking,
-//                 std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions) {
-//             decltype(partitonEnabledImmediateTransitions(marking, enabledImmediateTransitions)) result;
-//
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> weightedTransitions;
-//
-//             for (auto& trans : enabledImmediateTransitions) {
-//                 if (trans.noWeightAttached()) {
-//                     decltype(weightedTransitions) singleton;
-//                     singleton.push_back(trans);
-//                     result.push_back(singleton);
-//                 } else {
-//                     weightedTransitions.push_back(trans);
-//                 }
-//             }
-//
-//             if (weightedTransitions.size() != 0) {
-//                 result.push_back(weightedTransitions);
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         double ExplicitGspnModelBuilder<ValueType>::getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const&
-//         vector) const {
-//             double result = 0;
-//
-//             for (auto &trans : vector) {
-//                 result += trans.getWeight();
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         void ExplicitGspnModelBuilder<ValueType>::computeCapacities(storm::gspn::GSPN const& gspn) {
-//             uint_fast64_t sum = 0;
-//             for (auto& place : gspn.getPlaces()) {//TODO
-//                 numberOfBits[place.getID()] = 1;
-//                 sum += numberOfBits[place.getID()];
-//             }
-//
-//             // compute next multiple of 64
-//             uint_fast64_t rem = sum % 64;
-//             numberOfTotalBits = sum + 64 - rem;
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledTimedTransition(
-//                 storm::gspn::Marking const& marking) {
-//             std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>>result;
-//
-//             uint_fast64_t highestSeenPriority = 0;
-//
-//             for (auto& trans : gspn.getTimedTransitions()) {
-//                 if (trans.isEnabled(marking)) {
-//                     if (trans.getPriority() > highestSeenPriority) {
-//                         highestSeenPriority = trans.getPriority();
-//                         result.clear();
-//                     }
-//                     result.push_back(trans);
-//                 }
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> ExplicitGspnModelBuilder<ValueType>::getEnabledImmediateTransition(
-//                 storm::gspn::Marking const& marking) {
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>result;
-//
-//             uint_fast64_t highestSeenPriority = 0;
-//
-//             for (auto& trans : gspn.getImmediateTransitions()) {
-//                 if (trans.isEnabled(marking)) {
-//                     if (trans.getPriority() > highestSeenPriority) {
-//                         highestSeenPriority = trans.getPriority();
-//                         result.clear();
-//                     }
-//                     result.push_back(trans);
-//                 }
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         double ExplicitGspnModelBuilder<ValueType>::getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector) {
-//             double result = 0;
-//             for (auto trans : vector) {
-//                 result += trans.getRate();
-//             }
-//
-//             return result;
-//         }
-//
-//         template<typename ValueType>
-//         storm::storage::BitVector ExplicitGspnModelBuilder<ValueType>::getBitvector(uint_fast64_t const& index) {
-//             for (auto it = markings.begin(); it != markings.end(); ++it) {
-//                 if (std::get<1>(*it) == index) {
-//                     return std::get<0>(*it);
-//                 }
-//             }
-//             return storm::storage::BitVector();
-//         }
-//
-//         template<typename ValueType>
-//         uint_fast64_t ExplicitGspnModelBuilder<ValueType>::findOrAddBitvectorToMarkings(storm::storage::BitVector const &bitvector) {
-//             auto index = markings.findOrAdd(bitvector, nextRowGroupIndex);
-//
-//             if (index == nextRowGroupIndex) {
-//                 // bitvector was not already in the map
-//                 ++nextRowGroupIndex;
-//                 // bitvector was also never in the todo list
-//                 todo.push_back(std::make_shared<storm::storage::BitVector>(bitvector));
-//             }
-//             return index;
-//         }
-//
-//         template<typename ValueType>
-//         storm::models::sparse::StateLabeling ExplicitGspnModelBuilder<ValueType>::getStateLabeling() const {
-//             storm::models::sparse::StateLabeling labeling(markings.size());
-//
-//             std::map<uint_fast64_t , std::string> idToName;
-//             for (auto& place : gspn.getPlaces()) {
-//                 idToName[place.getID()] = place.getName();
-//                 labeling.addLabel(place.getName());
-//             }
-//
-//             auto it = markings.begin();
-//             for ( ; it != markings.end() ; ++it) {
-//                 auto bitvector = std::get<0>(*it);
-//                 storm::gspn::Marking marking(gspn.getNumberOfPlaces(), numberOfBits, bitvector);
-//                 for (auto i = 0; i < marking.getNumberOfPlaces(); i++) {
-//                     if (marking.getNumberOfTokensAt(i) > 0) {
-//                         std::cout << i << '\n';
-//                         labeling.addLabelToState(idToName.at(i), i);
-//                     }
-//                 }
-//             }
-//
-//             return labeling;
-//         }
-//
-//         template class ExplicitGspnModelBuilder<double>;
-//     }
-// }
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
+
+#include <algorithm>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidModelException.h"
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+template<typename ValueType>
+ExplicitGspnModelBuilder<ValueType>::ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, uint64_t reservedBitsForUnboundedPlaces)
+    : gspn(gspn), markingToIndex(64, 1), currentRow(0) {
+    STORM_LOG_THROW(reservedBitsForUnboundedPlaces > 0 && reservedBitsForUnboundedPlaces <= 64, storm::exceptions::InvalidArgumentException,
+                    "The number of bits for unbounded places must be between 1 and 64.");
+
+    // Compute the bit layout of the markings
+    uint64_t totalBits = 0;
+    for (auto const& place : gspn.getPlaces()) {
+        STORM_LOG_ASSERT(place.getID() == placeOffsets.size(), "Place ids are expected to be consecutive.");
+        uint64_t bits = reservedBitsForUnboundedPlaces;
+        if (place.hasRestrictedCapacity()) {
+            bits = 1;
+            while (bits < 64 && (1ull << bits) <= place.getCapacity()) {
+                ++bits;
+            }
+        }
+        placeOffsets.push_back(totalBits);
+        placeBits.push_back(bits);
+        maximalTokens.push_back(place.hasRestrictedCapacity() ? place.getCapacity() : (bits == 64 ? ~0ull : (1ull << bits) - 1));
+        totalBits += bits;
+        STORM_LOG_THROW(place.getNumberOfInitialTokens() <= maximalTokens.back(), storm::exceptions::InvalidModelException,
+                        "The initial number of tokens of place '" << place.getName() << "' exceeds its capacity.");
+    }
+    // Round up to the next multiple of 64 as required by the hash map
+    bitsPerMarking = std::max<uint64_t>(64, ((totalBits + 63) / 64) * 64);
+
+    // Compile the transitions
+    for (auto const& transition : gspn.getImmediateTransitions()) {
+        immediateTransitions.push_back(compileTransition(transition, storm::utility::convertNumber<ValueType>(transition.getWeight())));
+    }
+    for (auto const& transition : gspn.getTimedTransitions()) {
+        auto compiledTransition = compileTransition(transition, storm::utility::convertNumber<ValueType>(transition.getRate()));
+        compiledTransition.numberOfServers = transition.hasKServerSemantics() ? transition.getNumberOfServers() : 0;
+        STORM_LOG_THROW(transition.hasKServerSemantics() || !compiledTransition.inputArcs.empty(), storm::exceptions::InvalidModelException,
+                        "Unclear semantics: Found a transition with infinite-server semantics and without input place.");
+        timedTransitions.push_back(std::move(compiledTransition));
+    }
+}
+
+template<typename ValueType>
+typename ExplicitGspnModelBuilder<ValueType>::CompiledTransition ExplicitGspnModelBuilder<ValueType>::compileTransition(
+    storm::gspn::Transition const& transition, ValueType const& value) const {
+    CompiledTransition result;
+    result.value = value;
+    for (auto const& [place, multiplicity] : transition.getInputPlaces()) {
+        result.inputArcs.emplace_back(place, multiplicity);
+        result.consumedTokens.emplace_back(place, multiplicity);
+    }
+    for (auto const& [place, multiplicity] : transition.getInhibitionPlaces()) {
+        result.inhibitionArcs.emplace_back(place, multiplicity);
+    }
+    for (auto const& [place, multiplicity] : transition.getOutputPlaces()) {
+        result.producedTokens.emplace_back(place, multiplicity);
+    }
+    // Sort the arcs by place to obtain a deterministic (and cache-friendly) order
+    std::sort(result.inputArcs.begin(), result.inputArcs.end());
+    std::sort(result.inhibitionArcs.begin(), result.inhibitionArcs.end());
+    std::sort(result.consumedTokens.begin(), result.consumedTokens.end());
+    std::sort(result.producedTokens.begin(), result.producedTokens.end());
+    return result;
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::addLabel(std::string const& label, storm::expressions::Expression const& expression) {
+    STORM_LOG_THROW(label != "init" && label != "deadlock", storm::exceptions::InvalidArgumentException, "The label '" << label << "' is reserved.");
+    labelExpressions.emplace_back(label, expression.substitute(gspn.getConstantsSubstitution()));
+}
+
+template<typename ValueType>
+uint64_t ExplicitGspnModelBuilder<ValueType>::getNumberOfBitsPerMarking() const {
+    return bitsPerMarking;
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::decodeMarking(storm::storage::BitVector const& marking, std::vector<uint64_t>& tokens) const {
+    for (uint64_t place = 0; place < placeOffsets.size(); ++place) {
+        tokens[place] = marking.getAsInt(placeOffsets[place], placeBits[place]);
+    }
+}
+
+template<typename ValueType>
+bool ExplicitGspnModelBuilder<ValueType>::isEnabled(CompiledTransition const& transition, std::vector<uint64_t> const& tokens) const {
+    for (auto const& [place, multiplicity] : transition.inputArcs) {
+        if (tokens[place] < multiplicity) {
+            return false;
+        }
+    }
+    for (auto const& [place, multiplicity] : transition.inhibitionArcs) {
+        if (tokens[place] >= multiplicity) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+uint64_t ExplicitGspnModelBuilder<ValueType>::fire(CompiledTransition const& transition, storm::storage::BitVector const& marking,
+                                                   std::vector<uint64_t> const& tokens) {
+    // Only the places connected to the transition need to be updated
+    storm::storage::BitVector successor(marking);
+    for (auto const& [place, multiplicity] : transition.consumedTokens) {
+        successor.setFromInt(placeOffsets[place], placeBits[place], tokens[place] - multiplicity);
+    }
+    for (auto const& [place, multiplicity] : transition.producedTokens) {
+        uint64_t newTokens = successor.getAsInt(placeOffsets[place], placeBits[place]);
+        STORM_LOG_THROW(maximalTokens[place] - newTokens >= multiplicity, storm::exceptions::InvalidModelException,
+                        "The number of tokens in place '" << gspn.getPlaces()[place].getName() << "' exceeds its capacity of " << maximalTokens[place]
+                                                          << " tokens.");
+        successor.setFromInt(placeOffsets[place], placeBits[place], newTokens + multiplicity);
+    }
+    return findOrAddMarking(successor);
+}
+
+template<typename ValueType>
+uint64_t ExplicitGspnModelBuilder<ValueType>::getEnablingDegree(CompiledTransition const& transition, std::vector<uint64_t> const& tokens) const {
+    // For infinite server semantics, the number of servers does not restrict the degree
+    uint64_t degree = transition.numberOfServers == 0 ? ~0ull : transition.numberOfServers;
+    for (auto const& [place, multiplicity] : transition.inputArcs) {
+        if (multiplicity > 0) {
+            degree = std::min(degree, tokens[place] / multiplicity);
+        }
+    }
+    return degree;
+}
+
+template<typename ValueType>
+uint64_t ExplicitGspnModelBuilder<ValueType>::findOrAddMarking(storm::storage::BitVector const& marking) {
+    uint64_t newIndex = markingToIndex.size();
+    uint64_t index = markingToIndex.findOrAdd(marking, newIndex);
+    if (index == newIndex) {
+        markingsToExplore.push_back(marking);
+    }
+    return index;
+}
+
+template<typename ValueType>
+void ExplicitGspnModelBuilder<ValueType>::addRow(std::vector<std::pair<uint64_t, ValueType>>& entries) {
+    std::sort(entries.begin(), entries.end(), [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+    auto entryIt = entries.begin();
+    while (entryIt != entries.end()) {
+        uint64_t column = entryIt->first;
+        ValueType value = entryIt->second;
+        for (++entryIt; entryIt != entries.end() && entryIt->first == column; ++entryIt) {
+            value += entryIt->second;
+        }
+        matrixBuilder.addNextValue(currentRow, column, value);
+    }
+    ++currentRow;
+    entries.clear();
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> ExplicitGspnModelBuilder<ValueType>::build() {
+    markingToIndex = storm::storage::BitVectorHashMap<uint64_t>(bitsPerMarking, 1000);
+    markingsToExplore.clear();
+    matrixBuilder = storm::storage::SparseMatrixBuilder<ValueType>(0, 0, 0, false, true, 0);
+    currentRow = 0;
+
+    // Add the initial marking
+    storm::storage::BitVector initialMarking(bitsPerMarking);
+    for (auto const& place : gspn.getPlaces()) {
+        initialMarking.setFromInt(placeOffsets[place.getID()], placeBits[place.getID()], place.getNumberOfInitialTokens());
+    }
+    findOrAddMarking(initialMarking);
+
+    std::vector<uint64_t> markovianStates;
+    std::vector<uint64_t> deadlockStates;
+    std::vector<uint64_t> tokens(placeOffsets.size());
+    std::vector<std::pair<uint64_t, ValueType>> entries;
+
+    // The markings are explored in the order of their indices
+    for (uint64_t currentIndex = 0; !markingsToExplore.empty(); ++currentIndex) {
+        storm::storage::BitVector currentMarking = std::move(markingsToExplore.front());
+        markingsToExplore.pop_front();
+        decodeMarking(currentMarking, tokens);
+        matrixBuilder.newRowGroup(currentRow);
+
+        // Immediate transitions have precedence. The partitions are ordered by descending priority.
+        bool hasImmediateChoice = false;
+        uint64_t enabledPriority = 0;
+        for (auto const& partition : gspn.getPartitions()) {
+            if (hasImmediateChoice && partition.priority < enabledPriority) {
+                break;
+            }
+            ValueType totalWeight = storm::utility::zero<ValueType>();
+            for (auto const& transitionId : partition.transitions) {
+                auto const& transition = immediateTransitions[transitionId];
+                if (!storm::utility::isZero(transition.value) && isEnabled(transition, tokens)) {
+                    totalWeight += transition.value;
+                }
+            }
+            if (storm::utility::isZero(totalWeight)) {
+                continue;
+            }
+            for (auto const& transitionId : partition.transitions) {
+                auto const& transition = immediateTransitions[transitionId];
+                if (!storm::utility::isZero(transition.value) && isEnabled(transition, tokens)) {
+                    entries.emplace_back(fire(transition, currentMarking, tokens), transition.value / totalWeight);
+                }
+            }
+            addRow(entries);
+            hasImmediateChoice = true;
+            enabledPriority = partition.priority;
+        }
+        if (hasImmediateChoice) {
+            continue;
+        }
+
+        // Otherwise, the enabled timed transitions race against each other. The matrix contains rates for Markovian states.
+        markovianStates.push_back(currentIndex);
+        for (auto const& transition : timedTransitions) {
+            if (!storm::utility::isZero(transition.value) && isEnabled(transition, tokens)) {
+                ValueType rate = transition.value;
+                if (transition.numberOfServers != 1) {
+                    rate *= storm::utility::convertNumber<ValueType>(getEnablingDegree(transition, tokens));
+                }
+                entries.emplace_back(fire(transition, currentMarking, tokens), rate);
+            }
+        }
+        if (entries.empty()) {
+            // Fix the deadlock by a self-loop
+            deadlockStates.push_back(currentIndex);
+            entries.emplace_back(currentIndex, storm::utility::one<ValueType>());
+        }
+        addRow(entries);
+    }
+
+    uint64_t numberOfStates = markingToIndex.size();
+    STORM_LOG_INFO("Explored " << numberOfStates << " markings with " << bitsPerMarking << " bits per marking.");
+
+    // Build the labeling
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    labeling.addLabel("deadlock", storm::storage::BitVector(numberOfStates, deadlockStates.begin(), deadlockStates.end()));
+    if (!labelExpressions.empty()) {
+        std::vector<storm::expressions::Variable> placeVariables;
+        for (auto const& place : gspn.getPlaces()) {
+            placeVariables.push_back(gspn.getExpressionManager()->getVariable(place.getName()));
+        }
+        std::vector<storm::storage::BitVector> labelStates(labelExpressions.size(), storm::storage::BitVector(numberOfStates));
+        storm::expressions::ExpressionEvaluator<double> evaluator(*gspn.getExpressionManager());
+        for (auto const& markingAndIndex : markingToIndex) {
+            decodeMarking(markingAndIndex.first, tokens);
+            for (uint64_t place = 0; place < tokens.size(); ++place) {
+                evaluator.setIntegerValue(placeVariables[place], tokens[place]);
+            }
+            for (uint64_t label = 0; label < labelExpressions.size(); ++label) {
+                if (evaluator.asBool(labelExpressions[label].second)) {
+                    labelStates[label].set(markingAndIndex.second);
+                }
+            }
+        }
+        for (uint64_t label = 0; label < labelExpressions.size(); ++label) {
+            labeling.addLabel(labelExpressions[label].first, std::move(labelStates[label]));
+        }
+    }
+
+    storm::storage::BitVector markovianStatesVector(numberOfStates, markovianStates.begin(), markovianStates.end());
+    storm::storage::sparse::ModelComponents<ValueType> components(matrixBuilder.build(currentRow, numberOfStates, numberOfStates), std::move(labeling),
+                                                                  std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>>(),
+                                                                  true, std::move(markovianStatesVector));
+    return std::make_shared<storm::models::sparse::MarkovAutomaton<ValueType>>(std::move(components));
+}
+
+template class ExplicitGspnModelBuilder<double>;
+
+}  // namespace builder
+}  // namespace storm
@@ -1,172 +1,163 @@
-// #pragma once
-// #include <string>
-//
-// #include "storm/models/sparse/MarkovAutomaton.h"
-// #include "storm/models/sparse/StandardRewardModel.h"
-// #include "storm/storage/BitVector.h"
-// #include "storm/storage/BitVectorHashMap.h"
-// #include "storm/storage/gspn/GSPN.h"
-// #include "storm/storage/gspn/ImmediateTransition.h"
-// #include "storm/storage/gspn/TimedTransition.h"
-//
-//  namespace storm {
-//     namespace builder {
-//
-//         /*!
-//          * This class provides the facilities for building an markov automaton.
-//          */
-//         template<typename ValueType=double>
-//         class ExplicitGspnModelBuilder {
-//         public:
-//
-//             /*!
-//              * Builds an MarkovAutomaton from the given GSPN.
-//              *
-//              * @param gspn The gspn whose semantic is covered by the MarkovAutomaton
-//              * @return The resulting MarkovAutomaton
-//              */
-//             storm::models::sparse::MarkovAutomaton<ValueType> translateGspn(storm::gspn::GSPN const& gspn, std::string const& formula);
-//         private:
-//
-//             /*!
-//              * Add for each partition a new row in the probability matrix.
-//              *
-//              * @param partitions The partitioned immediate transitions.
-//              * @param currentMarking The current marking which is considered at the moment.
-//              */
-//             void addRowForPartitions(std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> const& partitions,
-//             storm::gspn::Marking const& currentMarking);
-//
-//
-//             /*!
-//              * Add row for a markovian state.
-//              *
-//              * @param enabledTimedTransitions List of enabled timed transitions.
-//              * @param currentMarking The current marking which is considered at the moment.
-//              * @param accRate The sum of all rates of the enabled timed transisitons
-//              */
-//             void addRowForTimedTransitions(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& enabledTimedTransitions,
-//             storm::gspn::Marking const& currentMarking, double const& accRate);
-//
-//             /*!
-//              * Struct for comparing unsigned integer for maps
-//              */
-//             struct cmpByIndex {
-//                 bool operator()(const uint_fast64_t &a, const uint_fast64_t &b) const {
-//                     return a < b;
-//                 }
-//             };
-//
-//             /*!
-//              * This method insert the values from a map into the matrix
-//              *
-//              * @param values The values which are inserted
-//              */
-//             void addValuesToBuilder(std::map<uint_fast64_t , double, storm::builder::ExplicitGspnModelBuilder<ValueType>::cmpByIndex> const& values);
-//
-//
-//             /*!
-//              * This method partitions all enabled immediate transitions w.r.t. a marking.
-//              * All enabled weighted immediate transitions are in one vector. Between these transitions
-//              * is chosen probabilistically by the weights.
-//              *
-//              * All other enabled non-weighted immediate transitions are in an singleton vector.
-//              * Between different vectors is chosen non-deterministically.
-//              *
-//              * @param marking The current marking which is considered.
-//              * @param enabledImmediateTransistions A vector of enabled immediate transitions.
-//              * @return The vector of vectors which is described above.
-//              */
-//             std::vector<std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>>> partitonEnabledImmediateTransitions(storm::gspn::Marking
-//             const& marking, std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& enabledImmediateTransitions);
-//
-//             /*!
-//              * Computes the accumulated weight of immediate transisions which are stored in a list.
-//              *
-//              * @param vector List of immediate transisitions.
-//              */
-//             double getAccumulatedWeight(std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> const& vector) const;
-//
-//             /*!
-//              * Compute the upper bound for the number of tokens in each place.
-//              * Also computes the number of bits which are used to store a marking.
-//              *
-//              * @param gspn The corresponding gspn.
-//              */
-//             void computeCapacities(storm::gspn::GSPN const& gspn);
-//
-//             /*!
-//              * Returns the vector of enabled timed transition with the highest priority.
-//              *
-//              *
-//              * @param marking The current marking which is considered.
-//              * @return The vector of enabled timed transitions.
-//              */
-//             std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> getEnabledTimedTransition(
-//                     storm::gspn::Marking const& marking);
-//
-//             /*!
-//              * Returns the vector of active immediate transition with the highest priority.
-//              *
-//              * @param marking The current marking which is considered.
-//              * @return The vector of enabled immediate transitions.
-//              */
-//             std::vector<std::shared_ptr<storm::gspn::ImmediateTransition<double>>> getEnabledImmediateTransition(
-//                     storm::gspn::Marking const& marking);
-//
-//             /*!
-//              * Computes the accumulated rate of a vector of timed transitions.
-//              *
-//              * @param vector The vector of timed transitions.
-//              * @return The accumulated rate.
-//              */
-//             double getAccumulatedRate(std::vector<std::shared_ptr<storm::gspn::TimedTransition<double>>> const& vector);
-//
-//             // is only needed for debugging purposes
-//             // since markings is injective, we can determine the bitvector
-//             storm::storage::BitVector getBitvector(uint_fast64_t const& index);
-//
-//             /*!
-//              * Adds the bitvector to the marking-map.
-//              * If the bitvector corresponds to a new marking the bitvector is added to the todo list.
-//              *
-//              * @return The rowGroup index for the bitvector.
-//              */
-//             uint_fast64_t findOrAddBitvectorToMarkings(storm::storage::BitVector const& bitvector);
-//
-//             /*!
-//              * Computes the state labeling and returns it.
-//              * Every state is labeled with its name.
-//              *
-//              * @return The computed state labeling.
-//              */
-//             storm::models::sparse::StateLabeling getStateLabeling() const;
-//
-//
-//             // contains the number of bits which are used the store the number of tokens at each place
-//             std::map<uint_fast64_t, uint_fast64_t> numberOfBits;
-//
-//             // contains the number of bits used to create markings
-//             uint_fast64_t numberOfTotalBits;
-//
-//             // maps bitvectors (markings w.r.t. the capacity) to their rowgroup
-//             storm::storage::BitVectorHashMap<uint_fast64_t> markings = storm::storage::BitVectorHashMap<uint_fast64_t>(64, 1);
-//
-//             // a list of markings for which the outgoing edges need to be computed
-//             std::deque<std::shared_ptr<storm::storage::BitVector>> todo;
-//
-//             //the gspn which is transformed
-//             storm::gspn::GSPN gspn;
-//
-//             // the next index for a new rowgroup
-//             uint_fast64_t nextRowGroupIndex = 0;
-//
-//             // builder object which is used to create the probability matrix
-//             storm::storage::SparseMatrixBuilder<double> builder;
-//
-//             // contains the current row index during the computation
-//             uint_fast64_t currentRowIndex;
-//         };
-//     }
-// }
-//
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storm-gspn/storage/gspn/GSPN.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * This class builds the Markov automaton of a GSPN by explicitly exploring all reachable markings.
+ * In contrast to the JaniGSPNBuilder, no intermediate JANI model is created and no expressions are evaluated during the exploration.
+ *
+ * Markings are stored as packed bit vectors in which each place occupies a fixed number of bits derived from its capacity.
+ * The input, output and inhibition arcs of all transitions are compiled into flat vectors before the exploration starts.
+ *
+ * The resulting model coincides with the model obtained from the JANI translation under the maximal progress assumption:
+ * If an immediate transition is enabled, the marking is probabilistic and has one choice for each partition of the highest enabled priority.
+ * Otherwise, the marking is Markovian and the enabled timed transitions race against each other.
+ */
+template<typename ValueType = double>
+class ExplicitGspnModelBuilder {
+   public:
+    /*!
+     * Constructor.
+     *
+     * @param gspn The GSPN whose semantics is built.
+     * @param reservedBitsForUnboundedPlaces The number of bits used to store the tokens of a place without capacity.
+     */
+    ExplicitGspnModelBuilder(storm::gspn::GSPN const& gspn, uint64_t reservedBitsForUnboundedPlaces = 32);
+
+    /*!
+     * Adds a label which is assigned to all markings satisfying the given expression.
+     * The expression may refer to the places of the GSPN by their names.
+     *
+     * @param label The name of the label.
+     * @param expression The boolean expression over the place variables.
+     */
+    void addLabel(std::string const& label, storm::expressions::Expression const& expression);
+
+    /*!
+     * Builds the Markov automaton of the GSPN.
+     * The labels 'init' and 'deadlock' are always added. Deadlock markings obtain a Markovian self-loop.
+     *
+     * @return The resulting Markov automaton.
+     */
+    std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> build();
+
+    /*!
+     * Retrieves the number of bits which are used to store a single marking.
+     *
+     * @return The number of bits per marking.
+     */
+    uint64_t getNumberOfBitsPerMarking() const;
+
+   private:
+    /*!
+     * A transition with its arcs compiled into flat vectors of (place, multiplicity) pairs.
+     */
+    struct CompiledTransition {
+        // The input arcs which must be satisfied for the transition to be enabled
+        std::vector<std::pair<uint64_t, uint64_t>> inputArcs;
+        // The inhibition arcs which must not be satisfied for the transition to be enabled
+        std::vector<std::pair<uint64_t, uint64_t>> inhibitionArcs;
+        // The tokens removed from each place when firing
+        std::vector<std::pair<uint64_t, uint64_t>> consumedTokens;
+        // The tokens added to each place when firing
+        std::vector<std::pair<uint64_t, uint64_t>> producedTokens;
+        // The weight (immediate transitions) or rate (timed transitions)
+        ValueType value;
+        // The number of servers of a timed transition, 0 means infinite server semantics
+        uint64_t numberOfServers = 1;
+    };
+
+    /*!
+     * Compiles the arcs of the given transition.
+     */
+    CompiledTransition compileTransition(storm::gspn::Transition const& transition, ValueType const& value) const;
+
+    /*!
+     * Decodes the given marking into the number of tokens per place.
+     */
+    void decodeMarking(storm::storage::BitVector const& marking, std::vector<uint64_t>& tokens) const;
+
+    /*!
+     * Checks whether the transition is enabled in the marking given by the number of tokens per place.
+     */
+    bool isEnabled(CompiledTransition const& transition, std::vector<uint64_t> const& tokens) const;
+
+    /*!
+     * Fires the transition in the given marking.
+     *
+     * @param transition The enabled transition.
+     * @param marking The current marking.
+     * @param tokens The number of tokens per place in the current marking.
+     * @return The index of the successor marking. If the successor marking is new, it is added to the markings which need to be explored.
+     */
+    uint64_t fire(CompiledTransition const& transition, storm::storage::BitVector const& marking, std::vector<uint64_t> const& tokens);
+
+    /*!
+     * Computes the enabling degree of a timed transition with (k-)infinite server semantics.
+     */
+    uint64_t getEnablingDegree(CompiledTransition const& transition, std::vector<uint64_t> const& tokens) const;
+
+    /*!
+     * Retrieves the index of the given marking. If the marking is new, it is added to the markings which need to be explored.
+     */
+    uint64_t findOrAddMarking(storm::storage::BitVector const& marking);
+
+    /*!
+     * Sorts the given (state, value) pairs, merges pairs with the same state and adds the resulting row to the matrix builder.
+     */
+    void addRow(std::vector<std::pair<uint64_t, ValueType>>& entries);
+
+    // The GSPN which is translated
+    storm::gspn::GSPN const& gspn;
+
+    // The bit offset of each place within a marking
+    std::vector<uint64_t> placeOffsets;
+
+    // The number of bits of each place within a marking
+    std::vector<uint64_t> placeBits;
+
+    // The maximal number of tokens which can be stored for each place
+    std::vector<uint64_t> maximalTokens;
+
+    // The number of bits of a marking (a multiple of 64)
+    uint64_t bitsPerMarking;
+
+    // The immediate transitions, indexed like the immediate transitions of the GSPN
+    std::vector<CompiledTransition> immediateTransitions;
+
+    // The timed transitions, indexed like the timed transitions of the GSPN
+    std::vector<CompiledTransition> timedTransitions;
+
+    // The labels which are added to the model
+    std::vector<std::pair<std::string, storm::expressions::Expression>> labelExpressions;
+
+    // Maps the markings to their indices
+    storm::storage::BitVectorHashMap<uint64_t> markingToIndex;
+
+    // The markings which still need to be explored, in the order of their indices
+    std::deque<storm::storage::BitVector> markingsToExplore;
+
+    // The builder for the transition matrix
+    storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder;
+
+    // The current row of the transition matrix
+    uint64_t currentRow;
+};
+
+}  // namespace builder
+}  // namespace storm
@@ -21,6 +21,7 @@ const std::string GSPNSettings::capacitiesFileOptionShortName = "capacities";
 const std::string GSPNSettings::capacityOptionName = "capacity";
 const std::string GSPNSettings::constantsOptionName = "constants";
 const std::string GSPNSettings::constantsOptionShortName = "const";
+const std::string GSPNSettings::buildExplicitOptionName = "buildexplicit";
 
 GSPNSettings::GSPNSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, gspnFileOptionName, false, "Parses the GSPN.")
@@ -47,6 +48,9 @@ GSPNSettings::GSPNSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, buildExplicitOptionName, false,
+                                                   "Builds the Markov automaton of the GSPN explicitly (without JANI) and checks the properties on it.")
+                        .build());
 }
 
 bool GSPNSettings::isGspnFileSet() const {
@@ -81,6 +85,10 @@ std::string GSPNSettings::getConstantDefinitionString() const {
     return this->getOption(constantsOptionName).getArgumentByName("values").getValueAsString();
 }
 
+bool GSPNSettings::isBuildExplicitSet() const {
+    return this->getOption(buildExplicitOptionName).getHasOptionBeenSet();
+}
+
 void GSPNSettings::finalize() {}
 
 bool GSPNSettings::check() const {
@@ -53,6 +53,11 @@ class GSPNSettings : public ModuleSettings {
      */
     std::string getConstantDefinitionString() const;
 
+    /*!
+     * Retrieves whether the Markov automaton of the GSPN shall be built explicitly and analysed.
+     */
+    bool isBuildExplicitSet() const;
+
     bool check() const override;
     void finalize() override;
 
@@ -66,6 +71,7 @@ class GSPNSettings : public ModuleSettings {
     static const std::string capacityOptionName;
     static const std::string constantsOptionName;
     static const std::string constantsOptionShortName;
+    static const std::string buildExplicitOptionName;
 };
 }  // namespace modules
 }  // namespace settings
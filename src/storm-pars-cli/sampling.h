@@ -48,6 +48,7 @@
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
 
 #include "storm/settings/modules/BisimulationSettings.h"
 #include "storm/settings/modules/CoreSettings.h"
@@ -72,10 +73,13 @@ struct SampleInformation {
         cartesianProducts;
     bool graphPreserving;
     bool exact;
+    // The number of threads used to check the samples concurrently (0 means 'auto-detect').
+    uint64_t numberOfThreads = 1;
 };
 
 template<template<typename, typename> class ModelCheckerType, typename ModelType, typename ValueType, typename SolveValueType = double>
-void verifyPropertiesAtSamplePoints(ModelType const& model, cli::SymbolicInput const& input, SampleInformation<ValueType> const& samples) {
+void verifyPropertiesAtSamplePoints(Environment const& env, ModelType const& model, cli::SymbolicInput const& input,
+                                    SampleInformation<ValueType> const& samples) {
     // When samples are provided, we create an instantiation model checker.
     ModelCheckerType<ModelType, SolveValueType> modelchecker(model);
 
@@ -84,8 +88,12 @@ void verifyPropertiesAtSamplePoints(ModelType const& model, cli::SymbolicInput c
 
         modelchecker.specifyFormula(storm::api::createTask<ValueType>(property.getRawFormula(), true));
         modelchecker.setInstantiationsAreGraphPreserving(samples.graphPreserving);
+        modelchecker.setNumberOfThreads(samples.numberOfThreads);
+        // Valuations are only collected and checked in batches if they are checked concurrently.
+        bool const checkBatches = (samples.numberOfThreads == 0 ? storm::utility::getNumberOfThreads() : samples.numberOfThreads) > 1;
 
         storm::utility::parametric::Valuation<ValueType> valuation;
+        std::vector<storm::utility::parametric::Valuation<ValueType>> valuations;
 
         std::vector<typename storm::utility::parametric::VariableType<ValueType>::type> parameters;
         std::vector<typename std::vector<typename storm::utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
@@ -110,14 +118,18 @@ void verifyPropertiesAtSamplePoints(ModelType const& model, cli::SymbolicInput c
                     valuation[parameters[i]] = *iterators[i];
                 }
 
-                storm::utility::Stopwatch valuationWatch(true);
-                std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(Environment(), valuation);
-                valuationWatch.stop();
+                if (checkBatches) {
+                    valuations.push_back(valuation);
+                } else {
+                    storm::utility::Stopwatch valuationWatch(true);
+                    std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(env, valuation);
+                    valuationWatch.stop();
 
-                if (result) {
-                    result->filter(storm::modelchecker::ExplicitQualitativeCheckResult<SolveValueType>(model.getInitialStates()));
+                    if (result) {
+                        result->filter(storm::modelchecker::ExplicitQualitativeCheckResult<SolveValueType>(model.getInitialStates()));
+                    }
+                    printInitialStatesResult<ValueType>(result, &valuationWatch, &valuation);
                 }
-                printInitialStatesResult<ValueType>(result, &valuationWatch, &valuation);
 
                 for (uint64_t i = 0; i < parameters.size(); ++i) {
                     ++iterators[i];
@@ -135,6 +147,19 @@ void verifyPropertiesAtSamplePoints(ModelType const& model, cli::SymbolicInput c
                     }
                 }
             }
+
+            if (checkBatches) {
+                // All valuations of the product are checked at once, which allows the model checker to check them concurrently.
+                std::vector<storm::utility::Stopwatch> valuationWatches;
+                std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = modelchecker.checkBatch(env, valuations, &valuationWatches);
+                for (uint64_t i = 0; i < valuations.size(); ++i) {
+                    if (results[i]) {
+                        results[i]->filter(storm::modelchecker::ExplicitQualitativeCheckResult<SolveValueType>(model.getInitialStates()));
+                    }
+                    printInitialStatesResult<ValueType>(results[i], &valuationWatches[i], &valuations[i]);
+                }
+                valuations.clear();
+            }
         }
 
         watch.stop();
@@ -143,17 +168,17 @@ void verifyPropertiesAtSamplePoints(ModelType const& model, cli::SymbolicInput c
 }
 
 template<typename ValueType, typename SolveValueType = double>
-void verifyPropertiesAtSamplePointsWithSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, cli::SymbolicInput const& input,
-                                                    SampleInformation<ValueType> const& samples) {
+void verifyPropertiesAtSamplePointsWithSparseEngine(Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model,
+                                                    cli::SymbolicInput const& input, SampleInformation<ValueType> const& samples) {
     if (model->isOfType(storm::models::ModelType::Dtmc)) {
         verifyPropertiesAtSamplePoints<storm::modelchecker::SparseDtmcInstantiationModelChecker, storm::models::sparse::Dtmc<ValueType>, ValueType,
-                                       SolveValueType>(*model->template as<storm::models::sparse::Dtmc<ValueType>>(), input, samples);
+                                       SolveValueType>(env, *model->template as<storm::models::sparse::Dtmc<ValueType>>(), input, samples);
     } else if (model->isOfType(storm::models::ModelType::Ctmc)) {
         verifyPropertiesAtSamplePoints<storm::modelchecker::SparseCtmcInstantiationModelChecker, storm::models::sparse::Ctmc<ValueType>, ValueType,
-                                       SolveValueType>(*model->template as<storm::models::sparse::Ctmc<ValueType>>(), input, samples);
+                                       SolveValueType>(env, *model->template as<storm::models::sparse::Ctmc<ValueType>>(), input, samples);
     } else if (model->isOfType(storm::models::ModelType::Mdp)) {
         verifyPropertiesAtSamplePoints<storm::modelchecker::SparseMdpInstantiationModelChecker, storm::models::sparse::Mdp<ValueType>, ValueType,
-                                       SolveValueType>(*model->template as<storm::models::sparse::Mdp<ValueType>>(), input, samples);
+                                       SolveValueType>(env, *model->template as<storm::models::sparse::Mdp<ValueType>>(), input, samples);
     } else {
         STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Sampling is currently only supported for DTMCs, CTMCs and MDPs.");
     }
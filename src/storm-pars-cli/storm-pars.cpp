@@ -434,6 +434,7 @@ void parameterSpacePartitioningWithSparseEngine(std::shared_ptr<storm::models::s
         graphPreserving,
         false  // preconditions not yet validated
     };
+    settings.numberOfThreads = partitionSettings.getNumberOfThreads();
     std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::checkAndRefineRegionWithSparseEngine<ValueType>(
         settings, regions.front(), refinementThreshold, optionalDepthLimit, storm::modelchecker::RegionResultHypothesis::Unknown, monThresh);
     watch.stop();
@@ -570,15 +571,17 @@ void processInput(cli::SymbolicInput&& input, storm::cli::ModelProcessingInforma
         if (!samplesAsString.empty()) {
             samples = parseSamples<ValueType>(model, samplesAsString, sampleSettings.isSamplesAreGraphPreservingSet());
             samples.exact = sampleSettings.isSampleExactSet();
+            samples.numberOfThreads = sampleSettings.getNumberOfThreads();
         }
         if (!samples.empty()) {
             STORM_LOG_TRACE("Sampling the model at given points.");
 
+            Environment env;
             if (samples.exact) {
-                verifyPropertiesAtSamplePointsWithSparseEngine<ValueType, storm::RationalNumber>(model->as<storm::models::sparse::Model<ValueType>>(), input,
-                                                                                                 samples);
+                verifyPropertiesAtSamplePointsWithSparseEngine<ValueType, storm::RationalNumber>(env, model->as<storm::models::sparse::Model<ValueType>>(),
+                                                                                                 input, samples);
             } else {
-                verifyPropertiesAtSamplePointsWithSparseEngine<ValueType, double>(model->as<storm::models::sparse::Model<ValueType>>(), input, samples);
+                verifyPropertiesAtSamplePointsWithSparseEngine<ValueType, double>(env, model->as<storm::models::sparse::Model<ValueType>>(), input, samples);
             }
         }
     } else {
@@ -37,6 +37,7 @@
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/io/file.h"
 #include "storm/models/sparse/Model.h"
+#include "storm/utility/threads.h"
 
 namespace storm {
 
@@ -325,6 +326,17 @@ std::unique_ptr<storm::modelchecker::RegionRefinementChecker<ValueType>> initial
                                                                                                     settings.monotonicitySetting, settings.monotoneParameters);
     settings.allowModelSimplification = settings.allowModelSimplification && monotonicityBackend->recommendModelSimplifications();
     auto refinementChecker = std::make_unique<storm::modelchecker::RegionRefinementChecker<ValueType>>(std::move(regionChecker));
+    uint64_t numberOfThreads = settings.numberOfThreads == 0 ? storm::utility::getNumberOfThreads() : settings.numberOfThreads;
+    if (numberOfThreads > 1) {
+        if (monotonicityBackend->requiresInteractionWithRegionModelChecker()) {
+            STORM_LOG_WARN("Regions are analyzed by a single thread because the monotonicity backend interacts with the region model checker.");
+        } else {
+            for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                refinementChecker->addRegionCheckerForConcurrentAnalysis(
+                    createRegionModelChecker<ValueType, ImpreciseType, PreciseType>(settings.engine, settings.model->getType()));
+            }
+        }
+    }
     refinementChecker->specify(env, consideredModel, settings.task, std::move(settings.regionSplittingStrategy), std::move(settings.discreteVariables),
                                std::move(monotonicityBackend), settings.allowModelSimplification, settings.graphPreserving);
     return refinementChecker;
@@ -1,5 +1,7 @@
 #include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -9,6 +11,9 @@
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/ThreadPool.h"
+#include "storm/utility/threads.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -24,7 +29,100 @@ template<typename SparseModelType, typename ConstantType>
 std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::check(
     Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
     STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
-    auto const& instantiatedModel = modelInstantiator.instantiate(valuation);
+    return checkInstantiatedModel(env, modelInstantiator.instantiate(valuation), *this->currentCheckTask);
+}
+
+template<typename SparseModelType, typename ConstantType>
+std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(
+    Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations,
+    std::vector<storm::utility::Stopwatch>* stopwatches) {
+    STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+    // Exact numbers are not safe to be used concurrently.
+    uint64_t numberOfThreads = this->getNumberOfThreads() == 0 ? storm::utility::getNumberOfThreads() : this->getNumberOfThreads();
+    if (storm::NumberTraits<ConstantType>::IsExact) {
+        numberOfThreads = 1;
+    }
+    numberOfThreads = std::min<uint64_t>(numberOfThreads, valuations.size());
+    if (numberOfThreads <= 1) {
+        // Without concurrency, we evaluate the functions exactly (as in check()) instead of using the compiled functions.
+        return SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(env, valuations, stopwatches);
+    }
+    std::vector<std::unique_ptr<CheckResult>> results(valuations.size());
+    if (stopwatches) {
+        stopwatches->assign(valuations.size(), storm::utility::Stopwatch());
+    }
+
+    if (!compiledFunctions) {
+        compiledFunctions = std::make_unique<storm::utility::CompiledRationalFunctions<ConstantType>>();
+        for (auto const& function : modelInstantiator.getOccurringFunctions()) {
+            compiledFunctions->addFunction(function);
+        }
+    }
+    uint64_t const numberOfParameters = compiledFunctions->getParameters().size();
+    uint64_t const numberOfFunctions = compiledFunctions->getNumberOfFunctions();
+
+    while (additionalModelInstantiators.size() + 1 < numberOfThreads) {
+        additionalModelInstantiators.push_back(std::make_unique<ModelInstantiatorType>(this->parametricModel));
+    }
+
+    // Each thread gets its own environment and check task so that hints are not shared.
+    std::vector<Environment> environments(numberOfThreads, env);
+    std::vector<CheckTask<storm::logic::Formula, ConstantType>> checkTasks;
+    std::vector<std::vector<ConstantType>> pointFunctionValues(numberOfThreads, std::vector<ConstantType>(numberOfFunctions));
+
+    // Valuations are processed in chunks to bound the memory required for the evaluated functions.
+    uint64_t const chunkSize = 64 * numberOfThreads;
+    std::vector<ConstantType> parameterValues;
+    std::vector<ConstantType> functionValues;
+    for (uint64_t chunkStart = 0; chunkStart < valuations.size(); chunkStart += chunkSize) {
+        uint64_t const numberOfPoints = std::min<uint64_t>(chunkSize, valuations.size() - chunkStart);
+        parameterValues.resize(numberOfParameters * numberOfPoints);
+        for (uint64_t point = 0; point < numberOfPoints; ++point) {
+            auto pointParameterValues = compiledFunctions->getParameterValues(valuations[chunkStart + point]);
+            for (uint64_t parameter = 0; parameter < numberOfParameters; ++parameter) {
+                parameterValues[parameter * numberOfPoints + point] = std::move(pointParameterValues[parameter]);
+            }
+        }
+        compiledFunctions->evaluate(parameterValues, numberOfPoints, functionValues);
+
+        auto checkPoint = [&](uint64_t point, uint64_t worker) {
+            if (stopwatches) {
+                (*stopwatches)[chunkStart + point].start();
+            }
+            auto& values = pointFunctionValues[worker];
+            for (uint64_t function = 0; function < numberOfFunctions; ++function) {
+                values[function] = functionValues[function * numberOfPoints + point];
+            }
+            auto& instantiator = worker == 0 ? modelInstantiator : *additionalModelInstantiators[worker - 1];
+            auto& checkTask = worker == 0 ? *this->currentCheckTask : checkTasks[worker - 1];
+            results[chunkStart + point] = checkInstantiatedModel(environments[worker], instantiator.instantiate(values), checkTask);
+            if (stopwatches) {
+                (*stopwatches)[chunkStart + point].stop();
+            }
+        };
+
+        uint64_t firstConcurrentPoint = 0;
+        if (checkTasks.empty()) {
+            // The first valuation is checked sequentially such that all threads can start with the hints obtained from it.
+            checkPoint(0, 0);
+            firstConcurrentPoint = 1;
+            for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+                checkTasks.push_back(*this->currentCheckTask);
+                if (this->currentCheckTask->getHint().isExplicitModelCheckerHint()) {
+                    checkTasks.back().setHint(std::make_shared<ExplicitModelCheckerHint<ConstantType>>(
+                        this->currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>()));
+                }
+            }
+        }
+        storm::utility::ThreadPool::getShared(numberOfThreads)
+            ->parallelFor(numberOfPoints - firstConcurrentPoint, [&](uint64_t task, uint64_t worker) { checkPoint(firstConcurrentPoint + task, worker); });
+    }
+    return results;
+}
+
+template<typename SparseModelType, typename ConstantType>
+std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkInstantiatedModel(
+    Environment const& env, storm::models::sparse::Dtmc<ConstantType> const& instantiatedModel, CheckTask<storm::logic::Formula, ConstantType>& checkTask) {
     if (instantiatedModel.isExact()) {
         STORM_LOG_THROW(instantiatedModel.getTransitionMatrix().isProbabilistic(storm::utility::zero<ConstantType>()),
                         storm::exceptions::InvalidArgumentException, "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
@@ -37,45 +135,46 @@ std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType
     storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>> modelChecker(instantiatedModel);
 
     // Check if there are some optimizations implemented for the specified property
-    if (this->currentCheckTask->getFormula().isInFragment(storm::logic::reachability())) {
-        return checkReachabilityProbabilityFormula(env, modelChecker);
-    } else if (this->currentCheckTask->getFormula().isInFragment(storm::logic::propositional()
-                                                                     .setRewardOperatorsAllowed(true)
-                                                                     .setReachabilityRewardFormulasAllowed(true)
-                                                                     .setOperatorAtTopLevelRequired(true)
-                                                                     .setNestedOperatorsAllowed(false))) {
-        return checkReachabilityRewardFormula(env, modelChecker);
-    } else if (this->currentCheckTask->getFormula().isInFragment(storm::logic::propositional()
-                                                                     .setProbabilityOperatorsAllowed(true)
-                                                                     .setBoundedUntilFormulasAllowed(true)
-                                                                     .setStepBoundedUntilFormulasAllowed(true)
-                                                                     .setTimeBoundedUntilFormulasAllowed(true)
-                                                                     .setOperatorAtTopLevelRequired(true)
-                                                                     .setNestedOperatorsAllowed(false))) {
-        return checkBoundedUntilFormula(env, modelChecker);
+    if (checkTask.getFormula().isInFragment(storm::logic::reachability())) {
+        return checkReachabilityProbabilityFormula(env, modelChecker, checkTask);
+    } else if (checkTask.getFormula().isInFragment(storm::logic::propositional()
+                                                       .setRewardOperatorsAllowed(true)
+                                                       .setReachabilityRewardFormulasAllowed(true)
+                                                       .setOperatorAtTopLevelRequired(true)
+                                                       .setNestedOperatorsAllowed(false))) {
+        return checkReachabilityRewardFormula(env, modelChecker, checkTask);
+    } else if (checkTask.getFormula().isInFragment(storm::logic::propositional()
+                                                       .setProbabilityOperatorsAllowed(true)
+                                                       .setBoundedUntilFormulasAllowed(true)
+                                                       .setStepBoundedUntilFormulasAllowed(true)
+                                                       .setTimeBoundedUntilFormulasAllowed(true)
+                                                       .setOperatorAtTopLevelRequired(true)
+                                                       .setNestedOperatorsAllowed(false))) {
+        return checkBoundedUntilFormula(env, modelChecker, checkTask);
     } else {
-        return modelChecker.check(env, *this->currentCheckTask);
+        return modelChecker.check(env, checkTask);
     }
 }
 
 template<typename SparseModelType, typename ConstantType>
 std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityProbabilityFormula(
-    Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker) {
-    if (!this->currentCheckTask->getHint().isExplicitModelCheckerHint()) {
-        this->currentCheckTask->setHint(std::make_shared<ExplicitModelCheckerHint<ConstantType>>());
+    Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker,
+    CheckTask<storm::logic::Formula, ConstantType>& checkTask) {
+    if (!checkTask.getHint().isExplicitModelCheckerHint()) {
+        checkTask.setHint(std::make_shared<ExplicitModelCheckerHint<ConstantType>>());
     }
-    ExplicitModelCheckerHint<ConstantType>& hint = this->currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>();
+    ExplicitModelCheckerHint<ConstantType>& hint = checkTask.getHint().template asExplicitModelCheckerHint<ConstantType>();
 
     if (this->getInstantiationsAreGraphPreserving() && !hint.hasMaybeStates()) {
         // Perform purely qualitative analysis once
         std::vector<ConstantType> qualitativeResult;
-        if (this->currentCheckTask->getFormula().asOperatorFormula().hasQuantitativeResult()) {
-            auto newCheckTask = *this->currentCheckTask;
+        if (checkTask.getFormula().asOperatorFormula().hasQuantitativeResult()) {
+            auto newCheckTask = checkTask;
             newCheckTask.setQualitative(true);
             newCheckTask.setOnlyInitialStatesRelevant(false);
             qualitativeResult = modelChecker.check(env, newCheckTask)->template asExplicitQuantitativeCheckResult<ConstantType>().getValueVector();
         } else {
-            auto newCheckTask = this->currentCheckTask->substituteFormula(this->currentCheckTask->getFormula().asOperatorFormula().getSubformula());
+            auto newCheckTask = checkTask.substituteFormula(checkTask.getFormula().asOperatorFormula().getSubformula());
             newCheckTask.setQualitative(true);
             newCheckTask.setOnlyInitialStatesRelevant(false);
             qualitativeResult =
@@ -92,16 +191,16 @@ std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType
     std::unique_ptr<CheckResult> result;
     // Check the formula and store the result as a hint for the next call.
     // For qualitative properties, we still want a quantitative result hint. Hence we perform the check on the subformula
-    if (this->currentCheckTask->getFormula().asOperatorFormula().hasQuantitativeResult()) {
-        result = modelChecker.check(env, *this->currentCheckTask);
+    if (checkTask.getFormula().asOperatorFormula().hasQuantitativeResult()) {
+        result = modelChecker.check(env, checkTask);
         hint.setResultHint(result->template asExplicitQuantitativeCheckResult<ConstantType>().getValueVector());
     } else {
-        auto newCheckTask = this->currentCheckTask->substituteFormula(this->currentCheckTask->getFormula().asOperatorFormula().getSubformula())
+        auto newCheckTask = checkTask.substituteFormula(checkTask.getFormula().asOperatorFormula().getSubformula())
                                 .setOnlyInitialStatesRelevant(false);
         std::unique_ptr<CheckResult> quantitativeResult = modelChecker.computeProbabilities(env, newCheckTask);
         result = quantitativeResult->template asExplicitQuantitativeCheckResult<ConstantType>().compareAgainstBound(
-            this->currentCheckTask->getFormula().asOperatorFormula().getComparisonType(),
-            this->currentCheckTask->getFormula().asOperatorFormula().template getThresholdAs<ConstantType>());
+            checkTask.getFormula().asOperatorFormula().getComparisonType(),
+            checkTask.getFormula().asOperatorFormula().template getThresholdAs<ConstantType>());
         hint.setResultHint(std::move(quantitativeResult->template asExplicitQuantitativeCheckResult<ConstantType>().getValueVector()));
     }
 
@@ -110,22 +209,23 @@ std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType
 
 template<typename SparseModelType, typename ConstantType>
 std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityRewardFormula(
-    Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker) {
-    if (!this->currentCheckTask->getHint().isExplicitModelCheckerHint()) {
-        this->currentCheckTask->setHint(std::make_shared<ExplicitModelCheckerHint<ConstantType>>());
+    Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker,
+    CheckTask<storm::logic::Formula, ConstantType>& checkTask) {
+    if (!checkTask.getHint().isExplicitModelCheckerHint()) {
+        checkTask.setHint(std::make_shared<ExplicitModelCheckerHint<ConstantType>>());
     }
-    ExplicitModelCheckerHint<ConstantType>& hint = this->currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>();
+    ExplicitModelCheckerHint<ConstantType>& hint = checkTask.getHint().template asExplicitModelCheckerHint<ConstantType>();
 
     if (this->getInstantiationsAreGraphPreserving() && !hint.hasMaybeStates()) {
         // Perform purely qualitative analysis once
         std::vector<ConstantType> qualitativeResult;
-        if (this->currentCheckTask->getFormula().asOperatorFormula().hasQuantitativeResult()) {
-            auto newCheckTask = *this->currentCheckTask;
+        if (checkTask.getFormula().asOperatorFormula().hasQuantitativeResult()) {
+            auto newCheckTask = checkTask;
             newCheckTask.setQualitative(true);
             newCheckTask.setOnlyInitialStatesRelevant(false);
             qualitativeResult = modelChecker.check(env, newCheckTask)->template asExplicitQuantitativeCheckResult<ConstantType>().getValueVector();
         } else {
-            auto newCheckTask = this->currentCheckTask->substituteFormula(this->currentCheckTask->getFormula().asOperatorFormula().getSubformula());
+            auto newCheckTask = checkTask.substituteFormula(checkTask.getFormula().asOperatorFormula().getSubformula());
             newCheckTask.setQualitative(true);
             newCheckTask.setOnlyInitialStatesRelevant(false);
             qualitativeResult = modelChecker.computeRewards(env, newCheckTask)->template asExplicitQuantitativeCheckResult<ConstantType>().getValueVector();
@@ -142,18 +242,18 @@ std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType
 
     // Check the formula and store the result as a hint for the next call.
     // For qualitative properties, we still want a quantitative result hint. Hence we perform the check on the subformula
-    if (this->currentCheckTask->getFormula().asOperatorFormula().hasQuantitativeResult()) {
-        result = modelChecker.check(env, *this->currentCheckTask);
-        this->currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>().setResultHint(
+    if (checkTask.getFormula().asOperatorFormula().hasQuantitativeResult()) {
+        result = modelChecker.check(env, checkTask);
+        checkTask.getHint().template asExplicitModelCheckerHint<ConstantType>().setResultHint(
             result->template asExplicitQuantitativeCheckResult<ConstantType>().getValueVector());
     } else {
-        auto newCheckTask = this->currentCheckTask->substituteFormula(this->currentCheckTask->getFormula().asOperatorFormula().getSubformula())
+        auto newCheckTask = checkTask.substituteFormula(checkTask.getFormula().asOperatorFormula().getSubformula())
                                 .setOnlyInitialStatesRelevant(false);
         std::unique_ptr<CheckResult> quantitativeResult = modelChecker.computeRewards(env, newCheckTask);
         result = quantitativeResult->template asExplicitQuantitativeCheckResult<ConstantType>().compareAgainstBound(
-            this->currentCheckTask->getFormula().asOperatorFormula().getComparisonType(),
-            this->currentCheckTask->getFormula().asOperatorFormula().template getThresholdAs<ConstantType>());
-        this->currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>().setResultHint(
+            checkTask.getFormula().asOperatorFormula().getComparisonType(),
+            checkTask.getFormula().asOperatorFormula().template getThresholdAs<ConstantType>());
+        checkTask.getHint().template asExplicitModelCheckerHint<ConstantType>().setResultHint(
             std::move(quantitativeResult->template asExplicitQuantitativeCheckResult<ConstantType>().getValueVector()));
     }
 
@@ -162,26 +262,27 @@ std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType
 
 template<typename SparseModelType, typename ConstantType>
 std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkBoundedUntilFormula(
-    Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker) {
-    if (!this->currentCheckTask->getHint().isExplicitModelCheckerHint()) {
-        this->currentCheckTask->setHint(std::make_shared<ExplicitModelCheckerHint<ConstantType>>());
+    Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker,
+    CheckTask<storm::logic::Formula, ConstantType>& checkTask) {
+    if (!checkTask.getHint().isExplicitModelCheckerHint()) {
+        checkTask.setHint(std::make_shared<ExplicitModelCheckerHint<ConstantType>>());
     }
     std::unique_ptr<CheckResult> result;
-    ExplicitModelCheckerHint<ConstantType>& hint = this->currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>();
+    ExplicitModelCheckerHint<ConstantType>& hint = checkTask.getHint().template asExplicitModelCheckerHint<ConstantType>();
 
     if (this->getInstantiationsAreGraphPreserving() && !hint.hasMaybeStates()) {
         // We extract the maybestates from the quantitative result
         // For qualitative properties, we still need a quantitative result. Hence we perform the check on the subformula
-        if (this->currentCheckTask->getFormula().asOperatorFormula().hasQuantitativeResult()) {
-            result = modelChecker.check(env, *this->currentCheckTask);
+        if (checkTask.getFormula().asOperatorFormula().hasQuantitativeResult()) {
+            result = modelChecker.check(env, checkTask);
             hint.setResultHint(result->template asExplicitQuantitativeCheckResult<ConstantType>().getValueVector());
         } else {
-            auto newCheckTask = this->currentCheckTask->substituteFormula(this->currentCheckTask->getFormula().asOperatorFormula().getSubformula())
+            auto newCheckTask = checkTask.substituteFormula(checkTask.getFormula().asOperatorFormula().getSubformula())
                                     .setOnlyInitialStatesRelevant(false);
             std::unique_ptr<CheckResult> quantitativeResult = modelChecker.computeProbabilities(env, newCheckTask);
             result = quantitativeResult->template asExplicitQuantitativeCheckResult<ConstantType>().compareAgainstBound(
-                this->currentCheckTask->getFormula().asOperatorFormula().getComparisonType(),
-                this->currentCheckTask->getFormula().asOperatorFormula().template getThresholdAs<ConstantType>());
+                checkTask.getFormula().asOperatorFormula().getComparisonType(),
+                checkTask.getFormula().asOperatorFormula().template getThresholdAs<ConstantType>());
             hint.setResultHint(std::move(quantitativeResult->template asExplicitQuantitativeCheckResult<ConstantType>().getValueVector()));
         }
 
@@ -189,12 +290,12 @@ std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType
         // We need to exclude the target states from the maybe states.
         // Note that we can not consider the states with probability one since a state might reach a target state with prob 1 within >0 steps
         std::unique_ptr<CheckResult> subFormulaResult =
-            modelChecker.check(env, this->currentCheckTask->getFormula().asOperatorFormula().getSubformula().asBoundedUntilFormula().getRightSubformula());
+            modelChecker.check(env, checkTask.getFormula().asOperatorFormula().getSubformula().asBoundedUntilFormula().getRightSubformula());
         maybeStates = maybeStates & ~(subFormulaResult->template asExplicitQualitativeCheckResult<ConstantType>().getTruthValuesVector());
         hint.setMaybeStates(std::move(maybeStates));
         hint.setComputeOnlyMaybeStates(true);
     } else {
-        result = modelChecker.check(env, *this->currentCheckTask);
+        result = modelChecker.check(env, checkTask);
     }
 
     return result;
@@ -2,8 +2,10 @@
 
 #include <boost/optional.hpp>
 #include <memory>
+#include <vector>
 
 #include "storm-pars/modelchecker/instantiation/SparseInstantiationModelChecker.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
 #include "storm-pars/utility/ModelInstantiator.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
 #include "storm/models/sparse/Dtmc.h"
@@ -22,18 +24,41 @@ class SparseDtmcInstantiationModelChecker : public SparseInstantiationModelCheck
     virtual std::unique_ptr<CheckResult> check(Environment const& env,
                                                storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
 
+    /*!
+     * Checks the specified formula for each of the given valuations.
+     * If multiple threads are allowed and the solution is not exact, the occurring functions are compiled once and evaluated in floating point
+     * arithmetic for many valuations at once. The instantiated models are then checked concurrently. Otherwise, the valuations are checked one after
+     * another as in check().
+     */
+    virtual std::vector<std::unique_ptr<CheckResult>> checkBatch(
+        Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations,
+        std::vector<storm::utility::Stopwatch>* stopwatches = nullptr) override;
+
     virtual bool isWellDefined(storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
 
    protected:
+    typedef storm::utility::ModelInstantiator<SparseModelType, storm::models::sparse::Dtmc<ConstantType>> ModelInstantiatorType;
+
+    // Checks the given check task on the given instantiation of the parametric model. Hints are stored in the given check task.
+    std::unique_ptr<CheckResult> checkInstantiatedModel(Environment const& env, storm::models::sparse::Dtmc<ConstantType> const& instantiatedModel,
+                                                        CheckTask<storm::logic::Formula, ConstantType>& checkTask);
+
     // Optimizations for the different formula types
     std::unique_ptr<CheckResult> checkReachabilityProbabilityFormula(
-        Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
+        Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker,
+        CheckTask<storm::logic::Formula, ConstantType>& checkTask);
     std::unique_ptr<CheckResult> checkReachabilityRewardFormula(
-        Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
+        Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker,
+        CheckTask<storm::logic::Formula, ConstantType>& checkTask);
     std::unique_ptr<CheckResult> checkBoundedUntilFormula(
-        Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
+        Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker,
+        CheckTask<storm::logic::Formula, ConstantType>& checkTask);
+
+    ModelInstantiatorType modelInstantiator;
 
-    storm::utility::ModelInstantiator<SparseModelType, storm::models::sparse::Dtmc<ConstantType>> modelInstantiator;
+    // The compiled occurring functions and the instantiators of the additional threads used when checking batches of valuations
+    std::unique_ptr<storm::utility::CompiledRationalFunctions<ConstantType>> compiledFunctions;
+    std::vector<std::unique_ptr<ModelInstantiatorType>> additionalModelInstantiators;
 };
 }  // namespace modelchecker
 }  // namespace storm
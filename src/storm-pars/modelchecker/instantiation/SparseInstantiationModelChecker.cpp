@@ -10,7 +10,7 @@ namespace modelchecker {
 
 template<typename SparseModelType, typename ConstantType>
 SparseInstantiationModelChecker<SparseModelType, ConstantType>::SparseInstantiationModelChecker(SparseModelType const& parametricModel)
-    : parametricModel(parametricModel), instantiationsAreGraphPreserving(false) {
+    : parametricModel(parametricModel), instantiationsAreGraphPreserving(false), numberOfThreads(1) {
     // Intentionally left empty
 }
 
@@ -22,6 +22,27 @@ void SparseInstantiationModelChecker<SparseModelType, ConstantType>::specifyForm
         checkTask.substituteFormula(*currentFormula).template convertValueType<ConstantType>());
 }
 
+template<typename SparseModelType, typename ConstantType>
+std::vector<std::unique_ptr<CheckResult>> SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkBatch(
+    Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations,
+    std::vector<storm::utility::Stopwatch>* stopwatches) {
+    std::vector<std::unique_ptr<CheckResult>> results;
+    results.reserve(valuations.size());
+    if (stopwatches) {
+        stopwatches->assign(valuations.size(), storm::utility::Stopwatch());
+    }
+    for (uint64_t i = 0; i < valuations.size(); ++i) {
+        if (stopwatches) {
+            (*stopwatches)[i].start();
+        }
+        results.push_back(check(env, valuations[i]));
+        if (stopwatches) {
+            (*stopwatches)[i].stop();
+        }
+    }
+    return results;
+}
+
 template<typename SparseModelType, typename ConstantType>
 void SparseInstantiationModelChecker<SparseModelType, ConstantType>::setInstantiationsAreGraphPreserving(bool value) {
     instantiationsAreGraphPreserving = value;
@@ -32,6 +53,16 @@ bool SparseInstantiationModelChecker<SparseModelType, ConstantType>::getInstanti
     return instantiationsAreGraphPreserving;
 }
 
+template<typename SparseModelType, typename ConstantType>
+void SparseInstantiationModelChecker<SparseModelType, ConstantType>::setNumberOfThreads(uint64_t value) {
+    numberOfThreads = value;
+}
+
+template<typename SparseModelType, typename ConstantType>
+uint64_t SparseInstantiationModelChecker<SparseModelType, ConstantType>::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
 template<typename SparseModelType, typename ConstantType>
 SparseModelType const& SparseInstantiationModelChecker<SparseModelType, ConstantType>::getOriginalModel() const {
     return parametricModel;
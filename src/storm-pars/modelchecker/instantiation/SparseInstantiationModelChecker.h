@@ -1,10 +1,14 @@
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "storm-pars/utility/parametric.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/CheckTask.h"
 #include "storm/modelchecker/hints/ModelCheckerHint.h"
 #include "storm/modelchecker/results/CheckResult.h"
+#include "storm/utility/Stopwatch.h"
 
 namespace storm {
 
@@ -35,6 +39,18 @@ class SparseInstantiationModelChecker {
      * @param valuation The valuation to check.
      * @return true if the valuation is well-defined, false otherwise.
      */
+    /*!
+     * Checks the specified formula for each of the given valuations.
+     * The default implementation checks one valuation after another. Subclasses may evaluate the valuations in batches and concurrently.
+     *
+     * @param valuations The valuations to check.
+     * @param stopwatches If given, the i-th stopwatch measures the time spent on checking the i-th valuation.
+     * @return The check result for each valuation (in the same order).
+     */
+    virtual std::vector<std::unique_ptr<CheckResult>> checkBatch(
+        Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations,
+        std::vector<storm::utility::Stopwatch>* stopwatches = nullptr);
+
     virtual bool isWellDefined(storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) = 0;
 
     // If set, it is assumed that all considered model instantiations have the same underlying graph structure.
@@ -42,6 +58,10 @@ class SparseInstantiationModelChecker {
     void setInstantiationsAreGraphPreserving(bool value);
     bool getInstantiationsAreGraphPreserving() const;
 
+    // The number of threads that may be used to check multiple valuations concurrently (0 means 'auto-detect').
+    void setNumberOfThreads(uint64_t value);
+    uint64_t getNumberOfThreads() const;
+
     SparseModelType const& getOriginalModel() const;
 
    protected:
@@ -53,6 +73,7 @@ class SparseInstantiationModelChecker {
     std::shared_ptr<storm::logic::Formula const> currentFormula;
 
     bool instantiationsAreGraphPreserving;
+    uint64_t numberOfThreads;
 };
 }  // namespace modelchecker
 }  // namespace storm
@@ -43,6 +43,8 @@ struct RegionRefinementOptions {
     std::optional<std::pair<std::set<typename storm::storage::ParameterRegion<ValueType>::VariableType>,
                             std::set<typename storm::storage::ParameterRegion<ValueType>::VariableType>>>
         monotoneParameters;
+    // The number of threads used to analyze regions concurrently during region partitioning (0 means 'auto-detect').
+    uint64_t numberOfThreads = 1;
 
     /**
      * @brief Constructs the region refinement options.
@@ -9,12 +9,14 @@
 #include "storm-pars/modelchecker/region/RegionSplittingStrategy.h"
 #include "storm-pars/modelchecker/region/monotonicity/MonotonicityBackend.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/Environment.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/NotImplementedException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/logic/Bound.h"
 #include "storm/logic/ComparisonType.h"
 #include "storm/utility/ProgressMeasurement.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/logging.h"
 #include "storm/utility/macros.h"
 
@@ -32,6 +34,13 @@ bool RegionRefinementChecker<ParametricType>::canHandle(std::shared_ptr<storm::m
     return regionChecker->canHandle(parametricModel, checkTask);
 }
 
+template<typename ParametricType>
+void RegionRefinementChecker<ParametricType>::addRegionCheckerForConcurrentAnalysis(
+    std::unique_ptr<RegionModelChecker<ParametricType>>&& additionalRegionChecker) {
+    STORM_LOG_ASSERT(additionalRegionChecker != nullptr, "The region model checker must not be null.");
+    additionalRegionCheckers.push_back(std::move(additionalRegionChecker));
+}
+
 template<typename ParametricType>
 void RegionRefinementChecker<ParametricType>::specify(Environment const& env, std::shared_ptr<storm::models::ModelBase> parametricModel,
                                                       CheckTask<storm::logic::Formula, ParametricType> const& checkTask,
@@ -39,6 +48,20 @@ void RegionRefinementChecker<ParametricType>::specify(Environment const& env, st
                                                       std::shared_ptr<MonotonicityBackend<ParametricType>> monotonicityBackend, bool allowModelSimplifications,
                                                       bool graphPreserving) {
     this->monotonicityBackend = monotonicityBackend ? monotonicityBackend : std::make_shared<MonotonicityBackend<ParametricType>>();
+    // Analyzing regions in batches changes the order of monotonicity updates and splits, which is only sound if the backend does not interact with the
+    // region model checker.
+    if (!additionalRegionCheckers.empty() && this->monotonicityBackend->requiresInteractionWithRegionModelChecker()) {
+        STORM_LOG_WARN("Regions are analyzed by a single thread because the monotonicity backend interacts with the region model checker.");
+        additionalRegionCheckers.clear();
+    }
+#ifdef STORM_USE_CLN_RF
+    // CLN numbers are reference counted without synchronization. As the region model checkers copy the coefficients of the parametric model and the
+    // region boundaries, they can not run concurrently.
+    if (!additionalRegionCheckers.empty()) {
+        STORM_LOG_WARN("Regions are analyzed by a single thread because rational functions with CLN coefficients can not be shared between threads.");
+        additionalRegionCheckers.clear();
+    }
+#endif
     this->regionSplittingStrategy = std::move(splittingStrategy);
     this->discreteVariables = std::move(discreteVariables);
     this->graphPreserving = graphPreserving;
@@ -61,6 +84,10 @@ void RegionRefinementChecker<ParametricType>::specify(Environment const& env, st
 
     regionChecker->specify(env, parametricModel, checkTask, regionSplittingStrategy.estimateKind, monotonicityBackend, allowModelSimplifications,
                            graphPreserving);
+    for (auto& additionalRegionChecker : additionalRegionCheckers) {
+        additionalRegionChecker->specify(env, parametricModel, checkTask, regionSplittingStrategy.estimateKind, monotonicityBackend,
+                                         allowModelSimplifications, graphPreserving);
+    }
 }
 
 template<typename T>
@@ -138,46 +165,80 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
     uint64_t numOfAnalyzedRegions{0u};
     bool monotonicityInitialized{false};
 
+    // With multiple region model checkers, we take several regions from the queue at once and analyze them concurrently.
+    // The results are then processed one region at a time in queue order, so that the partition coincides with the sequential one.
+    uint64_t const maxNumberOfRegionsPerBatch = additionalRegionCheckers.empty() ? 1 : 4 * (additionalRegionCheckers.size() + 1);
+    std::vector<std::reference_wrapper<AnnotatedRegion<ParametricType>>> currentRegions;
+    std::vector<std::optional<std::set<VariableType>>> splittingVariables;
+    // The annotations of the regions of the current batch before their analysis
+    struct AnalysisAnnotations {
+        RegionResult result;
+        bool resultKnownThroughMonotonicity;
+        storm::utility::Maximum<CoefficientType> knownLowerValueBound;
+        storm::utility::Minimum<CoefficientType> knownUpperValueBound;
+    };
+    std::vector<AnalysisAnnotations> annotationsBeforeAnalysis;
+
     // Region Refinement Loop
     while (!progress.isCoverageThresholdReached() && !unprocessedRegions.empty()) {
-        auto& currentRegion = unprocessedRegions.front().get();
-        STORM_LOG_TRACE("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentRegion.refinementDepth << "; "
-                                             << progress.getUndiscoveredPercentage() << "% still unknown; " << unprocessedRegions.size()
-                                             << " regions unprocessed).");
-        unprocessedRegions.pop();  // can pop already here, since the rootRegion has ownership.
-        ++numOfAnalyzedRegions;
-
-        if (!monotonicityInitialized && currentRegion.refinementDepth >= monThresh) {
-            monotonicityInitialized = true;
-            monotonicityBackend->initializeMonotonicity(env, rootRegion);
-            // Propagate monotonicity (unless the currentRegion is the root)
-            if (currentRegion.refinementDepth > 0) {
-                rootRegion.propagateAnnotationsToSubregions(true);
+        currentRegions.clear();
+        annotationsBeforeAnalysis.clear();
+        while (!unprocessedRegions.empty() && currentRegions.size() < maxNumberOfRegionsPerBatch) {
+            auto& currentRegion = unprocessedRegions.front().get();
+            STORM_LOG_TRACE("Analyzing region #" << numOfAnalyzedRegions << " (Refinement depth " << currentRegion.refinementDepth << "; "
+                                                 << progress.getUndiscoveredPercentage() << "% still unknown; " << unprocessedRegions.size()
+                                                 << " regions unprocessed).");
+            unprocessedRegions.pop();  // can pop already here, since the rootRegion has ownership.
+            ++numOfAnalyzedRegions;
+
+            if (!monotonicityInitialized && currentRegion.refinementDepth >= monThresh) {
+                monotonicityInitialized = true;
+                monotonicityBackend->initializeMonotonicity(env, rootRegion);
+                // Propagate monotonicity (unless the currentRegion is the root)
+                if (currentRegion.refinementDepth > 0) {
+                    rootRegion.propagateAnnotationsToSubregions(true);
+                }
             }
-        }
-        if (monotonicityInitialized) {
-            monotonicityBackend->updateMonotonicity(env, currentRegion);
+            if (monotonicityInitialized) {
+                monotonicityBackend->updateMonotonicity(env, currentRegion);
+            }
+            currentRegions.push_back(currentRegion);
+            annotationsBeforeAnalysis.push_back(
+                {currentRegion.result, currentRegion.resultKnownThroughMonotonicity, currentRegion.knownLowerValueBound, currentRegion.knownUpperValueBound});
         }
 
-        currentRegion.result = regionChecker->analyzeRegion(env, currentRegion, hypothesis);
-
-        if (currentRegion.result == RegionResult::AllSat) {
-            progress.addAllSatArea(currentRegion.region.area());
-        } else if (currentRegion.result == RegionResult::AllViolated) {
-            progress.addAllViolatedArea(currentRegion.region.area());
-        } else if (currentRegion.result == RegionResult::AllIllDefined) {
-            // ill defined region => not graph-preserving
-            STORM_LOG_THROW(!this->graphPreserving, storm::exceptions::NotImplementedException,
-                            "The region is not graph-preserving, but the selected region verification engine requires this assumption. Please use "
-                            "--assume-graph-preserving false.");
-            progress.addAllIllDefinedArea(currentRegion.region.area());
-        } else {
-            // Split the region as long as the desired refinement depth is not reached.
-            if (!depthThreshold || currentRegion.refinementDepth < depthThreshold.value()) {
+        analyzeRegionsForPartitioning(env, currentRegions, hypothesis, depthThreshold, splittingVariables);
+
+        for (uint64_t regionIndex = 0; regionIndex < currentRegions.size(); ++regionIndex) {
+            if (progress.isCoverageThresholdReached()) {
+                // The remaining regions of the batch would not have been analyzed sequentially, so we discard their analysis.
+                for (uint64_t skippedIndex = regionIndex; skippedIndex < currentRegions.size(); ++skippedIndex) {
+                    auto& skippedRegion = currentRegions[skippedIndex].get();
+                    auto const& annotations = annotationsBeforeAnalysis[skippedIndex];
+                    skippedRegion.result = annotations.result;
+                    skippedRegion.resultKnownThroughMonotonicity = annotations.resultKnownThroughMonotonicity;
+                    skippedRegion.knownLowerValueBound = annotations.knownLowerValueBound;
+                    skippedRegion.knownUpperValueBound = annotations.knownUpperValueBound;
+                }
+                numOfAnalyzedRegions -= currentRegions.size() - regionIndex;
+                break;
+            }
+            auto& currentRegion = currentRegions[regionIndex].get();
+            if (currentRegion.result == RegionResult::AllSat) {
+                progress.addAllSatArea(currentRegion.region.area());
+            } else if (currentRegion.result == RegionResult::AllViolated) {
+                progress.addAllViolatedArea(currentRegion.region.area());
+            } else if (currentRegion.result == RegionResult::AllIllDefined) {
+                // ill defined region => not graph-preserving
+                STORM_LOG_THROW(!this->graphPreserving, storm::exceptions::NotImplementedException,
+                                "The region is not graph-preserving, but the selected region verification engine requires this assumption. Please use "
+                                "--assume-graph-preserving false.");
+                progress.addAllIllDefinedArea(currentRegion.region.area());
+            } else if (splittingVariables[regionIndex]) {
+                // Split the region as the desired refinement depth is not reached.
                 monotonicityBackend->updateMonotonicityBeforeSplitting(env, currentRegion);
-                auto splittingVariables = getSplittingVariables(currentRegion, Context::Partitioning);
-                STORM_LOG_INFO("Splitting on variables" << splittingVariables);
-                currentRegion.splitLeafNodeAtCenter(splittingVariables, this->discreteVariables, true);
+                STORM_LOG_INFO("Splitting on variables" << splittingVariables[regionIndex].value());
+                currentRegion.splitLeafNodeAtCenter(splittingVariables[regionIndex].value(), this->discreteVariables, true);
                 for (auto& child : currentRegion.subRegions) {
                     unprocessedRegions.emplace(child);
                 }
@@ -206,6 +267,33 @@ std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>
     return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
 }
 
+template<typename ParametricType>
+void RegionRefinementChecker<ParametricType>::analyzeRegionsForPartitioning(
+    Environment const& env, std::vector<std::reference_wrapper<AnnotatedRegion<ParametricType>>> const& regions, RegionResultHypothesis const& hypothesis,
+    std::optional<uint64_t> const& depthThreshold, std::vector<std::optional<std::set<VariableType>>>& splittingVariables) {
+    splittingVariables.assign(regions.size(), std::nullopt);
+    // Each worker analyzes its regions with its own region model checker and its own environment, as environments are not safe to share between threads.
+    std::vector<storm::Environment> workerEnvironments(additionalRegionCheckers.size() + 1, env);
+    auto analyzeRegion = [&](uint64_t regionIndex, uint64_t workerIndex) {
+        auto& checker = workerIndex == 0 ? *regionChecker : *additionalRegionCheckers[workerIndex - 1];
+        auto& region = regions[regionIndex].get();
+        region.result = checker.analyzeRegion(workerEnvironments[workerIndex], region, hypothesis);
+        if (region.result != RegionResult::AllSat && region.result != RegionResult::AllViolated && region.result != RegionResult::AllIllDefined &&
+            (!depthThreshold || region.refinementDepth < depthThreshold.value())) {
+            // The split estimates refer to the region that the checker analyzed last, so we determine the splitting variables right away.
+            splittingVariables[regionIndex] = getSplittingVariables(region, Context::Partitioning, checker);
+        }
+    };
+
+    if (additionalRegionCheckers.empty()) {
+        for (uint64_t regionIndex = 0; regionIndex < regions.size(); ++regionIndex) {
+            analyzeRegion(regionIndex, 0);
+        }
+        return;
+    }
+    storm::utility::ThreadPool::getShared(additionalRegionCheckers.size() + 1)->parallelFor(regions.size(), analyzeRegion);
+}
+
 template<typename ParametricType>
 std::pair<typename storm::storage::ParameterRegion<ParametricType>::CoefficientType, typename storm::storage::ParameterRegion<ParametricType>::Valuation>
 RegionRefinementChecker<ParametricType>::computeExtremalValueHelper(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region,
@@ -284,7 +372,7 @@ RegionRefinementChecker<ParametricType>::computeExtremalValueHelper(Environment
         // Trigger region-splitting if over- and under-approximation are still too far apart
         if (!acceptGlobalBound(value, currentBound.value())) {
             monotonicityBackend->updateMonotonicityBeforeSplitting(env, currentRegion);
-            auto splittingVariables = getSplittingVariables(currentRegion, Context::ExtremalValue);
+            auto splittingVariables = getSplittingVariables(currentRegion, Context::ExtremalValue, *regionChecker);
             STORM_LOG_INFO("Splitting on variables " << splittingVariables);
             currentRegion.splitLeafNodeAtCenter(splittingVariables, this->discreteVariables, true);
             for (auto& child : currentRegion.subRegions) {
@@ -340,13 +428,13 @@ bool RegionRefinementChecker<ParametricType>::verifyRegion(const storm::Environm
 
 template<typename ParametricType>
 std::set<typename RegionRefinementChecker<ParametricType>::VariableType> RegionRefinementChecker<ParametricType>::getSplittingVariablesEstimateBased(
-    AnnotatedRegion<ParametricType> const& region, Context context) const {
+    AnnotatedRegion<ParametricType> const& region, Context context, RegionModelChecker<ParametricType> const& checker) const {
     // If we can split on all variables, do that instead of requesting region split estimates
     if (this->regionSplittingStrategy.maxSplitDimensions >= region.region.getVariables().size()) {
         return region.region.getVariables();
     }
 
-    auto const& estimates = regionChecker->obtainRegionSplitEstimates(region.region.getVariables());
+    auto const& estimates = checker.obtainRegionSplitEstimates(region.region.getVariables());
     std::vector<std::pair<VariableType, CoefficientType>> estimatesToSort;
     estimatesToSort.reserve(region.region.getVariables().size());
     STORM_LOG_ASSERT(estimates.size() == region.region.getVariables().size(), "Unexpected number of estimates");
@@ -407,10 +495,10 @@ std::set<typename RegionRefinementChecker<ParametricType>::VariableType> RegionR
 
 template<typename ParametricType>
 std::set<typename RegionRefinementChecker<ParametricType>::VariableType> RegionRefinementChecker<ParametricType>::getSplittingVariables(
-    AnnotatedRegion<ParametricType> const& region, Context context) const {
+    AnnotatedRegion<ParametricType> const& region, Context context, RegionModelChecker<ParametricType> const& checker) const {
     switch (regionSplittingStrategy.heuristic) {
         case RegionSplittingStrategy::Heuristic::EstimateBased:
-            return getSplittingVariablesEstimateBased(region, context);
+            return getSplittingVariablesEstimateBased(region, context, checker);
         case RegionSplittingStrategy::Heuristic::RoundRobin:
             return getSplittingVariablesRoundRobin(region, context);
         case RegionSplittingStrategy::Heuristic::Default:
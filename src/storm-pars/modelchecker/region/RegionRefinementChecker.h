@@ -1,6 +1,8 @@
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 #include "storm-pars/modelchecker/region/RegionResult.h"
 #include "storm-pars/modelchecker/region/RegionResultHypothesis.h"
@@ -38,6 +40,14 @@ class RegionRefinementChecker {
 
     bool canHandle(std::shared_ptr<storm::models::ModelBase> parametricModel, CheckTask<storm::logic::Formula, ParametricType> const& checkTask) const;
 
+    /*!
+     * Adds a further region model checker that analyzes regions concurrently to the other region model checkers during region partitioning.
+     * It has to be of the same kind as the region model checker given upon construction and is specified together with it.
+     * @note The regions are analyzed by one thread per region model checker, each with its own copy of the environment. The region model checkers do
+     * not share any state. If rational functions have CLN coefficients (which can not be shared between threads), the additional checkers are ignored.
+     */
+    void addRegionCheckerForConcurrentAnalysis(std::unique_ptr<RegionModelChecker<ParametricType>>&& additionalRegionChecker);
+
     void specify(Environment const& env, std::shared_ptr<storm::models::ModelBase> parametricModel,
                  CheckTask<storm::logic::Formula, ParametricType> const& checkTask, RegionSplittingStrategy splittingStrategy = RegionSplittingStrategy(),
                  std::set<VariableType> const& discreteVariables = {}, std::shared_ptr<MonotonicityBackend<ParametricType>> monotonicityBackend = {},
@@ -101,12 +111,26 @@ class RegionRefinementChecker {
 
    private:
     enum class Context { Partitioning, ExtremalValue };
-    std::set<VariableType> getSplittingVariablesEstimateBased(AnnotatedRegion<ParametricType> const& region, Context context) const;
+    std::set<VariableType> getSplittingVariablesEstimateBased(AnnotatedRegion<ParametricType> const& region, Context context,
+                                                              RegionModelChecker<ParametricType> const& checker) const;
     std::set<VariableType> getSplittingVariablesRoundRobin(AnnotatedRegion<ParametricType> const& region, Context context) const;
 
-    std::set<VariableType> getSplittingVariables(AnnotatedRegion<ParametricType> const& region, Context context) const;
+    /*!
+     * @param checker the region model checker that analyzed the given region most recently (used for region split estimates)
+     */
+    std::set<VariableType> getSplittingVariables(AnnotatedRegion<ParametricType> const& region, Context context,
+                                                 RegionModelChecker<ParametricType> const& checker) const;
+
+    /*!
+     * Analyzes the given regions, distributing them among the region model checkers.
+     * @param splittingVariables is set to the variables on which to split for each region that remains inconclusive and shall be split.
+     */
+    void analyzeRegionsForPartitioning(Environment const& env, std::vector<std::reference_wrapper<AnnotatedRegion<ParametricType>>> const& regions,
+                                       RegionResultHypothesis const& hypothesis, std::optional<uint64_t> const& depthThreshold,
+                                       std::vector<std::optional<std::set<VariableType>>>& splittingVariables);
 
     std::unique_ptr<RegionModelChecker<ParametricType>> regionChecker;
+    std::vector<std::unique_ptr<RegionModelChecker<ParametricType>>> additionalRegionCheckers;
     std::shared_ptr<MonotonicityBackend<ParametricType>> monotonicityBackend;
     RegionSplittingStrategy regionSplittingStrategy;
     std::set<VariableType> discreteVariables;
@@ -36,6 +36,11 @@ class PartitionSettings : public ModuleSettings {
      */
     bool isPrintFullResultSet() const;
 
+    /*!
+     * Retrieves the number of threads used to analyze regions concurrently (0 means 'auto-detect').
+     */
+    uint64_t getNumberOfThreads() const;
+
     const static std::string moduleName;
 };
 }  // namespace storm::settings::modules
@@ -11,6 +11,7 @@ const std::string SamplingSettings::moduleName = "sampling";
 const std::string samplesOptionName = "samples";
 const std::string samplesGraphPreservingOptionName = "samples-graph-preserving";
 const std::string sampleExactOptionName = "sample-exact";
+const std::string threadsOptionName = "threads";
 
 SamplingSettings::SamplingSettings() : ModuleSettings(moduleName) {
     this->addOption(
@@ -25,6 +26,12 @@ SamplingSettings::SamplingSettings() : ModuleSettings(moduleName) {
                                                    "Sets whether it can be assumed that the samples are graph-preserving.")
                         .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, sampleExactOptionName, false, "Sets whether to sample using exact arithmetic.").build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false, "The number of threads used to check samples concurrently.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 std::string SamplingSettings::getSamples() const {
@@ -38,4 +45,8 @@ bool SamplingSettings::isSamplesAreGraphPreservingSet() const {
 bool SamplingSettings::isSampleExactSet() const {
     return this->getOption(sampleExactOptionName).getHasOptionBeenSet();
 }
+
+uint64_t SamplingSettings::getNumberOfThreads() const {
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
 }  // namespace storm::settings::modules
\ No newline at end of file
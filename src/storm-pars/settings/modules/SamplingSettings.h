@@ -23,6 +23,11 @@ class SamplingSettings : public ModuleSettings {
      */
     bool isSampleExactSet() const;
 
+    /*!
+     * Retrieves the number of threads used to check samples concurrently (0 means 'auto-detect').
+     */
+    uint64_t getNumberOfThreads() const;
+
     static const std::string moduleName;
 };
 
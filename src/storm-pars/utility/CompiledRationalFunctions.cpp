@@ -0,0 +1,134 @@
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+
+#include <algorithm>
+#include <set>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace utility {
+
+template<typename ConstantType>
+uint64_t CompiledRationalFunctions<ConstantType>::addFunction(storm::RationalFunction const& function) {
+    CompiledFunction compiledFunction;
+    if (function.isConstant()) {
+        compiledFunction.numerator = addPolynomial(storm::RawPolynomial(function.constantPart()), storm::utility::one<storm::RationalFunctionCoefficient>());
+    } else {
+        auto denominator = function.denominator().polynomialWithCoefficient();
+        if (denominator.isConstant()) {
+            compiledFunction.numerator = addPolynomial(function.nominator().polynomialWithCoefficient(), denominator.constantPart());
+        } else {
+            compiledFunction.numerator =
+                addPolynomial(function.nominator().polynomialWithCoefficient(), storm::utility::one<storm::RationalFunctionCoefficient>());
+            compiledFunction.denominator = addPolynomial(denominator, storm::utility::one<storm::RationalFunctionCoefficient>());
+        }
+    }
+    functions.push_back(std::move(compiledFunction));
+    return functions.size() - 1;
+}
+
+template<typename ConstantType>
+uint64_t CompiledRationalFunctions<ConstantType>::addPolynomial(storm::RawPolynomial const& polynomial, storm::RationalFunctionCoefficient const& divisor) {
+    std::set<VariableType> termVariables;
+    for (auto const& term : polynomial) {
+        termCoefficients.push_back(storm::utility::convertNumber<ConstantType>(storm::RationalFunctionCoefficient(term.coeff() / divisor)));
+        termVariables.clear();
+        term.gatherVariables(termVariables);
+        for (auto const& variable : termVariables) {
+            factors.emplace_back(getParameterIndex(variable), term.monomial()->exponentOfVariable(variable));
+        }
+        termFactorIndices.push_back(factors.size());
+    }
+    polynomialTermIndices.push_back(termCoefficients.size());
+    return polynomialTermIndices.size() - 2;
+}
+
+template<typename ConstantType>
+uint64_t CompiledRationalFunctions<ConstantType>::getParameterIndex(VariableType const& parameter) {
+    auto insertionRes = parameterIndices.emplace(parameter, parameters.size());
+    if (insertionRes.second) {
+        parameters.push_back(parameter);
+    }
+    return insertionRes.first->second;
+}
+
+template<typename ConstantType>
+uint64_t CompiledRationalFunctions<ConstantType>::getNumberOfFunctions() const {
+    return functions.size();
+}
+
+template<typename ConstantType>
+std::vector<typename CompiledRationalFunctions<ConstantType>::VariableType> const& CompiledRationalFunctions<ConstantType>::getParameters() const {
+    return parameters;
+}
+
+template<typename ConstantType>
+std::vector<ConstantType> CompiledRationalFunctions<ConstantType>::getParameterValues(
+    storm::utility::parametric::Valuation<storm::RationalFunction> const& valuation) const {
+    std::vector<ConstantType> result;
+    result.reserve(parameters.size());
+    for (auto const& parameter : parameters) {
+        auto valuationIt = valuation.find(parameter);
+        STORM_LOG_THROW(valuationIt != valuation.end(), storm::exceptions::InvalidArgumentException,
+                        "The valuation does not specify a value for parameter " << parameter << ".");
+        result.push_back(storm::utility::convertNumber<ConstantType>(valuationIt->second));
+    }
+    return result;
+}
+
+template<typename ConstantType>
+void CompiledRationalFunctions<ConstantType>::evaluate(std::vector<ConstantType> const& parameterValues, std::vector<ConstantType>& functionValues) const {
+    evaluate(parameterValues, 1, functionValues);
+}
+
+template<typename ConstantType>
+void CompiledRationalFunctions<ConstantType>::evaluate(std::vector<ConstantType> const& parameterValues, uint64_t numberOfPoints,
+                                                       std::vector<ConstantType>& functionValues) const {
+    STORM_LOG_ASSERT(parameterValues.size() == parameters.size() * numberOfPoints, "Unexpected number of parameter values.");
+    functionValues.resize(functions.size() * numberOfPoints);
+    std::vector<ConstantType> termValues(numberOfPoints);
+    std::vector<ConstantType> denominatorValues;
+    auto functionValuesIt = functionValues.begin();
+    for (auto const& function : functions) {
+        evaluatePolynomial(function.numerator, parameterValues, numberOfPoints, functionValuesIt, termValues);
+        if (function.denominator) {
+            denominatorValues.resize(numberOfPoints);
+            evaluatePolynomial(function.denominator.value(), parameterValues, numberOfPoints, denominatorValues.begin(), termValues);
+            for (uint64_t point = 0; point < numberOfPoints; ++point) {
+                functionValuesIt[point] /= denominatorValues[point];
+            }
+        }
+        functionValuesIt += numberOfPoints;
+    }
+}
+
+template<typename ConstantType>
+void CompiledRationalFunctions<ConstantType>::evaluatePolynomial(uint64_t polynomial, std::vector<ConstantType> const& parameterValues,
+                                                                 uint64_t numberOfPoints, typename std::vector<ConstantType>::iterator result,
+                                                                 std::vector<ConstantType>& termValues) const {
+    std::fill(result, result + numberOfPoints, storm::utility::zero<ConstantType>());
+    for (uint64_t term = polynomialTermIndices[polynomial]; term < polynomialTermIndices[polynomial + 1]; ++term) {
+        std::fill(termValues.begin(), termValues.end(), termCoefficients[term]);
+        for (uint64_t factor = termFactorIndices[term]; factor < termFactorIndices[term + 1]; ++factor) {
+            auto const parameterValuesIt = parameterValues.begin() + factors[factor].first * numberOfPoints;
+            // Exponents are typically small, so repeated multiplication is cheaper than calling pow and keeps the loop over the points vectorizable.
+            for (uint64_t exponent = 0; exponent < factors[factor].second; ++exponent) {
+                for (uint64_t point = 0; point < numberOfPoints; ++point) {
+                    termValues[point] *= parameterValuesIt[point];
+                }
+            }
+        }
+        for (uint64_t point = 0; point < numberOfPoints; ++point) {
+            result[point] += termValues[point];
+        }
+    }
+}
+
+template class CompiledRationalFunctions<double>;
+template class CompiledRationalFunctions<storm::RationalNumber>;
+
+}  // namespace utility
+}  // namespace storm
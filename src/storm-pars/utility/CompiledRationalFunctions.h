@@ -0,0 +1,104 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+#include "storm/adapters/RationalFunctionForward.h"
+
+namespace storm {
+namespace utility {
+
+/*!
+ * This class compiles rational functions into a flat representation that can be evaluated without the polynomial arithmetic of the underlying library.
+ * Each polynomial is stored as a list of terms consisting of a coefficient (converted to ConstantType) and the exponents of the occurring parameters.
+ * Constant denominators are folded into the coefficients of the numerator.
+ *
+ * Functions can be evaluated for many points at once. In this case, the innermost loops range over the points which allows the compiler to vectorize them.
+ */
+template<typename ConstantType>
+class CompiledRationalFunctions {
+   public:
+    typedef typename storm::utility::parametric::VariableType<storm::RationalFunction>::type VariableType;
+
+    CompiledRationalFunctions() = default;
+
+    /*!
+     * Compiles the given function.
+     * @return The index of the compiled function
+     */
+    uint64_t addFunction(storm::RationalFunction const& function);
+
+    /*!
+     * Retrieves the number of compiled functions.
+     */
+    uint64_t getNumberOfFunctions() const;
+
+    /*!
+     * Retrieves the parameters occurring in the compiled functions in the order in which their values are expected during evaluation.
+     */
+    std::vector<VariableType> const& getParameters() const;
+
+    /*!
+     * Retrieves the values of the occurring parameters (in the order given by getParameters()) w.r.t. the given valuation.
+     */
+    std::vector<ConstantType> getParameterValues(storm::utility::parametric::Valuation<storm::RationalFunction> const& valuation) const;
+
+    /*!
+     * Evaluates all compiled functions at a single point.
+     * @param parameterValues The values of the parameters (in the order given by getParameters()).
+     * @param functionValues Is resized such that the i-th entry is the value of the i-th function.
+     */
+    void evaluate(std::vector<ConstantType> const& parameterValues, std::vector<ConstantType>& functionValues) const;
+
+    /*!
+     * Evaluates all compiled functions at the given number of points.
+     * @param parameterValues The values of the parameters, where the value of the j-th parameter (in the order given by getParameters()) at the i-th point
+     * is stored at position j * numberOfPoints + i.
+     * @param numberOfPoints The number of points.
+     * @param functionValues Is resized such that the value of the k-th function at the i-th point is stored at position k * numberOfPoints + i.
+     */
+    void evaluate(std::vector<ConstantType> const& parameterValues, uint64_t numberOfPoints, std::vector<ConstantType>& functionValues) const;
+
+   private:
+    struct CompiledFunction {
+        uint64_t numerator;
+        // Not set if the denominator is constant.
+        std::optional<uint64_t> denominator;
+    };
+
+    /*!
+     * Compiles the given polynomial, where each coefficient is divided by the given divisor.
+     * @return the index of the compiled polynomial
+     */
+    uint64_t addPolynomial(storm::RawPolynomial const& polynomial, storm::RationalFunctionCoefficient const& divisor);
+
+    /*!
+     * Retrieves the index of the given parameter and inserts it if it has not been seen before.
+     */
+    uint64_t getParameterIndex(VariableType const& parameter);
+
+    /*!
+     * Evaluates the given polynomial at all points and writes the result to the given range of size numberOfPoints.
+     */
+    void evaluatePolynomial(uint64_t polynomial, std::vector<ConstantType> const& parameterValues, uint64_t numberOfPoints,
+                            typename std::vector<ConstantType>::iterator result, std::vector<ConstantType>& termValues) const;
+
+    std::vector<CompiledFunction> functions;
+
+    // The terms of the i-th polynomial are the ones with index polynomialTermIndices[i] to polynomialTermIndices[i+1]-1.
+    std::vector<uint64_t> polynomialTermIndices = {0};
+    std::vector<ConstantType> termCoefficients;
+    // The factors of the i-th term are the ones with index termFactorIndices[i] to termFactorIndices[i+1]-1.
+    std::vector<uint64_t> termFactorIndices = {0};
+    // Each factor consists of a parameter index and the exponent of that parameter.
+    std::vector<std::pair<uint64_t, uint64_t>> factors;
+
+    std::vector<VariableType> parameters;
+    std::map<VariableType, uint64_t> parameterIndices;
+};
+
+}  // namespace utility
+}  // namespace storm
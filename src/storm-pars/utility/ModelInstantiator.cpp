@@ -140,11 +140,35 @@ void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::init
 }
 
 template<typename ParametricSparseModelType, typename ConstantSparseModelType>
-ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiate(
-    storm::utility::parametric::Valuation<ParametricType> const& valuation) {
-    // Write results into the placeholders
-    instantiate_helper(valuation);
+void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::initializeOccurringFunctions() {
+    if (occurringFunctionPlaceholders.size() == this->functions.size()) {
+        // Already initialized.
+        return;
+    }
+    std::unordered_map<ConstantType const*, ParametricType const*> placeholderToFunction;
+    for (auto const& functionResult : this->functions) {
+        placeholderToFunction.emplace(&functionResult.second, &functionResult.first);
+    }
+    // The mappings are filled while traversing the parametric model, so their order does not depend on the hashing of the functions.
+    auto addPlaceholder = [&](ConstantType* placeholder) {
+        auto& function = placeholderToFunction.at(placeholder);
+        if (function != nullptr) {
+            occurringFunctions.push_back(*function);
+            occurringFunctionPlaceholders.push_back(placeholder);
+            function = nullptr;
+        }
+    };
+    for (auto const& entryValuePair : this->matrixMapping) {
+        addPlaceholder(entryValuePair.second);
+    }
+    for (auto const& entryValuePair : this->vectorMapping) {
+        addPlaceholder(entryValuePair.second);
+    }
+    STORM_LOG_ASSERT(occurringFunctions.size() == this->functions.size(), "Unexpected number of occurring functions.");
+}
 
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+void ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::writePlaceholdersToModel() {
     // Write the instantiated values to the matrices and vectors according to the stored mappings
     for (auto& entryValuePair : this->matrixMapping) {
         entryValuePair.first->setValue(*(entryValuePair.second));
@@ -152,7 +176,35 @@ ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, Cons
     for (auto& entryValuePair : this->vectorMapping) {
         *(entryValuePair.first) = *(entryValuePair.second);
     }
+}
+
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiate(
+    storm::utility::parametric::Valuation<ParametricType> const& valuation) {
+    // Write results into the placeholders
+    instantiate_helper(valuation);
+    writePlaceholdersToModel();
+    return *this->instantiatedModel;
+}
 
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+std::vector<typename ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::ParametricType> const&
+ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::getOccurringFunctions() {
+    initializeOccurringFunctions();
+    return occurringFunctions;
+}
+
+template<typename ParametricSparseModelType, typename ConstantSparseModelType>
+ConstantSparseModelType const& ModelInstantiator<ParametricSparseModelType, ConstantSparseModelType>::instantiate(
+    std::vector<ConstantType> const& functionValues) {
+    initializeOccurringFunctions();
+    STORM_LOG_ASSERT(functionValues.size() == occurringFunctionPlaceholders.size(), "Unexpected number of function values.");
+    auto valueIt = functionValues.begin();
+    for (auto& placeholder : occurringFunctionPlaceholders) {
+        *placeholder = *valueIt;
+        ++valueIt;
+    }
+    writePlaceholdersToModel();
     return *this->instantiatedModel;
 }
 
@@ -48,6 +48,20 @@ class ModelInstantiator {
      */
     ConstantSparseModelType const& instantiate(storm::utility::parametric::Valuation<ParametricType> const& valuation);
 
+    /*!
+     * Retrieves the distinct non-constant functions occurring in the model.
+     * The order of the functions only depends on the parametric model, i.e., it is the same for all instantiators of the same model.
+     * The functions are collected upon the first call.
+     */
+    std::vector<ParametricType> const& getOccurringFunctions();
+
+    /*!
+     * Retrieves the instantiated model, where the i-th occurring function (as given by getOccurringFunctions()) evaluates to the i-th given value.
+     * @param functionValues The values of the occurring functions
+     * @return The instantiated model
+     */
+    ConstantSparseModelType const& instantiate(std::vector<ConstantType> const& functionValues);
+
     /*!
      *  Check validity
      */
@@ -177,6 +191,17 @@ class ModelInstantiator {
                                  std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>>& mapping,
                                  std::vector<ParametricType> const& parametricVector) const;
 
+    /*!
+     * Fixes an order of the occurring functions that only depends on the order in which they are encountered in the parametric model.
+     * Does nothing if the order has already been fixed.
+     */
+    void initializeOccurringFunctions();
+
+    /*!
+     * Writes the current values of the placeholders to the instantiated model.
+     */
+    void writePlaceholdersToModel();
+
     /// The resulting model
     std::shared_ptr<ConstantSparseModelType> instantiatedModel;
     /// the occurring functions together with the corresponding placeholders for their evaluated result
@@ -185,6 +210,9 @@ class ModelInstantiator {
     std::vector<std::pair<typename storm::storage::SparseMatrix<ConstantType>::iterator, ConstantType*>> matrixMapping;
     /// Connection of Vector entries with placeholders
     std::vector<std::pair<typename std::vector<ConstantType>::iterator, ConstantType*>> vectorMapping;
+    /// The occurring functions in a fixed order together with their placeholders (only initialized if needed)
+    std::vector<ParametricType> occurringFunctions;
+    std::vector<ConstantType*> occurringFunctionPlaceholders;
 };
 }  // Namespace utility
 }  // namespace storm
@@ -14,6 +14,7 @@ const std::string BeliefExplorationSettings::moduleName = "beliefExploration";
 
 const std::string refineOption = "refine";
 const std::string explorationTimeLimitOption = "exploration-time";
+const std::string explorationThreadsOption = "exploration-threads";
 const std::string resolutionOption = "resolution";
 const std::string clipGridResolutionOption = "clip-resolution";
 const std::string sizeThresholdOption = "size-threshold";
@@ -46,6 +47,15 @@ BeliefExplorationSettings::BeliefExplorationSettings() : ModuleSettings(moduleNa
             .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("time", "In seconds.").setDefaultValueUnsignedInteger(0).build())
             .build());
 
+    this->addOption(storm::settings::OptionBuilder(moduleName, explorationThreadsOption, false,
+                                                   "Sets the number of threads used to expand and triangulate beliefs during the exploration of the "
+                                                   "over-approximation. The explored MDP does not depend on this number.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+
     this->addOption(
         storm::settings::OptionBuilder(moduleName, resolutionOption, false,
                                        "Sets the resolution of the discretization and how it is increased in case of refinement")
@@ -179,6 +189,10 @@ uint64_t BeliefExplorationSettings::getExplorationTimeLimit() const {
     return this->getOption(explorationTimeLimitOption).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+uint64_t BeliefExplorationSettings::getExplorationThreads() const {
+    return this->getOption(explorationThreadsOption).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 uint64_t BeliefExplorationSettings::getResolutionInit() const {
     return this->getOption(resolutionOption).getArgumentByName("init").getValueAsUnsignedInteger();
 }
@@ -253,6 +267,7 @@ void BeliefExplorationSettings::setValuesInOptionsStruct(storm::pomdp::modelchec
     options.refinePrecision = storm::utility::convertNumber<ValueType>(getRefinePrecision());
     options.refineStepLimit = getRefineStepLimit();
     options.explorationTimeLimit = getExplorationTimeLimit();
+    options.explorationThreads = getExplorationThreads();
 
     options.clippingGridRes = getClippingGridResolution();
     options.resolutionInit = getResolutionInit();
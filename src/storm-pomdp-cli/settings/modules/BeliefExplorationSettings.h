@@ -39,6 +39,8 @@ class BeliefExplorationSettings : public ModuleSettings {
 
     uint64_t getExplorationTimeLimit() const;
 
+    uint64_t getExplorationThreads() const;
+
     /// Discretization Resolution
     uint64_t getResolutionInit() const;
     double getResolutionFactor() const;
@@ -273,6 +273,18 @@ typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId BeliefMdpExplor
     return mdpStateToBeliefIdMap[currentMdpState];
 }
 
+template<typename PomdpType, typename BeliefValueType>
+std::vector<typename BeliefMdpExplorer<PomdpType, BeliefValueType>::BeliefId> BeliefMdpExplorer<PomdpType, BeliefValueType>::getBeliefsToExploreNext(
+    uint64_t maxNumberOfBeliefs) const {
+    STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
+    std::vector<BeliefId> result;
+    // The queue is processed starting with the highest priority (see exploreNextState)
+    for (auto stateIt = mdpStatesToExplorePrioState.rbegin(); stateIt != mdpStatesToExplorePrioState.rend() && result.size() < maxNumberOfBeliefs; ++stateIt) {
+        result.push_back(mdpStateToBeliefIdMap[stateIt->second]);
+    }
+    return result;
+}
+
 template<typename PomdpType, typename BeliefValueType>
 void BeliefMdpExplorer<PomdpType, BeliefValueType>::addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue,
                                                                                 ValueType const &bottomStateValue) {
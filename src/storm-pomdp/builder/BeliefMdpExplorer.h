@@ -65,6 +65,12 @@ class BeliefMdpExplorer {
 
     BeliefId exploreNextState();
 
+    /*!
+     * Retrieves the beliefs of (at most) the given number of states that are explored next according to the current exploration queue.
+     * States that are added to the queue later might still be explored before these states.
+     */
+    std::vector<BeliefId> getBeliefsToExploreNext(uint64_t maxNumberOfBeliefs) const;
+
     void addChoiceLabelToCurrentState(uint64_t const &localActionIndex, std::string const &label);
 
     void addTransitionsToExtraStates(uint64_t const &localActionIndex, ValueType const &targetStateValue = storm::utility::zero<ValueType>(),
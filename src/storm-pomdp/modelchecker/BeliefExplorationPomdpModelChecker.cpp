@@ -840,6 +840,8 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
     bool timeLimitExceeded = false;
     std::map<uint32_t, typename ExplorerType::SuccessorObservationInformation> gatheredSuccessorObservations;  // Declare here to avoid reallocations
     uint64_t numRewiredOrExploredStates = 0;
+    // The number of upcoming beliefs that are expanded in advance if multiple threads are used
+    uint64_t const explorationBatchSize = 256;
     while (overApproximation->hasUnexploredState()) {
         if (!timeLimitExceeded && options.explorationTimeLimit != 0 &&
             static_cast<uint64_t>(explorationTime.getTimeInSeconds()) > options.explorationTimeLimit) {
@@ -850,6 +852,17 @@ bool BeliefExplorationPomdpModelChecker<PomdpModelType, BeliefValueType, BeliefM
         }
 
         uint64_t currId = overApproximation->exploreNextState();
+        if (options.explorationThreads != 1 && targetObservations.count(beliefManager->getBeliefObservation(currId)) == 0 &&
+            !beliefManager->hasPreparedTriangulatedExpansions(currId, observationResolutionVector)) {
+            // Expand and triangulate the current and the upcoming beliefs concurrently. Beliefs with a target observation are not expanded.
+            std::vector<typename BeliefManagerType::BeliefId> beliefsToPrepare = {currId};
+            for (auto const& beliefId : overApproximation->getBeliefsToExploreNext(explorationBatchSize)) {
+                if (targetObservations.count(beliefManager->getBeliefObservation(beliefId)) == 0) {
+                    beliefsToPrepare.push_back(beliefId);
+                }
+            }
+            beliefManager->prepareTriangulatedExpansions(beliefsToPrepare, observationResolutionVector, options.explorationThreads);
+        }
         bool hasOldBehavior = refine && overApproximation->currentStateHasOldBehavior();
         if (!hasOldBehavior) {
             STORM_LOG_INFO_COND(!fixPoint, "Not reaching a refinement fixpoint because a new state is explored");
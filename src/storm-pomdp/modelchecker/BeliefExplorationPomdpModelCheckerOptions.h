@@ -29,6 +29,8 @@ struct BeliefExplorationPomdpModelCheckerOptions {
     uint64_t refineStepLimit = 0;
     ValueType refinePrecision = storm::utility::convertNumber<ValueType>(1e-4);
     uint64_t explorationTimeLimit = 0;
+    // The number of threads used to expand and triangulate beliefs of the over-approximation in advance (0 means auto-detect)
+    uint64_t explorationThreads = 1;
 
     // Control parameters for the refinement heuristic
     // Discretization Resolution
@@ -1,10 +1,13 @@
 #include "storm-pomdp/storage/BeliefManager.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/models/sparse/Pomdp.h"
 #include "storm/solver/GlpkLpSolver.h"
 #include "storm/storage/expressions/Expression.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -15,6 +18,34 @@ uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation::si
     return weights.size();
 }
 
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::BeliefView(EntryType const *first, EntryType const *last) : first(first), last(last) {
+    // Intentionally left empty
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::BeliefView(BeliefType const &belief)
+    : first(belief.empty() ? nullptr : &*belief.begin()), last(first + belief.size()) {
+    // Intentionally left empty
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::EntryType const *
+BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::begin() const {
+    return first;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::EntryType const *
+BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::end() const {
+    return last;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView::size() const {
+    return last - first;
+}
+
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 BeliefManager<PomdpType, BeliefValueType, StateType>::FreudenthalDiff::FreudenthalDiff(StateType const &dimension, BeliefValueType diff)
     : dimension(dimension), diff(std::move(diff)) {
@@ -31,13 +62,13 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::FreudenthalDiff::oper
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::Belief_equal_to::operator()(const BeliefType &lhBelief, const BeliefType &rhBelief) const {
-    return lhBelief == rhBelief;
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::Belief_equal_to::operator()(BeliefView const &lhBelief, BeliefView const &rhBelief) const {
+    return std::equal(lhBelief.begin(), lhBelief.end(), rhBelief.begin(), rhBelief.end());
 }
 
 template<>
-bool BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::Belief_equal_to::operator()(const BeliefType &lhBelief,
-                                                                                                        const BeliefType &rhBelief) const {
+bool BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::Belief_equal_to::operator()(BeliefView const &lhBelief,
+                                                                                                        BeliefView const &rhBelief) const {
     // If the sizes are different, we don't have to look inside the belief
     if (lhBelief.size() != rhBelief.size()) {
         return false;
@@ -57,7 +88,7 @@ bool BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::Beli
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(const BeliefType &belief) const {
+std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(BeliefView const &belief) const {
     std::size_t seed = 0;
     // Assumes that beliefs are ordered
     for (auto const &entry : belief) {
@@ -68,7 +99,7 @@ std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::op
 }
 
 template<>
-std::size_t BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::BeliefHash::operator()(const BeliefType &belief) const {
+std::size_t BeliefManager<storm::models::sparse::Pomdp<double>, double, uint64_t>::BeliefHash::operator()(BeliefView const &belief) const {
     std::size_t seed = 0;
     // Assumes that beliefs are ordered
     for (auto const &entry : belief) {
@@ -82,7 +113,8 @@ template<typename PomdpType, typename BeliefValueType, typename StateType>
 BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision,
                                                                     TriangulationMode const &triangulationMode)
     : pomdp(pomdp), cc(precision, false), triangulationMode(triangulationMode) {
-    beliefToIdMap.resize(pomdp.getNrObservations());
+    beliefOffsets.push_back(0);
+    beliefIdsByHash.resize(pomdp.getNrObservations());
     initialBeliefId = computeInitialBelief();
 }
 
@@ -132,7 +164,8 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType BeliefM
     BeliefId const &beliefId, std::vector<ValueType> const &summands) {
     auto result = storm::utility::zero<ValueType>();
     for (auto const &entry : getBelief(beliefId)) {
-        result += storm::utility::convertNumber<ValueType>(entry.second) * storm::utility::convertNumber<ValueType>(summands.at(entry.first));
+        STORM_LOG_ASSERT(entry.first < summands.size(), "Belief refers to state " << entry.first << " which has no summand.");
+        result += storm::utility::convertNumber<ValueType>(entry.second) * storm::utility::convertNumber<ValueType>(summands[entry.first]);
     }
     return result;
 }
@@ -145,7 +178,7 @@ std::pair<bool, typename BeliefManager<PomdpType, BeliefValueType, StateType>::V
     for (auto const &entry : getBelief(beliefId)) {
         auto probIter = summands.find(entry.first);
         if (probIter != summands.end()) {
-            result += storm::utility::convertNumber<ValueType>(entry.second) * storm::utility::convertNumber<ValueType>(summands.at(entry.first));
+            result += storm::utility::convertNumber<ValueType>(entry.second) * storm::utility::convertNumber<ValueType>(probIter->second);
         } else {
             successful = false;
             break;
@@ -189,12 +222,15 @@ uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefNumberOf
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
     BeliefId beliefId, BeliefValueType resolution) {
-    return triangulateBelief(getBelief(beliefId), resolution);
+    // Adding the grid points invalidates views on stored beliefs, so we triangulate a copy
+    auto belief = getBelief(beliefId);
+    return triangulateBelief(BeliefType(boost::container::ordered_unique_range, belief.begin(), belief.end()), resolution);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 template<typename DistributionType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(DistributionType &distr, StateType const &state,
+                                                                             BeliefValueType const &value) const {
     auto insertionRes = distr.emplace(state, value);
     if (!insertionRes.second) {
         insertionRes.first->second += value;
@@ -203,7 +239,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::addToDistribution(Dis
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 template<typename DistributionType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(DistributionType &distr) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::adjustDistribution(DistributionType &distr) const {
     if (distr.size() == 1 && cc.isEqual(distr.begin()->second, storm::utility::one<BeliefValueType>())) {
         // If the distribution consists of only one entry and its value is sufficiently close to 1, make it exactly 1 to avoid numerical problems
         distr.begin()->second = storm::utility::one<BeliefValueType>();
@@ -220,7 +256,7 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::joinSupport(BeliefId
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getNumberOfBeliefIds() const {
-    return beliefs.size();
+    return beliefOffsets.size() - 1;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -228,7 +264,68 @@ std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateTy
                       typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType>>
 BeliefManager<PomdpType, BeliefValueType, StateType>::expandAndTriangulate(BeliefId const &beliefId, uint64_t actionIndex,
                                                                            std::vector<BeliefValueType> const &observationResolutions) {
-    return expandInternal(beliefId, actionIndex, observationResolutions);
+    auto preparedIt = preparedExpansions.find(std::make_pair(beliefId, actionIndex));
+    if (preparedIt == preparedExpansions.end() || preparedExpansionsResolutions != observationResolutions) {
+        return expandInternal(beliefId, actionIndex, observationResolutions);
+    }
+    // The grid points need to be registered in the same order as in expandInternal to get the same ids.
+    std::vector<std::pair<BeliefId, ValueType>> destinations;
+    destinations.reserve(preparedIt->second.size());
+    for (auto const &gridPoint : preparedIt->second) {
+        destinations.emplace_back(getOrAddBeliefId(gridPoint.first), storm::utility::convertNumber<ValueType>(gridPoint.second));
+    }
+    preparedExpansions.erase(preparedIt);
+    return destinations;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+void BeliefManager<PomdpType, BeliefValueType, StateType>::prepareTriangulatedExpansions(std::vector<BeliefId> const &beliefIds,
+                                                                                         std::vector<BeliefValueType> const &observationResolutions,
+                                                                                         uint64_t numberOfThreads) {
+    if (preparedExpansionsResolutions != observationResolutions) {
+        preparedExpansions.clear();
+        preparedExpansionsResolutions = observationResolutions;
+    }
+    // Successors that are still prepared for one of the given beliefs are kept. The remaining ones belong to beliefs that have been explored without
+    // being expanded (or that are no longer about to be explored), so they are dropped.
+    decltype(preparedExpansions) keptExpansions;
+    std::vector<std::pair<BeliefId, uint64_t>> beliefActionPairs;
+    for (auto const &beliefId : beliefIds) {
+        for (uint64_t actionIndex = 0, numActions = getBeliefNumberOfChoices(beliefId); actionIndex < numActions; ++actionIndex) {
+            auto preparedIt = preparedExpansions.find(std::make_pair(beliefId, actionIndex));
+            if (preparedIt != preparedExpansions.end()) {
+                keptExpansions.insert(preparedExpansions.extract(preparedIt));
+            } else {
+                beliefActionPairs.emplace_back(beliefId, actionIndex);
+            }
+        }
+    }
+    preparedExpansions = std::move(keptExpansions);
+
+    // The computation does not modify this manager, so the tasks only write their own entry of the results.
+    std::vector<std::vector<std::pair<BeliefType, BeliefValueType>>> results(beliefActionPairs.size());
+    auto computeSuccessors = [&](uint64_t taskIndex, uint64_t) {
+        auto const &[beliefId, actionIndex] = beliefActionPairs[taskIndex];
+        results[taskIndex] = computeTriangulatedSuccessors(getBelief(beliefId), actionIndex, observationResolutions);
+    };
+    // Exact numbers might share reference counted data (e.g. the probabilities of the POMDP), which is not safe to be accessed concurrently.
+    if (numberOfThreads != 1 && std::is_same_v<ValueType, double> && std::is_same_v<BeliefValueType, double>) {
+        storm::utility::ThreadPool::getShared(numberOfThreads)->parallelFor(beliefActionPairs.size(), computeSuccessors);
+    } else {
+        for (uint64_t taskIndex = 0; taskIndex < beliefActionPairs.size(); ++taskIndex) {
+            computeSuccessors(taskIndex, 0);
+        }
+    }
+
+    for (uint64_t taskIndex = 0; taskIndex < beliefActionPairs.size(); ++taskIndex) {
+        preparedExpansions.emplace(beliefActionPairs[taskIndex], std::move(results[taskIndex]));
+    }
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::hasPreparedTriangulatedExpansions(BeliefId const &beliefId,
+                                                                                             std::vector<BeliefValueType> const &observationResolutions) const {
+    return preparedExpansions.count({beliefId, 0}) != 0 && preparedExpansionsResolutions == observationResolutions;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -247,25 +344,27 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expand(BeliefId const &bel
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(
     BeliefId const &id) const {
     STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existent belief.");
     STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-    return beliefs[id];
+    return BeliefView(beliefEntries.data() + beliefOffsets[id], beliefEntries.data() + beliefOffsets[id + 1]);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(
-    BeliefType const &belief) const {
+    BeliefView const &belief) const {
     uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto idIt = beliefToIdMap[obs].find(belief);
-    STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
+    STORM_LOG_ASSERT(obs < beliefIdsByHash.size(), "Belief has unknown observation.");
+    auto candidates = beliefIdsByHash[obs].equal_range(BeliefHash()(belief));
+    auto idIt = std::find_if(candidates.first, candidates.second,
+                             [&](auto const &candidate) { return Belief_equal_to()(getBelief(candidate.second), belief); });
+    STORM_LOG_ASSERT(idIt != candidates.second, "Unknown Belief.");
     return idIt->second;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefType const &belief) const {
+std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefView const &belief) const {
     std::stringstream str;
     str << "{ ";
     bool first = true;
@@ -282,7 +381,7 @@ std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(Belie
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefType const &first, BeliefType const &second) const {
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefView const &first, BeliefView const &second) const {
     if (first.size() != second.size()) {
         return false;
     }
@@ -300,7 +399,7 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefType co
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefType const &belief) const {
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefView const &belief) const {
     auto sum = storm::utility::zero<BeliefValueType>();
     std::optional<uint32_t> observation;
     for (auto const &entry : belief) {
@@ -341,7 +440,7 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertBelief(BeliefTy
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const {
+bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(BeliefView const &belief, Triangulation const &triangulation) const {
     if (triangulation.weights.size() != triangulation.gridPoints.size()) {
         STORM_LOG_ERROR("Number of weights and points in triangulation does not match.");
         return false;
@@ -365,7 +464,7 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(B
             STORM_LOG_ERROR("Weight greater than one in triangulation.");
         }
         weightSum += triangulation.weights[i];
-        BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
+        BeliefView gridPoint = getBelief(triangulation.gridPoints[i]);
         for (auto const &pointEntry : gridPoint) {
             BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<BeliefValueType>()).first->second;
             triangulatedValue += triangulation.weights[i] * pointEntry.second;
@@ -386,14 +485,14 @@ bool BeliefManager<PomdpType, BeliefValueType, StateType>::assertTriangulation(B
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefView const &belief) const {
     STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
     return pomdp.getObservation(belief.begin()->first);
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution,
-                                                                                        Triangulation &result) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreudenthal(BeliefView const &belief, BeliefValueType const &resolution,
+                                                                                        UnresolvedTriangulation &result) const {
     STORM_LOG_ASSERT(resolution != 0, "Invalid resolution: 0");
     STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
     StateType numEntries = belief.size();
@@ -442,15 +541,15 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefFreu
                     gridPoint[toOriginalIndicesMap[j]] = gridPointEntry / resolution;
                 }
             }
-            result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+            result.gridPoints.push_back(std::move(gridPoint));
         }
         previousSortedDiff = currentSortedDiff++;
     }
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution,
-                                                                                    Triangulation &result) {
+void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDynamic(BeliefView const &belief, BeliefValueType const &resolution,
+                                                                                    UnresolvedTriangulation &result) const {
     // Find the best resolution for this belief, i.e., N such that the largest distance between one of the belief values to a value in {i/N | 0 ≤ i ≤ N} is
     // minimal
     STORM_LOG_ASSERT(storm::utility::isInteger(resolution), "Expected an integer resolution");
@@ -488,14 +587,14 @@ void BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBeliefDyna
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
-    BeliefType const &belief, BeliefValueType const &resolution) {
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::UnresolvedTriangulation
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeTriangulation(BeliefView const &belief, BeliefValueType const &resolution) const {
     STORM_LOG_ASSERT(assertBelief(belief), "Input belief for triangulation is not valid.");
-    Triangulation result;
+    UnresolvedTriangulation result;
     // Quickly triangulate Dirac beliefs
     if (belief.size() == 1u) {
         result.weights.push_back(storm::utility::one<BeliefValueType>());
-        result.gridPoints.push_back(getOrAddBeliefId(belief));
+        result.gridPoints.emplace_back(boost::container::ordered_unique_range, belief.begin(), belief.end());
     } else {
         auto ceiledResolution = storm::utility::ceil<BeliefValueType>(resolution);
         switch (triangulationMode) {
@@ -509,6 +608,19 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation Bel
                 STORM_LOG_ASSERT(false, "Invalid triangulation mode.");
         }
     }
+    return result;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(
+    BeliefView const &belief, BeliefValueType const &resolution) {
+    UnresolvedTriangulation unresolvedTriangulation = computeTriangulation(belief, resolution);
+    Triangulation result;
+    result.weights = std::move(unresolvedTriangulation.weights);
+    result.gridPoints.reserve(unresolvedTriangulation.gridPoints.size());
+    for (auto const &gridPoint : unresolvedTriangulation.gridPoints) {
+        result.gridPoints.push_back(getOrAddBeliefId(gridPoint));
+    }
     STORM_LOG_ASSERT(assertTriangulation(belief, result), "Incorrect triangulation: " << toString(result));
     return result;
 }
@@ -521,7 +633,42 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
                                                                      std::optional<std::vector<uint64_t>> const &observationGridClippingResolutions) {
     std::vector<std::pair<BeliefId, ValueType>> destinations;
 
-    BeliefType belief = getBelief(beliefId);
+    // Now for each successor observation we find and potentially triangulate the successor belief.
+    // Note that the successors are computed before new beliefs are added (which might invalidate references to existing beliefs).
+    for (auto const &successor : computeSuccessorBeliefs(getBelief(beliefId), actionIndex)) {
+        BeliefType const &successorBelief = successor.first;
+        uint32_t successorObservation = pomdp.getObservation(successorBelief.begin()->first);
+
+        // Insert the destination. We know that destinations have to be disjoint since they have different observations
+        if (observationTriangulationResolutions) {
+            Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.value()[successorObservation]);
+            for (size_t j = 0; j < triangulation.size(); ++j) {
+                // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
+                BeliefValueType a = triangulation.weights[j] * successor.second;
+                destinations.emplace_back(triangulation.gridPoints[j], storm::utility::convertNumber<ValueType>(a));
+            }
+        } else if (observationGridClippingResolutions) {
+            BeliefClipping clipping = clipBeliefToGrid(successorBelief, observationGridClippingResolutions.value()[successorObservation],
+                                                       storm::storage::BitVector(pomdp.getNumberOfStates()));
+            if (clipping.isClippable) {
+                BeliefValueType a = (storm::utility::one<BeliefValueType>() - clipping.delta) * successor.second;
+                destinations.emplace_back(clipping.targetBelief, storm::utility::convertNumber<ValueType>(a));
+            } else {
+                // Belief on Grid
+                destinations.emplace_back(getOrAddBeliefId(successorBelief), storm::utility::convertNumber<ValueType>(successor.second));
+            }
+        } else {
+            destinations.emplace_back(getOrAddBeliefId(successorBelief), storm::utility::convertNumber<ValueType>(successor.second));
+        }
+    }
+
+    return destinations;
+}
+
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType, BeliefValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeSuccessorBeliefs(BeliefView const &belief, uint64_t actionIndex) const {
+    std::vector<std::pair<BeliefType, BeliefValueType>> successors;
 
     // Find the probability we go to each observation
     BeliefType successorObs;  // This is actually not a belief but has the same type
@@ -536,7 +683,8 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
     }
     adjustDistribution(successorObs);
 
-    // Now for each successor observation we find and potentially triangulate the successor belief
+    // Now for each successor observation we find the successor belief
+    successors.reserve(successorObs.size());
     for (auto const &successor : successorObs) {
         BeliefType successorBelief;
         for (auto const &pointEntry : belief) {
@@ -550,46 +698,41 @@ BeliefManager<PomdpType, BeliefValueType, StateType>::expandInternal(BeliefId co
         }
         adjustDistribution(successorBelief);
         STORM_LOG_ASSERT(assertBelief(successorBelief), "Invalid successor belief.");
+        successors.emplace_back(std::move(successorBelief), successor.second);
+    }
+    return successors;
+}
 
-        // Insert the destination. We know that destinations have to be disjoint since they have different observations
-        if (observationTriangulationResolutions) {
-            Triangulation triangulation = triangulateBelief(successorBelief, observationTriangulationResolutions.value()[successor.first]);
-            for (size_t j = 0; j < triangulation.size(); ++j) {
-                // Here we additionally assume that triangulation.gridPoints does not contain the same point multiple times
-                BeliefValueType a = triangulation.weights[j] * successor.second;
-                destinations.emplace_back(triangulation.gridPoints[j], storm::utility::convertNumber<ValueType>(a));
-            }
-        } else if (observationGridClippingResolutions) {
-            BeliefClipping clipping = clipBeliefToGrid(successorBelief, observationGridClippingResolutions.value()[successor.first],
-                                                       storm::storage::BitVector(pomdp.getNumberOfStates()));
-            if (clipping.isClippable) {
-                BeliefValueType a = (storm::utility::one<BeliefValueType>() - clipping.delta) * successor.second;
-                destinations.emplace_back(clipping.targetBelief, storm::utility::convertNumber<ValueType>(a));
-            } else {
-                // Belief on Grid
-                destinations.emplace_back(getOrAddBeliefId(successorBelief), storm::utility::convertNumber<ValueType>(successor.second));
-            }
-        } else {
-            destinations.emplace_back(getOrAddBeliefId(successorBelief), storm::utility::convertNumber<ValueType>(successor.second));
+template<typename PomdpType, typename BeliefValueType, typename StateType>
+std::vector<std::pair<typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType, BeliefValueType>>
+BeliefManager<PomdpType, BeliefValueType, StateType>::computeTriangulatedSuccessors(BeliefView const &belief, uint64_t actionIndex,
+                                                                                    std::vector<BeliefValueType> const &observationResolutions) const {
+    std::vector<std::pair<BeliefType, BeliefValueType>> gridPoints;
+    for (auto const &successor : computeSuccessorBeliefs(belief, actionIndex)) {
+        uint32_t successorObservation = pomdp.getObservation(successor.first.begin()->first);
+        UnresolvedTriangulation triangulation = computeTriangulation(successor.first, observationResolutions[successorObservation]);
+        for (size_t j = 0; j < triangulation.gridPoints.size(); ++j) {
+            gridPoints.emplace_back(std::move(triangulation.gridPoints[j]), triangulation.weights[j] * successor.second);
         }
     }
-
-    return destinations;
+    return gridPoints;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping BeliefManager<PomdpType, BeliefValueType, StateType>::clipBeliefToGrid(
     BeliefId const &beliefId, uint64_t resolution, storm::storage::BitVector isInfinite) {
-    auto res = clipBeliefToGrid(getBelief(beliefId), resolution, isInfinite);
+    // Adding the target belief invalidates views on stored beliefs, so we clip a copy
+    auto belief = getBelief(beliefId);
+    auto res = clipBeliefToGrid(BeliefType(boost::container::ordered_unique_range, belief.begin(), belief.end()), resolution, isInfinite);
     res.startingBelief = beliefId;
     return res;
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefClipping BeliefManager<PomdpType, BeliefValueType, StateType>::clipBeliefToGrid(
-    BeliefType const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite) {
+    BeliefView const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite) {
     uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
+    STORM_LOG_ASSERT(obs < beliefIdsByHash.size(), "Belief has unknown observation.");
     if (!lpSolver) {
         lpSolver = storm::utility::solver::getLpSolver<BeliefValueType>("POMDP LP Solver");
     } else {
@@ -767,18 +910,26 @@ typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefMa
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(
-    BeliefType const &belief) {
+    BeliefView const &belief) {
     uint32_t obs = getBeliefObservation(belief);
-    STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-    auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-    if (insertioRes.second) {
-        // There actually was an insertion, so add the new belief
-        STORM_LOG_TRACE("Add Belief " << beliefs.size() << " " << toString(belief));
-        beliefs.push_back(belief);
+    STORM_LOG_ASSERT(obs < beliefIdsByHash.size(), "Belief has unknown observation.");
+    std::size_t hash = BeliefHash()(belief);
+    auto candidates = beliefIdsByHash[obs].equal_range(hash);
+    for (auto candidateIt = candidates.first; candidateIt != candidates.second; ++candidateIt) {
+        if (Belief_equal_to()(getBelief(candidateIt->second), belief)) {
+            // The belief is already known
+            return candidateIt->second;
+        }
     }
-    // Return the id
-    return insertioRes.first->second;
+    // Add the new belief to the belief store
+    BeliefId newId = getNumberOfBeliefIds();
+    STORM_LOG_TRACE("Add Belief " << newId << " " << toString(belief));
+    beliefEntries.insert(beliefEntries.end(), belief.begin(), belief.end());
+    beliefOffsets.push_back(beliefEntries.size());
+    beliefIdsByHash[obs].emplace(hash, newId);
+    return newId;
 }
+
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getRepresentativeState(BeliefId const &beliefId) {
     return getBelief(beliefId).begin()->first;
@@ -800,7 +951,7 @@ std::vector<BeliefValueType> BeliefManager<PomdpType, BeliefValueType, StateType
 }
 
 template<typename PomdpType, typename BeliefValueType, typename StateType>
-std::vector<BeliefValueType> BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefAsVector(const BeliefType &belief) {
+std::vector<BeliefValueType> BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefAsVector(BeliefView const &belief) {
     std::vector<BeliefValueType> res(pomdp.getNumberOfStates(), storm::utility::zero<BeliefValueType>());
     for (auto const &stateprob : belief) {
         res[stateprob.first] = stateprob.second;
@@ -811,9 +962,23 @@ std::vector<BeliefValueType> BeliefManager<PomdpType, BeliefValueType, StateType
 template<typename PomdpType, typename BeliefValueType, typename StateType>
 std::vector<BeliefValueType> BeliefManager<PomdpType, BeliefValueType, StateType>::computeMatrixBeliefProduct(
     const BeliefId &beliefId, storm::storage::SparseMatrix<BeliefValueType> &matrix) {
-    std::vector<BeliefValueType> beliefAsVector = getBeliefAsVector(beliefId);
-    std::vector<BeliefValueType> res(matrix.getRowCount());
-    matrix.multiplyWithVector(beliefAsVector, res);
+    auto belief = getBelief(beliefId);
+    std::vector<BeliefValueType> res(matrix.getRowCount(), storm::utility::zero<BeliefValueType>());
+    // The entries of beliefs and matrix rows are both ordered, so we can merge them instead of multiplying with the dense belief vector
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        auto beliefIt = belief.begin();
+        for (auto const &matrixEntry : matrix.getRow(row)) {
+            while (beliefIt != belief.end() && beliefIt->first < matrixEntry.getColumn()) {
+                ++beliefIt;
+            }
+            if (beliefIt == belief.end()) {
+                break;
+            }
+            if (beliefIt->first == matrixEntry.getColumn()) {
+                res[row] += matrixEntry.getValue() * beliefIt->second;
+            }
+        }
+    }
     return res;
 }
 
@@ -2,8 +2,10 @@
 
 #include <boost/container/flat_map.hpp>
 #include <boost/container/flat_set.hpp>
+#include <map>
 #include <optional>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "storm/solver/LpSolver.h"
@@ -79,7 +81,7 @@ class BeliefManager {
     Triangulation triangulateBelief(BeliefId beliefId, BeliefValueType resolution);
 
     template<typename DistributionType>
-    void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value);
+    void addToDistribution(DistributionType &distr, StateType const &state, BeliefValueType const &value) const;
 
     void joinSupport(BeliefId const &beliefId, BeliefSupportType &support);
 
@@ -88,6 +90,25 @@ class BeliefManager {
     std::vector<std::pair<BeliefId, ValueType>> expandAndTriangulate(BeliefId const &beliefId, uint64_t actionIndex,
                                                                      std::vector<BeliefValueType> const &observationResolutions);
 
+    /*!
+     * Expands and triangulates all choices of the given beliefs in advance, distributing the work among the given number of threads.
+     * Subsequent calls of expandAndTriangulate with the same resolutions take the prepared successors and only assign ids to the grid points.
+     * As ids are assigned in the order of these calls, the resulting ids are the same as without preparation.
+     * Successors prepared by a previous call of this method are kept (and not computed again) if they belong to one of the given beliefs and the
+     * resolutions did not change. All other previously prepared successors are discarded.
+     *
+     * @note Multiple threads are only used if both value types are floating point numbers.
+     * @param numberOfThreads The number of threads (0 means 'auto-detect').
+     */
+    void prepareTriangulatedExpansions(std::vector<BeliefId> const &beliefIds, std::vector<BeliefValueType> const &observationResolutions,
+                                       uint64_t numberOfThreads);
+
+    /*!
+     * Retrieves whether the choices of the given belief have been expanded and triangulated with the given resolutions in advance
+     * (and have not been taken yet).
+     */
+    bool hasPreparedTriangulatedExpansions(BeliefId const &beliefId, std::vector<BeliefValueType> const &observationResolutions) const;
+
     std::vector<std::pair<BeliefId, ValueType>> expandAndClip(BeliefId const &beliefId, uint64_t actionIndex,
                                                               std::vector<uint64_t> const &observationResolutions);
 
@@ -100,21 +121,41 @@ class BeliefManager {
     std::vector<BeliefValueType> computeMatrixBeliefProduct(BeliefId const &beliefId, storm::storage::SparseMatrix<BeliefValueType> &matrix);
 
    private:
+    /*!
+     * Read-only access to the (ordered) entries of a belief, which is either a BeliefType or a belief in the belief store of this manager.
+     * A view on a stored belief is invalidated as soon as a new belief is added to the store.
+     */
+    class BeliefView {
+       public:
+        typedef std::pair<StateType, BeliefValueType> EntryType;
+
+        BeliefView(EntryType const *first, EntryType const *last);
+        BeliefView(BeliefType const &belief);
+
+        EntryType const *begin() const;
+        EntryType const *end() const;
+        uint64_t size() const;
+
+       private:
+        EntryType const *first;
+        EntryType const *last;
+    };
+
     std::vector<BeliefValueType> getBeliefAsVector(BeliefId const &beliefId);
 
-    std::vector<BeliefValueType> getBeliefAsVector(const BeliefType &belief);
+    std::vector<BeliefValueType> getBeliefAsVector(BeliefView const &belief);
 
-    BeliefClipping clipBeliefToGrid(BeliefType const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite);
+    BeliefClipping clipBeliefToGrid(BeliefView const &belief, uint64_t resolution, const storm::storage::BitVector &isInfinite);
 
     template<typename DistributionType>
-    void adjustDistribution(DistributionType &distr);
+    void adjustDistribution(DistributionType &distr) const;
 
     struct BeliefHash {
-        std::size_t operator()(const BeliefType &belief) const;
+        std::size_t operator()(BeliefView const &belief) const;
     };
 
     struct Belief_equal_to {
-        bool operator()(const BeliefType &lhBelief, const BeliefType &rhBelief) const;
+        bool operator()(BeliefView const &lhBelief, BeliefView const &rhBelief) const;
     };
 
     struct FreudenthalDiff {
@@ -125,25 +166,47 @@ class BeliefManager {
         bool operator>(FreudenthalDiff const &other) const;
     };
 
-    BeliefType const &getBelief(BeliefId const &id) const;
+    BeliefView getBelief(BeliefId const &id) const;
 
-    BeliefId getId(BeliefType const &belief) const;
+    BeliefId getId(BeliefView const &belief) const;
 
-    std::string toString(BeliefType const &belief) const;
+    std::string toString(BeliefView const &belief) const;
 
-    bool isEqual(BeliefType const &first, BeliefType const &second) const;
+    bool isEqual(BeliefView const &first, BeliefView const &second) const;
 
-    bool assertBelief(BeliefType const &belief) const;
+    bool assertBelief(BeliefView const &belief) const;
 
-    bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
+    bool assertTriangulation(BeliefView const &belief, Triangulation const &triangulation) const;
 
-    uint32_t getBeliefObservation(BeliefType belief) const;
+    uint32_t getBeliefObservation(BeliefView const &belief) const;
 
-    void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+    /*!
+     * A triangulation whose grid points have not been assigned an id yet.
+     * Computing such triangulations does not modify the manager and can therefore be done concurrently.
+     */
+    struct UnresolvedTriangulation {
+        std::vector<BeliefType> gridPoints;
+        std::vector<BeliefValueType> weights;
+    };
+
+    void triangulateBeliefFreudenthal(BeliefView const &belief, BeliefValueType const &resolution, UnresolvedTriangulation &result) const;
+
+    void triangulateBeliefDynamic(BeliefView const &belief, BeliefValueType const &resolution, UnresolvedTriangulation &result) const;
 
-    void triangulateBeliefDynamic(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
+    UnresolvedTriangulation computeTriangulation(BeliefView const &belief, BeliefValueType const &resolution) const;
 
-    Triangulation triangulateBelief(BeliefType const &belief, BeliefValueType const &resolution);
+    Triangulation triangulateBelief(BeliefView const &belief, BeliefValueType const &resolution);
+
+    /*!
+     * Computes the successor beliefs of the given belief under the given action together with the probability to reach them.
+     */
+    std::vector<std::pair<BeliefType, BeliefValueType>> computeSuccessorBeliefs(BeliefView const &belief, uint64_t actionIndex) const;
+
+    /*!
+     * Computes the (not yet registered) grid points of the triangulated successor beliefs together with the probability to reach them.
+     */
+    std::vector<std::pair<BeliefType, BeliefValueType>> computeTriangulatedSuccessors(BeliefView const &belief, uint64_t actionIndex,
+                                                                                      std::vector<BeliefValueType> const &observationResolutions) const;
 
     std::vector<std::pair<BeliefId, ValueType>> expandInternal(
         BeliefId const &beliefId, uint64_t actionIndex, std::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions = std::nullopt,
@@ -151,15 +214,22 @@ class BeliefManager {
 
     BeliefId computeInitialBelief();
 
-    BeliefId getOrAddBeliefId(BeliefType const &belief);
+    BeliefId getOrAddBeliefId(BeliefView const &belief);
 
     PomdpType const &pomdp;
     std::vector<ValueType> pomdpActionRewardVector;
 
-    std::vector<BeliefType> beliefs;
-    std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash, Belief_equal_to>> beliefToIdMap;
+    // All beliefs are stored consecutively in one pool. The entries of the belief with id i are in [beliefOffsets[i], beliefOffsets[i + 1]).
+    std::vector<typename BeliefView::EntryType> beliefEntries;
+    std::vector<uint64_t> beliefOffsets;
+    // For each observation, maps the hash of a stored belief (see BeliefHash) to its id. Different beliefs might have the same hash.
+    std::vector<std::unordered_multimap<std::size_t, BeliefId>> beliefIdsByHash;
     BeliefId initialBeliefId;
 
+    // Triangulated successors of (belief, action) pairs that were computed by prepareTriangulatedExpansions
+    std::map<std::pair<BeliefId, uint64_t>, std::vector<std::pair<BeliefType, BeliefValueType>>> preparedExpansions;
+    std::vector<BeliefValueType> preparedExpansionsResolutions;
+
     storm::utility::ConstantsComparator<BeliefValueType> cc;
 
     std::shared_ptr<storm::solver::LpSolver<BeliefValueType>> lpSolver;
@@ -20,6 +20,7 @@
 #include "storm/generator/JaniNextStateGenerator.h"
 #include "storm/generator/PrismNextStateGenerator.h"
 
+#include "storm/builder/ExplicitBisimulationModelBuilder.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 
 #include "storm/exceptions/NotSupportedException.h"
@@ -78,17 +79,17 @@ inline std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, s
 }
 
 /**
- * Initializes an explict model builder; an object/algorithm that is used to build sparse models
+ * Initializes a next-state generator that explores the state space of the given model
  * @tparam ValueType Type of the probabilities in the sparse model
  * @param model SymbolicModelDescription of the model
  * @param options Builder options
- * @param actionMask An object to restrict which actions are expanded in the builder
- * @return A builder
+ * @param actionMask An object to restrict which actions are expanded in the generator
+ * @return A generator
  */
 template<typename ValueType>
-storm::builder::ExplicitModelBuilder<ValueType> makeExplicitModelBuilder(storm::storage::SymbolicModelDescription const& model,
-                                                                         storm::builder::BuilderOptions const& options,
-                                                                         std::shared_ptr<storm::generator::ActionMask<ValueType>> actionMask = nullptr) {
+std::shared_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> makeNextStateGenerator(
+    storm::storage::SymbolicModelDescription const& model, storm::builder::BuilderOptions const& options,
+    std::shared_ptr<storm::generator::ActionMask<ValueType>> actionMask = nullptr) {
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>> generator;
     if (model.isPrismProgram()) {
         generator = std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, uint32_t>>(model.asPrismProgram(), options, actionMask);
@@ -102,13 +103,38 @@ storm::builder::ExplicitModelBuilder<ValueType> makeExplicitModelBuilder(storm::
     } else {
         STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Cannot build sparse model from this symbolic model description.");
     }
-    return storm::builder::ExplicitModelBuilder<ValueType>(generator);
+    return generator;
 }
 
+/**
+ * Initializes an explict model builder; an object/algorithm that is used to build sparse models
+ * @tparam ValueType Type of the probabilities in the sparse model
+ * @param model SymbolicModelDescription of the model
+ * @param options Builder options
+ * @param actionMask An object to restrict which actions are expanded in the builder
+ * @param builderOptions Options of the builder, e.g., the number of threads that expand states concurrently
+ * @return A builder
+ */
 template<typename ValueType>
-std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm::storage::SymbolicModelDescription const& model,
-                                                                          storm::builder::BuilderOptions const& options) {
-    storm::builder::ExplicitModelBuilder<ValueType> builder = makeExplicitModelBuilder<ValueType>(model, options);
+storm::builder::ExplicitModelBuilder<ValueType> makeExplicitModelBuilder(
+    storm::storage::SymbolicModelDescription const& model, storm::builder::BuilderOptions const& options,
+    std::shared_ptr<storm::generator::ActionMask<ValueType>> actionMask = nullptr,
+    typename storm::builder::ExplicitModelBuilder<ValueType>::Options const& builderOptions =
+        typename storm::builder::ExplicitModelBuilder<ValueType>::Options()) {
+    // Concurrent exploration requires additional generators. As action masks may keep track of the explored states, they can not be shared.
+    std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, uint32_t>>()> generatorFactory;
+    if (builderOptions.numberOfThreads != 1 && actionMask == nullptr) {
+        generatorFactory = [model, options]() { return makeNextStateGenerator<ValueType>(model, options); };
+    }
+    return storm::builder::ExplicitModelBuilder<ValueType>(makeNextStateGenerator<ValueType>(model, options, actionMask), generatorFactory, builderOptions);
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(
+    storm::storage::SymbolicModelDescription const& model, storm::builder::BuilderOptions const& options,
+    typename storm::builder::ExplicitModelBuilder<ValueType>::Options const& builderOptions =
+        typename storm::builder::ExplicitModelBuilder<ValueType>::Options()) {
+    storm::builder::ExplicitModelBuilder<ValueType> builder = makeExplicitModelBuilder<ValueType>(model, options, nullptr, builderOptions);
     return builder.build();
 }
 
@@ -119,6 +145,26 @@ std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm:
     return buildSparseModel<ValueType>(model, options);
 }
 
+/**
+ * Builds the strong bisimulation quotient of the given deterministic model during state-space exploration, i.e. without building the full model first.
+ * The quotient respects all labels and the (at most one) reward model that are built according to the given options.
+ */
+template<typename ValueType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseBisimulationQuotient(storm::storage::SymbolicModelDescription const& model,
+                                                                                         storm::builder::BuilderOptions const& options) {
+    storm::builder::ExplicitBisimulationModelBuilder<ValueType> builder(makeNextStateGenerator<ValueType>(model, options));
+    return builder.build();
+}
+
+/**
+ * Explores the given model and writes it to the given UMB archive during exploration, i.e. without building the transition matrix in memory.
+ */
+template<typename ValueType>
+void buildSparseModelAsUmb(storm::storage::SymbolicModelDescription const& model, storm::builder::BuilderOptions const& options,
+                           std::filesystem::path const& umbArchive, storm::umb::ExportOptions const& exportOptions = {}) {
+    makeExplicitModelBuilder<ValueType>(model, options).exportToUmb(umbArchive, exportOptions);
+}
+
 template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
 std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> buildSparseModel(
     storm::models::ModelType modelType, storm::storage::sparse::ModelComponents<ValueType, RewardModelType>&& components) {
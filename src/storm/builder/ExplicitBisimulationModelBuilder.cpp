@@ -0,0 +1,382 @@
+#include "storm/builder/ExplicitBisimulationModelBuilder.h"
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <limits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/exceptions/AbortException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BuildSettings.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace builder {
+
+namespace detail {
+/*!
+ * Computes the strong bisimulation equivalence classes of the given model that respects all labels and (if requested) the rewards.
+ *
+ * @return The index of the equivalence class of each state.
+ */
+template<typename ModelType>
+std::vector<uint64_t> computeBisimulationClasses(ModelType const& model, bool keepRewards) {
+    typename storm::storage::DeterministicModelBisimulationDecomposition<ModelType>::Options options;
+    options.setKeepRewards(keepRewards);
+    options.buildQuotient = false;
+    storm::storage::DeterministicModelBisimulationDecomposition<ModelType> decomposition(model, options);
+    decomposition.computeBisimulationDecomposition();
+
+    std::vector<uint64_t> stateToClass(model.getNumberOfStates());
+    for (uint64_t blockIndex = 0; blockIndex < decomposition.size(); ++blockIndex) {
+        for (auto state : decomposition.getBlock(blockIndex)) {
+            stateToClass[state] = blockIndex;
+        }
+    }
+    return stateToClass;
+}
+
+/*!
+ * Sorts the given entries by their column and sums up the values of entries with the same column.
+ */
+template<typename ValueType>
+void sortAndMergeEntries(std::vector<std::pair<uint64_t, ValueType>>& entries) {
+    std::sort(entries.begin(), entries.end(), [](auto const& entry1, auto const& entry2) { return entry1.first < entry2.first; });
+    auto mergedEnd = entries.begin();
+    for (auto entryIt = entries.begin(); entryIt != entries.end(); ++entryIt) {
+        if (mergedEnd != entries.begin() && std::prev(mergedEnd)->first == entryIt->first) {
+            std::prev(mergedEnd)->second += entryIt->second;
+        } else {
+            if (mergedEnd != entryIt) {
+                *mergedEnd = std::move(*entryIt);
+            }
+            ++mergedEnd;
+        }
+    }
+    entries.erase(mergedEnd, entries.end());
+}
+}  // namespace detail
+
+template<typename ValueType, typename StateType>
+ExplicitBisimulationModelBuilder<ValueType, StateType>::Options::Options() : minimizationThreshold(1ull << 16) {
+    fixDeadlocks = !storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
+}
+
+template<typename ValueType, typename StateType>
+ExplicitBisimulationModelBuilder<ValueType, StateType>::ExplicitBisimulationModelBuilder(
+    std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options)
+    : generator(generator), options(options), hasRewardModel(false), stateStorage(generator->getStateSize()) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename StateType>
+ExplicitBisimulationModelBuilder<ValueType, StateType>::ExplicitBisimulationModelBuilder(storm::prism::Program const& program,
+                                                                                         storm::generator::NextStateGeneratorOptions const& generatorOptions,
+                                                                                         Options const& builderOptions)
+    : ExplicitBisimulationModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions),
+                                       builderOptions) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType, typename StateType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitBisimulationModelBuilder<ValueType, StateType>::build() {
+    STORM_LOG_THROW(generator->isDeterministicModel(), storm::exceptions::NotSupportedException,
+                    "On-the-fly bisimulation minimization is only supported for deterministic models.");
+    STORM_LOG_THROW(generator->getNumberOfRewardModels() <= 1, storm::exceptions::NotSupportedException,
+                    "On-the-fly bisimulation minimization supports at most one reward model.");
+    STORM_LOG_THROW(!generator->getOptions().isAddOverlappingGuardLabelSet(), storm::exceptions::NotSupportedException,
+                    "On-the-fly bisimulation minimization does not support labeling states with overlapping guards.");
+    hasRewardModel = generator->getNumberOfRewardModels() == 1;
+    STORM_LOG_THROW(!hasRewardModel || !generator->getRewardModelInformation(0).hasTransitionRewards(), storm::exceptions::NotSupportedException,
+                    "On-the-fly bisimulation minimization does not support transition rewards.");
+
+    std::function<StateType(CompressedState const&)> stateToIdCallback =
+        std::bind(&ExplicitBisimulationModelBuilder<ValueType, StateType>::getOrAddStateIndex, this, std::placeholders::_1);
+    initialStateIndices = generator->getInitialStates(stateToIdCallback);
+    STORM_LOG_THROW(!initialStateIndices.empty(), storm::exceptions::WrongFormatException, "The model does not have a single initial state.");
+    std::sort(initialStateIndices.begin(), initialStateIndices.end());
+
+    quotientRowIndications.assign(1, 0);
+    for (auto const& initialStateIndex : initialStateIndices) {
+        if (stateStatus[initialStateIndex] != StateStatus::Discovered) {
+            continue;
+        }
+
+        // Perform Tarjan's algorithm to determine the SCCs of the states reachable from the initial state.
+        exploreState(initialStateIndex);
+        while (!searchStack.empty()) {
+            SearchFrame& frame = searchStack.back();
+            if (frame.nextTransition < stack[frame.position].transitions.size()) {
+                StateType successor = stack[frame.position].transitions[frame.nextTransition].first;
+                ++frame.nextTransition;
+                if (stateStatus[successor] == StateStatus::Discovered) {
+                    // Note that this invalidates the reference to the current frame.
+                    exploreState(successor);
+                } else if (stateStatus[successor] == StateStatus::OnStack) {
+                    frame.lowlink = std::min<uint64_t>(frame.lowlink, stateIndices[successor]);
+                }
+            } else {
+                uint64_t position = frame.position;
+                uint64_t lowlink = frame.lowlink;
+                searchStack.pop_back();
+                if (lowlink == position) {
+                    completeScc(position);
+                    // As the successors of completed states are complete as well, we can minimize them.
+                    if (pendingStates.size() >= std::max<uint64_t>(options.minimizationThreshold, quotientRowIndications.size() - 1)) {
+                        minimizePendingStates();
+                    }
+                }
+                if (!searchStack.empty()) {
+                    searchStack.back().lowlink = std::min(searchStack.back().lowlink, lowlink);
+                }
+            }
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            std::cout << "Explored " << stateStorage.getNumberOfStates() << " states before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+        }
+    }
+    if (!pendingStates.empty()) {
+        minimizePendingStates();
+    }
+    STORM_LOG_DEBUG("Explored " << stateStorage.getNumberOfStates() << " states, the quotient has " << quotientRowIndications.size() - 1 << " states.");
+
+    return buildQuotient();
+}
+
+template<typename ValueType, typename StateType>
+uint64_t ExplicitBisimulationModelBuilder<ValueType, StateType>::getNumberOfExploredStates() const {
+    return stateStorage.getNumberOfStates();
+}
+
+template<typename ValueType, typename StateType>
+StateType ExplicitBisimulationModelBuilder<ValueType, StateType>::getOrAddStateIndex(CompressedState const& state) {
+    StateType newIndex = static_cast<StateType>(stateStorage.getNumberOfStates());
+    StateType actualIndex = stateStorage.stateToId.findOrAdd(state, newIndex);
+    if (actualIndex == newIndex) {
+        stateStatus.push_back(StateStatus::Discovered);
+        stateIndices.push_back(0);
+        discoveredStates.emplace(actualIndex, state);
+    }
+    return actualIndex;
+}
+
+template<typename ValueType, typename StateType>
+void ExplicitBisimulationModelBuilder<ValueType, StateType>::exploreState(StateType index) {
+    auto discoveredStateIt = discoveredStates.find(index);
+    STORM_LOG_ASSERT(discoveredStateIt != discoveredStates.end(), "Unable to find discovered state.");
+    ExploredState explored;
+    explored.index = index;
+    explored.state = std::move(discoveredStateIt->second);
+    discoveredStates.erase(discoveredStateIt);
+    explored.reward = storm::utility::zero<ValueType>();
+    explored.initial = std::binary_search(initialStateIndices.begin(), initialStateIndices.end(), index);
+    explored.deadlock = false;
+
+    std::function<StateType(CompressedState const&)> stateToIdCallback =
+        std::bind(&ExplicitBisimulationModelBuilder<ValueType, StateType>::getOrAddStateIndex, this, std::placeholders::_1);
+    generator->load(explored.state);
+    storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
+    if (behavior.empty()) {
+        // The state is either a deadlock state or terminal. In both cases, we add a self-loop.
+        STORM_LOG_THROW(!behavior.wasExpanded() || options.fixDeadlocks, storm::exceptions::WrongFormatException,
+                        "Error while creating sparse matrix from probabilistic program: found deadlock state ("
+                            << generator->stateToString(explored.state) << "). For fixing these, please provide the appropriate option.");
+        explored.deadlock = behavior.wasExpanded();
+        explored.transitions.emplace_back(index, storm::utility::one<ValueType>());
+    } else {
+        if (hasRewardModel) {
+            explored.reward = behavior.getStateRewards().front();
+        }
+        for (auto const& choice : behavior) {
+            explored.transitions.insert(explored.transitions.end(), choice.begin(), choice.end());
+            if (hasRewardModel) {
+                // Rewards of choices are reduced to state rewards. For continuous-time models, this requires weighting them with the exit rate.
+                if (generator->isDiscreteTimeModel()) {
+                    explored.reward += choice.getRewards().front();
+                } else {
+                    explored.reward += choice.getTotalMass() * choice.getRewards().front();
+                }
+            }
+        }
+    }
+
+    stateStatus[index] = StateStatus::OnStack;
+    stateIndices[index] = static_cast<StateType>(stack.size());
+    searchStack.push_back({stack.size(), 0, stack.size()});
+    stack.push_back(std::move(explored));
+}
+
+template<typename ValueType, typename StateType>
+void ExplicitBisimulationModelBuilder<ValueType, StateType>::completeScc(uint64_t rootPosition) {
+    for (auto stateIt = stack.begin() + rootPosition; stateIt != stack.end(); ++stateIt) {
+        stateStatus[stateIt->index] = StateStatus::Pending;
+        stateIndices[stateIt->index] = static_cast<StateType>(pendingStates.size());
+        pendingStates.push_back(std::move(*stateIt));
+    }
+    stack.erase(stack.begin() + rootPosition, stack.end());
+}
+
+template<typename ValueType, typename StateType>
+void ExplicitBisimulationModelBuilder<ValueType, StateType>::minimizePendingStates() {
+    uint64_t const numberOfQuotientStates = quotientRowIndications.size() - 1;
+    STORM_LOG_TRACE("Minimizing " << pendingStates.size() << " states together with a quotient of " << numberOfQuotientStates << " states.");
+
+    // Compute the equivalence classes of the model consisting of the quotient and the pending states.
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> model = buildModelWithPendingStates();
+    std::vector<uint64_t> stateToClass;
+    if (model->isOfType(storm::models::ModelType::Dtmc)) {
+        stateToClass = detail::computeBisimulationClasses(*model->template as<storm::models::sparse::Dtmc<ValueType>>(), hasRewardModel);
+    } else {
+        stateToClass = detail::computeBisimulationClasses(*model->template as<storm::models::sparse::Ctmc<ValueType>>(), hasRewardModel);
+    }
+
+    // The states of the quotient are pairwise non-bisimilar, because no state of the quotient can reach a pending state. Hence, each class contains at
+    // most one state of the quotient and the pending states of such a class are mapped to that state. The remaining classes become new quotient states.
+    uint64_t const noQuotientState = std::numeric_limits<uint64_t>::max();
+    std::vector<uint64_t> classToQuotientState(stateToClass.empty() ? 0 : *std::max_element(stateToClass.begin(), stateToClass.end()) + 1, noQuotientState);
+    for (uint64_t quotientState = 0; quotientState < numberOfQuotientStates; ++quotientState) {
+        STORM_LOG_ASSERT(classToQuotientState[stateToClass[quotientState]] == noQuotientState, "Quotient states are expected to be non-bisimilar.");
+        classToQuotientState[stateToClass[quotientState]] = quotientState;
+    }
+    std::vector<uint64_t> representatives;
+    for (uint64_t pendingIndex = 0; pendingIndex < pendingStates.size(); ++pendingIndex) {
+        uint64_t& quotientState = classToQuotientState[stateToClass[numberOfQuotientStates + pendingIndex]];
+        if (quotientState == noQuotientState) {
+            quotientState = numberOfQuotientStates + representatives.size();
+            representatives.push_back(pendingIndex);
+        }
+        stateStatus[pendingStates[pendingIndex].index] = StateStatus::Minimized;
+        stateIndices[pendingStates[pendingIndex].index] = static_cast<StateType>(quotientState);
+    }
+
+    // Add the transitions, labels and rewards of the new quotient states based on their representatives.
+    storm::models::sparse::StateLabeling const& labeling = model->getStateLabeling();
+    uint64_t const newNumberOfQuotientStates = numberOfQuotientStates + representatives.size();
+    for (auto const& label : labeling.getLabels()) {
+        quotientLabels.try_emplace(label, numberOfQuotientStates);
+    }
+    for (auto& labelStatesPair : quotientLabels) {
+        labelStatesPair.second.resize(newNumberOfQuotientStates);
+    }
+    std::vector<std::pair<uint64_t, ValueType>> rowEntries;
+    for (uint64_t representativeIndex = 0; representativeIndex < representatives.size(); ++representativeIndex) {
+        uint64_t const modelState = numberOfQuotientStates + representatives[representativeIndex];
+        rowEntries.clear();
+        for (auto const& entry : model->getTransitionMatrix().getRow(modelState)) {
+            rowEntries.emplace_back(classToQuotientState[stateToClass[entry.getColumn()]], entry.getValue());
+        }
+        detail::sortAndMergeEntries(rowEntries);
+        quotientEntries.insert(quotientEntries.end(), rowEntries.begin(), rowEntries.end());
+        quotientRowIndications.push_back(quotientEntries.size());
+
+        for (auto const& label : labeling.getLabelsOfState(modelState)) {
+            quotientLabels.at(label).set(numberOfQuotientStates + representativeIndex);
+        }
+        if (hasRewardModel) {
+            quotientStateRewards.push_back(pendingStates[representatives[representativeIndex]].reward);
+        }
+    }
+    pendingStates.clear();
+}
+
+template<typename ValueType, typename StateType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitBisimulationModelBuilder<ValueType, StateType>::buildModelWithPendingStates() const {
+    uint64_t const numberOfQuotientStates = quotientRowIndications.size() - 1;
+    uint64_t const numberOfStates = numberOfQuotientStates + pendingStates.size();
+
+    // Build the transition matrix, where the pending states are appended to the states of the quotient.
+    storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(numberOfStates, numberOfStates);
+    for (uint64_t quotientState = 0; quotientState < numberOfQuotientStates; ++quotientState) {
+        for (uint64_t entry = quotientRowIndications[quotientState]; entry < quotientRowIndications[quotientState + 1]; ++entry) {
+            transitionMatrixBuilder.addNextValue(quotientState, quotientEntries[entry].first, quotientEntries[entry].second);
+        }
+    }
+    std::vector<std::pair<uint64_t, ValueType>> rowEntries;
+    for (uint64_t pendingIndex = 0; pendingIndex < pendingStates.size(); ++pendingIndex) {
+        rowEntries.clear();
+        for (auto const& [successor, value] : pendingStates[pendingIndex].transitions) {
+            STORM_LOG_ASSERT(stateStatus[successor] == StateStatus::Pending || stateStatus[successor] == StateStatus::Minimized,
+                             "Successors of completed states are expected to be complete.");
+            uint64_t offset = stateStatus[successor] == StateStatus::Pending ? numberOfQuotientStates : 0;
+            rowEntries.emplace_back(offset + stateIndices[successor], value);
+        }
+        detail::sortAndMergeEntries(rowEntries);
+        for (auto const& [column, value] : rowEntries) {
+            transitionMatrixBuilder.addNextValue(numberOfQuotientStates + pendingIndex, column, value);
+        }
+    }
+
+    // Label the pending states by means of a state storage that only contains them.
+    storm::storage::sparse::StateStorage<StateType> pendingStateStorage(generator->getStateSize());
+    std::vector<StateType> pendingInitialStates;
+    std::vector<StateType> pendingDeadlockStates;
+    for (uint64_t pendingIndex = 0; pendingIndex < pendingStates.size(); ++pendingIndex) {
+        pendingStateStorage.stateToId.findOrAdd(pendingStates[pendingIndex].state, static_cast<StateType>(pendingIndex));
+        if (pendingStates[pendingIndex].initial) {
+            pendingInitialStates.push_back(pendingIndex);
+        }
+        if (pendingStates[pendingIndex].deadlock) {
+            pendingDeadlockStates.push_back(pendingIndex);
+        }
+    }
+    storm::models::sparse::StateLabeling pendingLabeling = generator->label(pendingStateStorage, pendingInitialStates, pendingDeadlockStates, {});
+
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    for (auto const& [label, states] : quotientLabels) {
+        labeling.addLabel(label);
+        for (auto state : states) {
+            labeling.addLabelToState(label, state);
+        }
+    }
+    for (auto const& label : pendingLabeling.getLabels()) {
+        if (!labeling.containsLabel(label)) {
+            labeling.addLabel(label);
+        }
+        for (auto pendingIndex : pendingLabeling.getStates(label)) {
+            labeling.addLabelToState(label, numberOfQuotientStates + pendingIndex);
+        }
+    }
+
+    std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<ValueType>> rewardModels;
+    if (hasRewardModel) {
+        std::vector<ValueType> stateRewards(quotientStateRewards);
+        for (auto const& pendingState : pendingStates) {
+            stateRewards.push_back(pendingState.reward);
+        }
+        rewardModels.emplace(generator->getRewardModelInformation(0).getName(), storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewards)));
+    }
+
+    storm::storage::sparse::ModelComponents<ValueType> components(transitionMatrixBuilder.build(), std::move(labeling), std::move(rewardModels),
+                                                                  !generator->isDiscreteTimeModel());
+    return storm::utility::builder::buildModelFromComponents(
+        generator->isDiscreteTimeModel() ? storm::models::ModelType::Dtmc : storm::models::ModelType::Ctmc, std::move(components));
+}
+
+template<typename ValueType, typename StateType>
+std::shared_ptr<storm::models::sparse::Model<ValueType>> ExplicitBisimulationModelBuilder<ValueType, StateType>::buildQuotient() const {
+    STORM_LOG_ASSERT(pendingStates.empty(), "Unable to build the quotient while there are pending states.");
+    return buildModelWithPendingStates();
+}
+
+template class ExplicitBisimulationModelBuilder<double, uint32_t>;
+template class ExplicitBisimulationModelBuilder<storm::RationalNumber, uint32_t>;
+template class ExplicitBisimulationModelBuilder<storm::RationalFunction, uint32_t>;
+
+}  // namespace builder
+}  // namespace storm
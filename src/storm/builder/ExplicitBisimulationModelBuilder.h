@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/NextStateGenerator.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/sparse/StateStorage.h"
+
+namespace storm {
+namespace builder {
+
+/*!
+ * Builds the strong bisimulation quotient of a deterministic model (DTMC or CTMC) during the exploration of its state space, so that the unreduced
+ * model never needs to be stored as a whole.
+ *
+ * States are explored in depth-first order while the strongly connected components (SCCs) are determined on the fly. Once an SCC is complete, all
+ * states reachable from it have been explored as well. As the bisimilarity of two states only depends on the states reachable from them, the
+ * completed states can be minimized together with the quotient obtained so far and their transitions can be discarded afterwards. Minimization
+ * is triggered whenever sufficiently many completed states are pending, so that the overall effort remains linear in the number of minimizations.
+ *
+ * Only the quotient, the states of incomplete SCCs and the pending states are stored explicitly. The mapping of compressed states to indices is
+ * kept for all states, as any of them may be reached again later. Hence, the savings depend on the SCC structure of the model: if it is strongly
+ * connected, nothing can be minimized before the exploration is finished.
+ *
+ * The resulting quotient respects all labels and the (unique) reward model built by the generator, where rewards are reduced to state rewards.
+ */
+template<typename ValueType, typename StateType = uint32_t>
+class ExplicitBisimulationModelBuilder {
+   public:
+    struct Options {
+        /*!
+         * Creates an object representing the default building options.
+         */
+        Options();
+
+        // If set, deadlocks states will be fixed by adding a self-loop with probability 1.
+        bool fixDeadlocks;
+
+        // The minimal number of completed states that triggers a minimization. Minimization is only triggered once the number of completed states
+        // also exceeds the size of the current quotient.
+        uint64_t minimizationThreshold;
+    };
+
+    /*!
+     * Creates a builder that uses the provided generator.
+     *
+     * @param generator The generator to use.
+     */
+    ExplicitBisimulationModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator,
+                                     Options const& options = Options());
+
+    /*!
+     * Creates a builder for the given PRISM program.
+     *
+     * @param program The program for which to build the quotient.
+     */
+    ExplicitBisimulationModelBuilder(storm::prism::Program const& program,
+                                     storm::generator::NextStateGeneratorOptions const& generatorOptions = storm::generator::NextStateGeneratorOptions(),
+                                     Options const& builderOptions = Options());
+
+    /*!
+     * Explores the state space and builds the bisimulation quotient.
+     *
+     * @return The quotient model.
+     */
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> build();
+
+    /*!
+     * Retrieves the number of states that were explored by the last call to build().
+     */
+    uint64_t getNumberOfExploredStates() const;
+
+   private:
+    enum class StateStatus : uint8_t {
+        // The state was discovered but not yet explored.
+        Discovered,
+        // The state was explored, but its SCC is not yet complete.
+        OnStack,
+        // The SCC of the state is complete, but the state is not yet minimized.
+        Pending,
+        // The state is represented by a state of the quotient.
+        Minimized
+    };
+
+    // The information about a state that is required until the state is minimized.
+    struct ExploredState {
+        StateType index;
+        CompressedState state;
+        // The transitions to the successors in terms of their global indices.
+        std::vector<std::pair<StateType, ValueType>> transitions;
+        ValueType reward;
+        bool initial;
+        bool deadlock;
+    };
+
+    // An entry of the depth-first search.
+    struct SearchFrame {
+        // The position of the state in the stack of explored states.
+        uint64_t position;
+        // The index of the next transition to consider.
+        uint64_t nextTransition;
+        // The smallest position of a state on the stack that is reachable from the state.
+        uint64_t lowlink;
+    };
+
+    /*!
+     * Retrieves the index of the given state. If the state has not been encountered yet, it is registered as discovered.
+     */
+    StateType getOrAddStateIndex(CompressedState const& state);
+
+    /*!
+     * Expands the discovered state with the given index and pushes it onto the search stack.
+     */
+    void exploreState(StateType index);
+
+    /*!
+     * Moves the states of the completed SCC whose root is at the given position of the stack to the pending states.
+     */
+    void completeScc(uint64_t rootPosition);
+
+    /*!
+     * Minimizes the pending states together with the current quotient and extends the quotient by the new equivalence classes.
+     */
+    void minimizePendingStates();
+
+    /*!
+     * Assembles the model that consists of the states of the current quotient followed by the pending states.
+     */
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> buildModelWithPendingStates() const;
+
+    /*!
+     * Builds the model described by the current quotient.
+     */
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> buildQuotient() const;
+
+    /// The generator to use for the building process.
+    std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
+
+    /// The options to be used for the building process.
+    Options options;
+
+    /// Whether the rewards of the (unique) reward model are respected.
+    bool hasRewardModel;
+
+    /// Maps all states that were encountered so far to their indices.
+    storm::storage::sparse::StateStorage<StateType> stateStorage;
+
+    /// The status of each state and its position on the stack, its pending index or its quotient state, respectively.
+    std::vector<StateStatus> stateStatus;
+    std::vector<StateType> stateIndices;
+
+    /// The states that were discovered but not yet explored.
+    std::unordered_map<StateType, CompressedState> discoveredStates;
+
+    /// The sorted indices of the initial states.
+    std::vector<StateType> initialStateIndices;
+
+    /// The explored states whose SCCs are not yet complete and the stack of the depth-first search.
+    std::vector<ExploredState> stack;
+    std::vector<SearchFrame> searchStack;
+
+    /// The states whose SCCs are complete, but that are not yet minimized.
+    std::vector<ExploredState> pendingStates;
+
+    /// The transitions, labels and rewards of the quotient obtained so far.
+    std::vector<uint64_t> quotientRowIndications;
+    std::vector<std::pair<uint64_t, ValueType>> quotientEntries;
+    std::map<std::string, storm::storage::BitVector> quotientLabels;
+    std::vector<ValueType> quotientStateRewards;
+};
+
+}  // namespace builder
+}  // namespace storm
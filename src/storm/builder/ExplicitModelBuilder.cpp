@@ -1,6 +1,12 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <limits>
 #include <map>
+#include <memory>
+#include <type_traits>
 
 #include "storm/adapters/IntervalAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -8,15 +14,19 @@
 #include "storm/builder/RewardModelBuilder.h"
 #include "storm/builder/StateAndChoiceInformationBuilder.h"
 #include "storm/exceptions/AbortException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/generator/JaniNextStateGenerator.h"
 #include "storm/generator/PrismNextStateGenerator.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/jani/Model.h"
+#include "storm/storage/umb/export/UmbStreamingExporter.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/builder.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
@@ -24,6 +34,270 @@
 namespace storm {
 namespace builder {
 
+namespace detail {
+// The maximal number of states that are expanded concurrently before their successors are assigned to their final indices.
+static uint64_t const explorationBatchSize = 1ull << 14;
+
+// The number of states that are expanded within a single task.
+static uint64_t const explorationChunkSize = 64;
+
+/*!
+ * Assigns consecutive indices to states that are discovered concurrently.
+ */
+class ConcurrentStateIndex {
+   public:
+    ConcurrentStateIndex(uint64_t stateSize) : stateSize(stateSize) {
+        clear();
+    }
+
+    /*!
+     * Retrieves the index of the given state. If the state is not yet known, it gets the next free index.
+     */
+    uint64_t findOrAdd(CompressedState const& state) {
+        return indices->findOrCreate(state, [this]() { return numberOfStates.fetch_add(1, std::memory_order_relaxed); }).first;
+    }
+
+    /*!
+     * Retrieves the states ordered by their index. Must not be called concurrently with findOrAdd.
+     */
+    std::vector<CompressedState> getStates() const {
+        std::vector<CompressedState> result(numberOfStates.load(std::memory_order_relaxed));
+        for (auto const& stateIndexPair : *indices) {
+            result[stateIndexPair.second] = stateIndexPair.first;
+        }
+        return result;
+    }
+
+    /*!
+     * Removes all states. Must not be called concurrently with findOrAdd.
+     */
+    void clear() {
+        indices = std::make_unique<storm::storage::ConcurrentBitVectorHashMap<uint64_t>>(stateSize, explorationBatchSize);
+        numberOfStates.store(0, std::memory_order_relaxed);
+    }
+
+   private:
+    uint64_t stateSize;
+    std::unique_ptr<storm::storage::ConcurrentBitVectorHashMap<uint64_t>> indices;
+    std::atomic<uint64_t> numberOfStates;
+};
+
+/*!
+ * Reports the progress of the exploration and aborts the exploration upon termination requests.
+ */
+class ExplorationProgress {
+   public:
+    ExplorationProgress(bool showProgress, uint64_t showProgressDelay)
+        : showProgress(showProgress),
+          showProgressDelay(showProgressDelay),
+          timeOfStart(std::chrono::high_resolution_clock::now()),
+          timeOfLastMessage(timeOfStart),
+          numberOfExploredStates(0),
+          numberOfExploredStatesSinceLastMessage(0) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * Reports progress and checks for termination after the given number of states have been explored.
+     */
+    void addExploredStates(uint64_t numberOfStates) {
+        numberOfExploredStates += numberOfStates;
+        if (showProgress) {
+            numberOfExploredStatesSinceLastMessage += numberOfStates;
+
+            auto now = std::chrono::high_resolution_clock::now();
+            auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+            if (static_cast<uint64_t>(durationSinceLastMessage) >= showProgressDelay) {
+                auto statesPerSecond = numberOfExploredStatesSinceLastMessage / durationSinceLastMessage;
+                auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
+                std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds (currently " << statesPerSecond
+                          << " states per second).\n";
+                timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                numberOfExploredStatesSinceLastMessage = 0;
+            }
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
+            std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+        }
+    }
+
+   private:
+    bool showProgress;
+    uint64_t showProgressDelay;
+    std::chrono::high_resolution_clock::time_point timeOfStart;
+    std::chrono::high_resolution_clock::time_point timeOfLastMessage;
+    uint64_t numberOfExploredStates;
+    uint64_t numberOfExploredStatesSinceLastMessage;
+};
+
+/*!
+ * Passes the behavior of explored states to the builders of the model components.
+ */
+template<typename ValueType, typename RewardValueType>
+class ComponentBuilderSink {
+   public:
+    ComponentBuilderSink(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+                         std::vector<RewardModelBuilder<RewardValueType>>& rewardModelBuilders,
+                         StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder, bool deterministicModel, uint_fast64_t& currentRow,
+                         uint_fast64_t& currentRowGroup)
+        : transitionMatrixBuilder(transitionMatrixBuilder),
+          rewardModelBuilders(rewardModelBuilders),
+          stateAndChoiceInformationBuilder(stateAndChoiceInformationBuilder),
+          deterministicModel(deterministicModel),
+          currentRow(currentRow),
+          currentRowGroup(currentRowGroup),
+          firstChoiceOfState(true) {
+        // Intentionally left empty.
+    }
+
+    void beginState() {
+        // If the model is nondeterministic, we need to open a row group.
+        if (!deterministicModel) {
+            transitionMatrixBuilder.newRowGroup(currentRow);
+        }
+        firstChoiceOfState = true;
+    }
+
+    void addStateReward(uint64_t rewardModelIndex, RewardValueType const& value) {
+        if (rewardModelBuilders[rewardModelIndex].hasStateRewards()) {
+            rewardModelBuilders[rewardModelIndex].addStateReward(value);
+        }
+    }
+
+    void beginChoice() {
+        // Intentionally left empty.
+    }
+
+    template<typename ChoiceType>
+    void beginChoice(ChoiceType const& choice) {
+        // add the generated choice information
+        if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
+            for (auto const& label : choice.getLabels()) {
+                stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
+            }
+        }
+        if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
+            stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
+        }
+        if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
+            STORM_LOG_ASSERT(firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
+                             "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
+            if (firstChoiceOfState) {
+                stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
+            }
+        }
+    }
+
+    void setMarkovian() {
+        if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
+            stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
+        }
+    }
+
+    void addBranch(uint64_t target, ValueType const& value) {
+        transitionMatrixBuilder.addNextValue(currentRow, target, value);
+    }
+
+    void addChoiceReward(uint64_t rewardModelIndex, RewardValueType const& value) {
+        if (rewardModelBuilders[rewardModelIndex].hasStateActionRewards()) {
+            rewardModelBuilders[rewardModelIndex].addStateActionReward(value);
+        }
+    }
+
+    void endChoice() {
+        ++currentRow;
+        firstChoiceOfState = false;
+    }
+
+    void endState() {
+        ++currentRowGroup;
+    }
+
+   private:
+    storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder;
+    std::vector<RewardModelBuilder<RewardValueType>>& rewardModelBuilders;
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder;
+    bool deterministicModel;
+    uint_fast64_t& currentRow;
+    uint_fast64_t& currentRowGroup;
+    bool firstChoiceOfState;
+};
+
+/*!
+ * Passes the behavior of explored states to an exporter that writes the model to a UMB archive.
+ */
+class UmbExporterSink {
+   public:
+    UmbExporterSink(storm::umb::UmbStreamingExporter& exporter, std::vector<storm::umb::UmbStreamingExporter::RewardModelInformation> const& rewardModels,
+                    bool exportChoiceLabels, bool isMarkovAutomaton)
+        : exporter(exporter), rewardModels(rewardModels), exportChoiceLabels(exportChoiceLabels), isMarkovAutomaton(isMarkovAutomaton) {
+        // Intentionally left empty.
+    }
+
+    void beginState() {
+        exporter.beginState();
+    }
+
+    void addStateReward(uint64_t rewardModelIndex, double value) {
+        if (rewardModels[rewardModelIndex].hasStateRewards) {
+            exporter.addStateReward(rewardModelIndex, value);
+        }
+    }
+
+    void beginChoice() {
+        exporter.beginChoice();
+    }
+
+    template<typename ChoiceType>
+    void beginChoice(ChoiceType const& choice) {
+        // Choices with multiple labels get the action that joins all labels.
+        std::string action;
+        if (exportChoiceLabels && choice.hasLabels()) {
+            for (auto const& label : choice.getLabels()) {
+                if (!action.empty()) {
+                    action += ",";
+                }
+                action += label;
+            }
+        }
+        exporter.beginChoice(action);
+    }
+
+    void setMarkovian() {
+        if (isMarkovAutomaton) {
+            exporter.setMarkovian();
+        }
+    }
+
+    void addBranch(uint64_t target, double value) {
+        exporter.addBranch(target, value);
+    }
+
+    void addChoiceReward(uint64_t rewardModelIndex, double value) {
+        if (rewardModels[rewardModelIndex].hasChoiceRewards) {
+            exporter.addChoiceReward(rewardModelIndex, value);
+        }
+    }
+
+    void endChoice() {
+        // The exporter closes choices implicitly.
+    }
+
+    void endState() {
+        // The exporter closes states implicitly.
+    }
+
+   private:
+    storm::umb::UmbStreamingExporter& exporter;
+    std::vector<storm::umb::UmbStreamingExporter::RewardModelInformation> const& rewardModels;
+    bool exportChoiceLabels;
+    bool isMarkovAutomaton;
+};
+}  // namespace detail
+
 template<typename StateType>
 StateType ExplicitStateLookup<StateType>::lookup(std::map<storm::expressions::Variable, storm::expressions::Expression> const& stateDescription) const {
     auto cs = storm::generator::createCompressedState(this->varInfo, stateDescription, true);
@@ -47,6 +321,7 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options()
     if (buildSettings.isExplorationStateLimitSet()) {
         explorationStateLimit = buildSettings.getExplorationStateLimit();
     }
+    numberOfThreads = buildSettings.getNumberOfExplorationThreads();
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -56,12 +331,24 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilde
     // Intentionally left empty.
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(
+    std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator,
+    std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> const& generatorFactory, Options const& options)
+    : ExplicitModelBuilder(generator, options) {
+    this->generatorFactory = generatorFactory;
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(storm::prism::Program const& program,
                                                                                   storm::generator::NextStateGeneratorOptions const& generatorOptions,
                                                                                   Options const& builderOptions)
     : ExplicitModelBuilder(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions), builderOptions) {
-    // Intentionally left empty.
+    if (this->options.numberOfThreads != 1) {
+        generatorFactory = [program, generatorOptions]() {
+            return std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program, generatorOptions);
+        };
+    }
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -70,7 +357,11 @@ ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilde
                                                                                   Options const& builderOptions)
     requires(!storm::IsIntervalType<ValueType>)
     : ExplicitModelBuilder(std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions), builderOptions) {
-    // Intentionally left empty.
+    if (this->options.numberOfThreads != 1) {
+        generatorFactory = [model, generatorOptions]() {
+            return std::make_shared<storm::generator::JaniNextStateGenerator<ValueType, StateType>>(model, generatorOptions);
+        };
+    }
 }
 
 template<typename ValueType, typename RewardModelType, typename StateType>
@@ -127,6 +418,167 @@ ExplicitStateLookup<StateType> ExplicitModelBuilder<ValueType, RewardModelType,
     return ExplicitStateLookup<StateType>(this->generator->getVariableInformation(), this->stateStorage.stateToId);
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+template<typename BehaviorSink, typename StateIndexMapping>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehavior(BehaviorSink& sink, CompressedState const& currentState,
+                                                                                  StateType currentIndex,
+                                                                                  storm::generator::StateBehavior<ValueType, StateType> const& behavior,
+                                                                                  bool stateLimitExceeded, StateIndexMapping const& getStateIndex) {
+    uint64_t const numberOfRewardModels = generator->getNumberOfRewardModels();
+    sink.beginState();
+    if (behavior.empty()) {
+        // There are three possible cases for missing behavior:
+        if (behavior.wasExpanded()) {
+            // (a) The state is a deadlock state, i.e. there is no behavior even though the state was expanded
+            STORM_LOG_THROW(options.fixDeadlocks, storm::exceptions::WrongFormatException,
+                            "Error while creating sparse matrix from probabilistic program: found deadlock state ("
+                                << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
+            this->stateStorage.deadlockStateIndices.push_back(currentIndex);
+        } else {
+            if (stateLimitExceeded) {
+                // (b) The state was not expanded because the state limit is reached
+                this->stateStorage.unexploredStateIndices.push_back(currentIndex);
+            }
+            // (c) the state was not expanded because it is terminal, i.e., exploration from that state is not required for the given property/ies
+        }
+
+        // In all cases, we need to add a self-loop to the transition matrix.
+        sink.beginChoice();
+        sink.addBranch(currentIndex, storm::utility::one<ValueType>());
+
+        for (uint64_t rewardModelIndex = 0; rewardModelIndex < numberOfRewardModels; ++rewardModelIndex) {
+            sink.addStateReward(rewardModelIndex, storm::utility::zero<typename RewardModelType::ValueType>());
+            sink.addChoiceReward(rewardModelIndex, storm::utility::zero<typename RewardModelType::ValueType>());
+        }
+
+        // This state shall be Markovian (to not introduce Zeno behavior)
+        sink.setMarkovian();
+        // Other state-based information does not need to be treated, in particular:
+        // * StateValuations have already been set above
+        // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
+
+        sink.endChoice();
+    } else {
+        // Add the state rewards to the corresponding reward models.
+        auto stateRewardIt = behavior.getStateRewards().begin();
+        for (uint64_t rewardModelIndex = 0; rewardModelIndex < numberOfRewardModels; ++rewardModelIndex, ++stateRewardIt) {
+            sink.addStateReward(rewardModelIndex, *stateRewardIt);
+        }
+
+        // Now add all choices.
+        for (auto const& choice : behavior) {
+            // add the generated choice information
+            sink.beginChoice(choice);
+            if (choice.isMarkovian()) {
+                sink.setMarkovian();
+            }
+
+            // Add the probabilistic behavior to the matrix.
+            for (auto const& stateProbabilityPair : choice) {
+                sink.addBranch(getStateIndex(stateProbabilityPair.first), stateProbabilityPair.second);
+            }
+
+            // Add the rewards to the reward models.
+            auto choiceRewardIt = choice.getRewards().begin();
+            for (uint64_t rewardModelIndex = 0; rewardModelIndex < numberOfRewardModels; ++rewardModelIndex, ++choiceRewardIt) {
+                sink.addChoiceReward(rewardModelIndex, *choiceRewardIt);
+            }
+            sink.endChoice();
+        }
+    }
+    sink.endState();
+}
+
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exploreStatesConcurrently(
+    storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+    std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+    StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup,
+    std::function<void(uint64_t)> const& onStatesExplored) {
+    STORM_LOG_ASSERT(generatorFactory, "Concurrent exploration requires a generator factory.");
+    STORM_LOG_ASSERT(options.explorationOrder == ExplorationOrder::Bfs, "Concurrent exploration requires breadth-first order.");
+    auto threadPool = storm::utility::ThreadPool::getShared(options.numberOfThreads);
+
+    // Each worker expands states with its own generator. The first worker uses the generator of this builder.
+    std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> workerGenerators(threadPool->getNumberOfWorkers());
+    workerGenerators.front() = generator;
+    for (auto workerGeneratorIt = workerGenerators.begin() + 1; workerGeneratorIt != workerGenerators.end(); ++workerGeneratorIt) {
+        *workerGeneratorIt = generatorFactory();
+    }
+
+    detail::ConcurrentStateIndex newStateIndices(generator->getStateSize());
+    std::vector<std::pair<CompressedState, StateType>> batch;
+    std::vector<storm::generator::StateBehavior<ValueType, StateType>> behaviors;
+    // For each state of the batch, the (preliminary) indices of the newly discovered successors in the order in which they were requested.
+    std::vector<std::vector<uint64_t>> discoveredStates;
+    std::vector<StateType> newStateToIndex;
+
+    while (!statesToExplore.empty()) {
+        uint64_t const batchSize = std::min<uint64_t>(statesToExplore.size(), detail::explorationBatchSize);
+        batch.assign(std::make_move_iterator(statesToExplore.begin()), std::make_move_iterator(statesToExplore.begin() + batchSize));
+        statesToExplore.erase(statesToExplore.begin(), statesToExplore.begin() + batchSize);
+        behaviors.assign(batchSize, storm::generator::StateBehavior<ValueType, StateType>());
+        discoveredStates.resize(batchSize);
+        for (auto& discovered : discoveredStates) {
+            discovered.clear();
+        }
+        newStateIndices.clear();
+
+        // Expand the states concurrently. The state storage is not modified during this phase, so that states that are already known can be looked up
+        // concurrently. Newly discovered states get preliminary indices that are larger than all indices of known states.
+        uint64_t const numberOfKnownStates = stateStorage.getNumberOfStates();
+        uint64_t const numberOfChunks = (batchSize + detail::explorationChunkSize - 1) / detail::explorationChunkSize;
+        threadPool->parallelFor(numberOfChunks, [&](uint64_t chunkIndex, uint64_t workerIndex) {
+            auto& workerGenerator = *workerGenerators[workerIndex];
+            uint64_t const chunkEnd = std::min<uint64_t>(batchSize, (chunkIndex + 1) * detail::explorationChunkSize);
+            for (uint64_t batchIndex = chunkIndex * detail::explorationChunkSize; batchIndex < chunkEnd; ++batchIndex) {
+                auto& discovered = discoveredStates[batchIndex];
+                std::function<StateType(CompressedState const&)> stateToIdCallback = [&](CompressedState const& state) -> StateType {
+                    if (auto knownIndex = stateStorage.stateToId.find(state)) {
+                        return *knownIndex;
+                    }
+                    uint64_t const newStateIndex = newStateIndices.findOrAdd(state);
+                    discovered.push_back(newStateIndex);
+                    STORM_LOG_ASSERT(numberOfKnownStates + newStateIndex < std::numeric_limits<StateType>::max(), "State index out of range.");
+                    return static_cast<StateType>(numberOfKnownStates + newStateIndex);
+                };
+                workerGenerator.load(batch[batchIndex].first);
+                behaviors[batchIndex] = workerGenerator.expand(stateToIdCallback);
+            }
+        });
+
+        // Assign the actual indices to the newly discovered states. To obtain the same indices as in a sequential exploration, we consider the states
+        // of the batch in the order in which they were explored and their successors in the order in which they were requested by the generator.
+        std::vector<CompressedState> newStates = newStateIndices.getStates();
+        newStateToIndex.assign(newStates.size(), std::numeric_limits<StateType>::max());
+        for (auto const& discovered : discoveredStates) {
+            for (auto const& newStateIndex : discovered) {
+                if (newStateToIndex[newStateIndex] == std::numeric_limits<StateType>::max()) {
+                    newStateToIndex[newStateIndex] = getOrAddStateIndex(newStates[newStateIndex]);
+                }
+            }
+        }
+
+        // Add the behaviors of the states in the order in which they were explored.
+        auto getStateIndex = [&numberOfKnownStates, &newStateToIndex](StateType const& index) {
+            return index < numberOfKnownStates ? index : newStateToIndex[index - numberOfKnownStates];
+        };
+        detail::ComponentBuilderSink<ValueType, typename RewardModelType::ValueType> sink(
+            transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder, generator->isDeterministicModel(), currentRow, currentRowGroup);
+        for (uint64_t batchIndex = 0; batchIndex < batchSize; ++batchIndex) {
+            auto const& [currentState, currentIndex] = batch[batchIndex];
+            STORM_LOG_ASSERT(currentIndex == currentRowGroup, "Unexpected index of explored state.");
+            if (stateAndChoiceInformationBuilder.isBuildStateValuations()) {
+                generator->load(currentState);
+                generator->addStateValuation(currentIndex, stateAndChoiceInformationBuilder.stateValuationsBuilder());
+            }
+            addStateBehavior(sink, currentState, currentIndex, behaviors[batchIndex], false, getStateIndex);
+        }
+
+        onStatesExplored(batchSize);
+    }
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
@@ -157,10 +609,26 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     uint_fast64_t currentRowGroup = 0;
     uint_fast64_t currentRow = 0;
 
-    auto timeOfStart = std::chrono::high_resolution_clock::now();
-    auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
-    uint64_t numberOfExploredStates = 0;
-    uint64_t numberOfExploredStatesSinceLastMessage = 0;
+    detail::ExplorationProgress progress(generator->getOptions().isShowProgressSet(), generator->getOptions().getShowProgressDelay());
+    auto onStatesExplored = [&progress](uint64_t numberOfStates) { progress.addExploredStates(numberOfStates); };
+    detail::ComponentBuilderSink<ValueType, typename RewardModelType::ValueType> sink(
+        transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder, generator->isDeterministicModel(), currentRow, currentRowGroup);
+
+    // Expanding states concurrently requires additional generators. Moreover, the state indices only coincide with the sequential exploration if
+    // states are explored in breadth-first order and if the generator does not keep track of state indices by itself.
+    // Exact and parametric value types are always explored sequentially as their arithmetic is not safe to be used concurrently.
+    if (options.numberOfThreads != 1) {
+        STORM_LOG_WARN_COND((std::is_same_v<ValueType, double>),
+                            "States are expanded sequentially as concurrent expansion is only supported for models with floating point values.");
+        bool const canExploreConcurrently = std::is_same_v<ValueType, double> && generatorFactory && options.explorationOrder == ExplorationOrder::Bfs &&
+                                            !options.explorationStateLimit.has_value() && !generator->getOptions().isAddOverlappingGuardLabelSet();
+        STORM_LOG_WARN_COND(!std::is_same_v<ValueType, double> || canExploreConcurrently,
+                            "States are expanded sequentially as concurrent expansion is not supported for the given settings.");
+        if (canExploreConcurrently) {
+            exploreStatesConcurrently(transitionMatrixBuilder, rewardModelBuilders, stateAndChoiceInformationBuilder, currentRow, currentRowGroup,
+                                      onStatesExplored);
+        }
+    }
 
     // Perform a search through the model.
     while (!statesToExplore.empty()) {
@@ -191,131 +659,9 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
             behavior = generator->expand(stateToIdCallback);
         }
 
-        if (behavior.empty()) {
-            // There are three possible cases for missing behavior:
-            if (behavior.wasExpanded()) {
-                // (a) The state is a deadlock state, i.e. there is no behavior even though the state was expanded
-                STORM_LOG_THROW(options.fixDeadlocks, storm::exceptions::WrongFormatException,
-                                "Error while creating sparse matrix from probabilistic program: found deadlock state ("
-                                    << generator->stateToString(currentState) << "). For fixing these, please provide the appropriate option.");
-                this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-            } else {
-                if (stateLimitExceeded) {
-                    // (b) The state was not expanded because the state limit is reached
-                    this->stateStorage.unexploredStateIndices.push_back(currentIndex);
-                }
-                // (c) the state was not expanded because it is terminal, i.e., exploration from that state is not required for the given property/ies
-            }
-
-            // In all cases, we need to add a self-loop to the transition matrix.
-
-            if (!generator->isDeterministicModel()) {
-                transitionMatrixBuilder.newRowGroup(currentRow);
-            }
-
-            transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-
-            for (auto& rewardModelBuilder : rewardModelBuilders) {
-                if (rewardModelBuilder.hasStateRewards()) {
-                    rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                }
-
-                if (rewardModelBuilder.hasStateActionRewards()) {
-                    rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                }
-            }
-
-            // This state shall be Markovian (to not introduce Zeno behavior)
-            if (stateAndChoiceInformationBuilder.isBuildMarkovianStates()) {
-                stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-            }
-            // Other state-based information does not need to be treated, in particular:
-            // * StateValuations have already been set above
-            // * The associated player shall be the "default" player, i.e. INVALID_PLAYER_INDEX
-
-            ++currentRow;
-            ++currentRowGroup;
-        } else {
-            // Add the state rewards to the corresponding reward models.
-            auto stateRewardIt = behavior.getStateRewards().begin();
-            for (auto& rewardModelBuilder : rewardModelBuilders) {
-                if (rewardModelBuilder.hasStateRewards()) {
-                    rewardModelBuilder.addStateReward(*stateRewardIt);
-                }
-                ++stateRewardIt;
-            }
-
-            // If the model is nondeterministic, we need to open a row group.
-            if (!generator->isDeterministicModel()) {
-                transitionMatrixBuilder.newRowGroup(currentRow);
-            }
-
-            // Now add all choices.
-            bool firstChoiceOfState = true;
-            for (auto const& choice : behavior) {
-                // add the generated choice information
-                if (stateAndChoiceInformationBuilder.isBuildChoiceLabels() && choice.hasLabels()) {
-                    for (auto const& label : choice.getLabels()) {
-                        stateAndChoiceInformationBuilder.addChoiceLabel(label, currentRow);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildChoiceOrigins() && choice.hasOriginData()) {
-                    stateAndChoiceInformationBuilder.addChoiceOriginData(choice.getOriginData(), currentRow);
-                }
-                if (stateAndChoiceInformationBuilder.isBuildStatePlayerIndications() && choice.hasPlayerIndex()) {
-                    STORM_LOG_ASSERT(
-                        firstChoiceOfState || stateAndChoiceInformationBuilder.hasStatePlayerIndicationBeenSet(choice.getPlayerIndex(), currentRowGroup),
-                        "There is a state where different players have an enabled choice.");  // Should have been detected in generator, already
-                    if (firstChoiceOfState) {
-                        stateAndChoiceInformationBuilder.addStatePlayerIndication(choice.getPlayerIndex(), currentRowGroup);
-                    }
-                }
-                if (stateAndChoiceInformationBuilder.isBuildMarkovianStates() && choice.isMarkovian()) {
-                    stateAndChoiceInformationBuilder.addMarkovianState(currentRowGroup);
-                }
-
-                // Add the probabilistic behavior to the matrix.
-                for (auto const& stateProbabilityPair : choice) {
-                    transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                }
-
-                // Add the rewards to the reward models.
-                auto choiceRewardIt = choice.getRewards().begin();
-                for (auto& rewardModelBuilder : rewardModelBuilders) {
-                    if (rewardModelBuilder.hasStateActionRewards()) {
-                        rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                    }
-                    ++choiceRewardIt;
-                }
-                ++currentRow;
-                firstChoiceOfState = false;
-            }
-
-            ++currentRowGroup;
-        }
-
-        ++numberOfExploredStates;
-        if (generator->getOptions().isShowProgressSet()) {
-            ++numberOfExploredStatesSinceLastMessage;
-
-            auto now = std::chrono::high_resolution_clock::now();
-            auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
-            if (static_cast<uint64_t>(durationSinceLastMessage) >= generator->getOptions().getShowProgressDelay()) {
-                auto statesPerSecond = numberOfExploredStatesSinceLastMessage / durationSinceLastMessage;
-                auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
-                std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds (currently " << statesPerSecond
-                          << " states per second).\n";
-                timeOfLastMessage = std::chrono::high_resolution_clock::now();
-                numberOfExploredStatesSinceLastMessage = 0;
-            }
-        }
+        addStateBehavior(sink, currentState, currentIndex, behavior, stateLimitExceeded, [](StateType const& index) { return index; });
 
-        if (storm::utility::resources::isTerminate()) {
-            auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::high_resolution_clock::now() - timeOfStart).count();
-            std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds before abort.\n";
-            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
-            break;
-        }
+        progress.addExploredStates(1);
     }
 
     // If the exploration order was not breadth-first, we need to fix the entries in the matrix according to
@@ -347,6 +693,85 @@ void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(
     }
 }
 
+template<typename ValueType, typename RewardModelType, typename StateType>
+void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exportToUmb(std::filesystem::path const& archivePath,
+                                                                             storm::umb::ExportOptions const& exportOptions) {
+    if constexpr (!std::is_same_v<ValueType, double> || !std::is_same_v<typename RewardModelType::ValueType, double>) {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Exporting models to UMB during exploration is only supported for double values.");
+    } else {
+        STORM_LOG_THROW(options.explorationOrder == ExplorationOrder::Bfs, storm::exceptions::NotSupportedException,
+                        "Exporting models to UMB during exploration requires breadth-first exploration.");
+        STORM_LOG_THROW(!generator->getOptions().isBuildStateValuationsSet(), storm::exceptions::NotSupportedException,
+                        "State valuations are not yet supported for UMB export.");
+        STORM_LOG_WARN_COND(!exportOptions.allowChoiceOriginsAsActions || !generator->getOptions().isBuildChoiceOriginsSet(),
+                            "Choice origins are not exported when exporting models to UMB during exploration.");
+        STORM_LOG_WARN_COND(options.numberOfThreads == 1, "States are expanded sequentially when exporting models to UMB during exploration.");
+
+        storm::models::ModelType modelType;
+        switch (generator->getModelType()) {
+            case storm::generator::ModelType::DTMC:
+                modelType = storm::models::ModelType::Dtmc;
+                break;
+            case storm::generator::ModelType::CTMC:
+                modelType = storm::models::ModelType::Ctmc;
+                break;
+            case storm::generator::ModelType::MDP:
+                modelType = storm::models::ModelType::Mdp;
+                break;
+            case storm::generator::ModelType::MA:
+                modelType = storm::models::ModelType::MarkovAutomaton;
+                break;
+            default:
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                                "Exporting models to UMB during exploration is not supported for this model type.");
+        }
+
+        std::vector<storm::umb::UmbStreamingExporter::RewardModelInformation> rewardModels;
+        for (uint64_t i = 0; i < generator->getNumberOfRewardModels(); ++i) {
+            auto const& rewardModelInformation = generator->getRewardModelInformation(i);
+            rewardModels.push_back(
+                {rewardModelInformation.getName(), rewardModelInformation.hasStateRewards(), rewardModelInformation.hasStateActionRewards()});
+        }
+        bool const exportChoiceLabels = exportOptions.allowChoiceLabelingAsActions && generator->getOptions().isBuildChoiceLabelsSet();
+        storm::umb::UmbStreamingExporter exporter(modelType, rewardModels, exportChoiceLabels, exportOptions);
+
+        // Create a callback for the next-state generator to enable it to request the index of states.
+        std::function<StateType(CompressedState const&)> stateToIdCallback =
+            std::bind(&ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex, this, std::placeholders::_1);
+
+        // Let the generator create all initial states.
+        this->stateStorage.initialStateIndices = generator->getInitialStates(stateToIdCallback);
+        STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException,
+                        "The model does not have a single initial state.");
+
+        detail::ExplorationProgress progress(generator->getOptions().isShowProgressSet(), generator->getOptions().getShowProgressDelay());
+        detail::UmbExporterSink sink(exporter, rewardModels, exportChoiceLabels, modelType == storm::models::ModelType::MarkovAutomaton);
+
+        // As the states are explored in breadth-first order, they are added to the exporter in the order of their indices.
+        while (!statesToExplore.empty()) {
+            CompressedState currentState = statesToExplore.front().first;
+            StateType currentIndex = statesToExplore.front().second;
+            statesToExplore.pop_front();
+            STORM_LOG_ASSERT(currentIndex == exporter.getNumberOfStates(), "Unexpected index of explored state.");
+
+            generator->load(currentState);
+            storm::generator::StateBehavior<ValueType, StateType> behavior;
+            // If the exploration state limit is set and the limit is reached, we stop the exploration.
+            bool const stateLimitExceeded =
+                options.explorationStateLimit.has_value() && stateStorage.getNumberOfStates() >= options.explorationStateLimit.value();
+            if (!stateLimitExceeded) {
+                behavior = generator->expand(stateToIdCallback);
+            }
+
+            addStateBehavior(sink, currentState, currentIndex, behavior, stateLimitExceeded, [](StateType const& index) { return index; });
+
+            progress.addExploredStates(1);
+        }
+
+        exporter.writeArchive(archivePath, buildStateLabeling());
+    }
+}
+
 template<typename ValueType, typename RewardModelType, typename StateType>
 storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildModelComponents() {
     // Determine whether we have to combine different choices to one or whether this model can have more than
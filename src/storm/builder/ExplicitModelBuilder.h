@@ -6,6 +6,8 @@
 #include <boost/variant.hpp>
 #include <cstdint>
 #include <deque>
+#include <filesystem>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -20,6 +22,7 @@
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/storage/sparse/StateStorage.h"
+#include "storm/storage/umb/export/ExportOptions.h"
 
 #include "storm/utility/prism.h"
 
@@ -82,6 +85,10 @@ class ExplicitModelBuilder {
 
         // If set, no further states will be explored once the given number is exceeded.
         std::optional<StateType> explorationStateLimit;
+
+        // The number of threads that expand states concurrently (0 means auto-detect). Concurrent expansion is only supported for PRISM programs and
+        // JANI models that are explored in breadth-first order. The resulting model does not depend on the number of threads.
+        uint64_t numberOfThreads;
     };
 
     /*!
@@ -91,6 +98,16 @@ class ExplicitModelBuilder {
      */
     ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options = Options());
 
+    /*!
+     * Creates an explicit model builder that uses the provided generator.
+     *
+     * @param generator The generator to use.
+     * @param generatorFactory Creates additional generators (equivalent to the given one) that are used to expand states concurrently.
+     */
+    ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator,
+                         std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> const& generatorFactory,
+                         Options const& options = Options());
+
     /*!
      * Creates an explicit model builder for the given PRISM program.
      *
@@ -119,6 +136,17 @@ class ExplicitModelBuilder {
      */
     std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> build();
 
+    /*!
+     * Explores the state space and writes the model to the given UMB archive while exploring it. In contrast to exporting the result of build(),
+     * the transition matrix, the rewards and the choice labels are never held in memory as they are streamed into temporary files.
+     * Only the information on the explored states (which is needed to identify them) and the state labeling are kept in memory.
+     *
+     * @note This is only supported for DTMCs, CTMCs, MDPs and MAs with double values that are explored sequentially in breadth-first order.
+     * @param archivePath The path of the UMB archive.
+     * @param exportOptions The options for the export. Choice origins and state valuations are not supported.
+     */
+    void exportToUmb(std::filesystem::path const& archivePath, storm::umb::ExportOptions const& exportOptions = {});
+
     /*!
      * Export a wrapper that contains (a copy of) the internal information that maps states to ids.
      * This wrapper can be helpful to find states in later stages.
@@ -138,6 +166,34 @@ class ExplicitModelBuilder {
      */
     StateType getOrAddStateIndex(CompressedState const& state);
 
+    /*!
+     * Adds the given behavior of the given state to the given sink. States without behavior get a self-loop (and zero rewards).
+     *
+     * @param sink The sink that receives the state, its choices, branches and rewards, e.g., the builders of the model components.
+     * @param currentState The state whose behavior is added.
+     * @param currentIndex The index of the state.
+     * @param behavior The behavior of the state.
+     * @param stateLimitExceeded True if the state was not expanded because the exploration state limit is reached.
+     * @param getStateIndex Maps the indices of the successor states occurring in the behavior to the actual state indices.
+     */
+    template<typename BehaviorSink, typename StateIndexMapping>
+    void addStateBehavior(BehaviorSink& sink, CompressedState const& currentState, StateType currentIndex,
+                          storm::generator::StateBehavior<ValueType, StateType> const& behavior, bool stateLimitExceeded,
+                          StateIndexMapping const& getStateIndex);
+
+    /*!
+     * Explores all states that still need to be explored, where batches of states are expanded concurrently by multiple generators.
+     * The states get the same indices as in a sequential breadth-first exploration.
+     *
+     * @param currentRow The next row of the transition matrix. Is updated during the exploration.
+     * @param currentRowGroup The next row group of the transition matrix. Is updated during the exploration.
+     * @param onStatesExplored Is invoked with the number of states after a batch of states has been explored.
+     */
+    void exploreStatesConcurrently(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder,
+                                   std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders,
+                                   StateAndChoiceInformationBuilder& stateAndChoiceInformationBuilder, uint_fast64_t& currentRow,
+                                   uint_fast64_t& currentRowGroup, std::function<void(uint64_t)> const& onStatesExplored);
+
     /*!
      * Builds the transition matrix and the transition reward matrix based for the given program.
      *
@@ -166,6 +222,9 @@ class ExplicitModelBuilder {
     /// The generator to use for the building process.
     std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
 
+    /// If set, creates additional generators (equivalent to the one above) that are used to expand states concurrently.
+    std::function<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>()> generatorFactory;
+
     /// The options to be used for the building process.
     Options options;
 
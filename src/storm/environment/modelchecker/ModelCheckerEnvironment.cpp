@@ -18,6 +18,7 @@ ModelCheckerEnvironment::ModelCheckerEnvironment() {
     if (mcSettings.isLtl2daToolSet()) {
         ltl2daTool = mcSettings.getLtl2daTool();
     }
+    numberOfGraphAnalysisThreads = mcSettings.getNumberOfGraphAnalysisThreads();
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     steadyStateDistributionAlgorithm = ioSettings.getSteadyStateDistributionAlgorithm();
 }
@@ -66,4 +67,12 @@ void ModelCheckerEnvironment::unsetLtl2daTool() {
     ltl2daTool = boost::none;
 }
 
+uint64_t ModelCheckerEnvironment::getNumberOfGraphAnalysisThreads() const {
+    return numberOfGraphAnalysisThreads;
+}
+
+void ModelCheckerEnvironment::setNumberOfGraphAnalysisThreads(uint64_t value) {
+    numberOfGraphAnalysisThreads = value;
+}
+
 }  // namespace storm
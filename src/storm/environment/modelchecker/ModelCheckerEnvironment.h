@@ -32,10 +32,14 @@ class ModelCheckerEnvironment {
     void setLtl2daTool(std::string const& value);
     void unsetLtl2daTool();
 
+    uint64_t getNumberOfGraphAnalysisThreads() const;
+    void setNumberOfGraphAnalysisThreads(uint64_t value);
+
    private:
     SubEnvironment<ConditionalModelCheckerEnvironment> conditionalModelCheckerEnvironment;
     SubEnvironment<MultiObjectiveModelCheckerEnvironment> multiObjectiveModelCheckerEnvironment;
     boost::optional<std::string> ltl2daTool;
     SteadyStateDistributionAlgorithm steadyStateDistributionAlgorithm;
+    uint64_t numberOfGraphAnalysisThreads;
 };
 }  // namespace storm
@@ -26,6 +26,7 @@ NativeSolverEnvironment::NativeSolverEnvironment() {
     powerMethodMultiplicationStyle = nativeSettings.getPowerMethodMultiplicationStyle();
     sorOmega = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getOmega());
     symmetricUpdates = nativeSettings.isForceIntervalIterationSymmetricUpdatesSet();
+    numberOfThreads = nativeSettings.getNumberOfThreads();
 }
 
 NativeSolverEnvironment::~NativeSolverEnvironment() {
@@ -93,4 +94,12 @@ void NativeSolverEnvironment::setSymmetricUpdates(bool value) {
     symmetricUpdates = value;
 }
 
+uint64_t const& NativeSolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void NativeSolverEnvironment::setNumberOfThreads(uint64_t value) {
+    numberOfThreads = value;
+}
+
 }  // namespace storm
@@ -27,6 +27,8 @@ class NativeSolverEnvironment {
     void setSorOmega(storm::RationalNumber const& value);
     bool isSymmetricUpdatesSet() const;
     void setSymmetricUpdates(bool value);
+    uint64_t const& getNumberOfThreads() const;
+    void setNumberOfThreads(uint64_t value);
 
    private:
     storm::solver::NativeLinearEquationSolverMethod method;
@@ -37,5 +39,6 @@ class NativeSolverEnvironment {
     storm::solver::MultiplicationStyle powerMethodMultiplicationStyle;
     storm::RationalNumber sorOmega;
     bool symmetricUpdates;
+    uint64_t numberOfThreads;
 };
 }  // namespace storm
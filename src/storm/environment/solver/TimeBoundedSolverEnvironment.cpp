@@ -14,6 +14,7 @@ TimeBoundedSolverEnvironment::TimeBoundedSolverEnvironment() {
     precision = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getPrecision());
     relative = tbSettings.isRelativePrecision();
     unifPlusKappa = storm::utility::convertNumber<storm::RationalNumber>(tbSettings.getUnifPlusKappa());
+    numberOfThreads = tbSettings.getNumberOfThreads();
 }
 
 TimeBoundedSolverEnvironment::~TimeBoundedSolverEnvironment() {
@@ -57,4 +58,12 @@ void TimeBoundedSolverEnvironment::setUnifPlusKappa(storm::RationalNumber value)
     unifPlusKappa = value;
 }
 
+uint64_t const& TimeBoundedSolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void TimeBoundedSolverEnvironment::setNumberOfThreads(uint64_t value) {
+    numberOfThreads = value;
+}
+
 }  // namespace storm
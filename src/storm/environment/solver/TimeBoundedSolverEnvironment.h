@@ -23,6 +23,9 @@ class TimeBoundedSolverEnvironment {
     storm::RationalNumber const& getUnifPlusKappa() const;
     void setUnifPlusKappa(storm::RationalNumber value);
 
+    uint64_t const& getNumberOfThreads() const;
+    void setNumberOfThreads(uint64_t value);
+
    private:
     storm::solver::MaBoundedReachabilityMethod maMethod;
     bool maMethodSetFromDefault;
@@ -31,5 +34,7 @@ class TimeBoundedSolverEnvironment {
     bool relative;
 
     storm::RationalNumber unifPlusKappa;
+
+    uint64_t numberOfThreads;
 };
 }  // namespace storm
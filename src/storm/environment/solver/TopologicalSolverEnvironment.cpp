@@ -16,6 +16,7 @@ TopologicalSolverEnvironment::TopologicalSolverEnvironment() {
     underlyingMinMaxMethod = topologicalSettings.getUnderlyingMinMaxMethod();
     underlyingMinMaxMethodSetFromDefault = topologicalSettings.isUnderlyingMinMaxMethodSetFromDefaultValue();
     extendRelevantValues = topologicalSettings.isExtendRelevantValues();
+    numberOfThreads = topologicalSettings.getNumberOfThreads();
 }
 
 TopologicalSolverEnvironment::~TopologicalSolverEnvironment() {
@@ -60,4 +61,12 @@ void TopologicalSolverEnvironment::setExtendRelevantValues(bool value) {
     extendRelevantValues = value;
 }
 
+uint64_t const& TopologicalSolverEnvironment::getNumberOfThreads() const {
+    return numberOfThreads;
+}
+
+void TopologicalSolverEnvironment::setNumberOfThreads(uint64_t value) {
+    numberOfThreads = value;
+}
+
 }  // namespace storm
@@ -22,6 +22,9 @@ class TopologicalSolverEnvironment {
     bool isExtendRelevantValues() const;
     void setExtendRelevantValues(bool value);
 
+    uint64_t const& getNumberOfThreads() const;
+    void setNumberOfThreads(uint64_t value);
+
    private:
     storm::solver::EquationSolverType underlyingEquationSolverType;
     bool underlyingEquationSolverTypeSetFromDefault;
@@ -29,5 +32,6 @@ class TopologicalSolverEnvironment {
     storm::solver::MinMaxMethod underlyingMinMaxMethod;
     bool underlyingMinMaxMethodSetFromDefault;
     bool extendRelevantValues;
+    uint64_t numberOfThreads;
 };
 }  // namespace storm
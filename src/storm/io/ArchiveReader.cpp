@@ -1,8 +1,19 @@
 #include "storm/io/ArchiveReader.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
 #include <array>
+#include <cerrno>
+#include <cstdint>
 #include <cstring>
 #include <fstream>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string_view>
 
 #include "storm/storage/BitVector.h"
 #include "storm/utility/bitoperations.h"
@@ -13,6 +24,215 @@
 
 namespace storm::io {
 
+struct ArchiveReader::MappedEntry {
+    std::filesystem::path name;
+    bool isDir;
+    char const* data;
+    uint64_t size;
+};
+
+class ArchiveReader::MappedArchive {
+   public:
+    /*!
+     * Maps the given file to memory and determines the locations of its entries.
+     * @return the mapped archive or nullptr if the file is not an uncompressed tar archive (or uses tar features that we do not handle).
+     */
+    static std::shared_ptr<MappedArchive const> create(std::filesystem::path const& file);
+
+    MappedArchive(MappedArchive const&) = delete;
+    MappedArchive& operator=(MappedArchive const&) = delete;
+    ~MappedArchive();
+
+    std::vector<MappedEntry> const& getEntries() const;
+
+   private:
+    static constexpr uint64_t BlockSize = 512;
+
+    MappedArchive(int fileDescriptor, char const* data, uint64_t size);
+
+    /*!
+     * Scans the tar headers and collects the entries.
+     * @return false if the data is not a tar archive that can be read directly.
+     */
+    bool indexEntries();
+
+    int const fileDescriptor;
+    char const* const data;
+    uint64_t const size;
+    std::vector<MappedEntry> entries;
+};
+
+namespace detail {
+/*!
+ * Parses a numeric field of a tar header which is either octal (terminated by a space or a null character) or in the base-256 encoding of GNU tar.
+ */
+std::optional<uint64_t> parseTarNumber(char const* field, uint64_t length) {
+    uint64_t result = 0;
+    if (static_cast<unsigned char>(field[0]) & 0x80) {
+        result = static_cast<unsigned char>(field[0]) & 0x7f;
+        for (uint64_t i = 1; i < length; ++i) {
+            if (result >> 56) {
+                return std::nullopt;  // overflow
+            }
+            result = (result << 8) | static_cast<unsigned char>(field[i]);
+        }
+        return result;
+    }
+    uint64_t i = 0;
+    while (i < length && field[i] == ' ') {
+        ++i;
+    }
+    for (; i < length && field[i] != ' ' && field[i] != '\0'; ++i) {
+        if (field[i] < '0' || field[i] > '7' || (result >> 61)) {
+            return std::nullopt;
+        }
+        result = (result << 3) | static_cast<uint64_t>(field[i] - '0');
+    }
+    return result;
+}
+
+/*!
+ * Checks the checksum of a tar header, i.e., the sum of all header bytes where the checksum field itself is treated as spaces.
+ */
+bool hasValidTarChecksum(char const* header, uint64_t blockSize) {
+    auto const expected = parseTarNumber(header + 148, 8);
+    uint64_t actual = 0;
+    for (uint64_t i = 0; i < blockSize; ++i) {
+        actual += (i >= 148 && i < 156) ? static_cast<uint64_t>(' ') : static_cast<unsigned char>(header[i]);
+    }
+    return expected.has_value() && expected.value() == actual;
+}
+
+std::string_view tarHeaderField(char const* field, uint64_t length) {
+    return std::string_view(field, std::find(field, field + length, '\0') - field);
+}
+
+/*!
+ * Parses the records "<length> <key>=<value>\n" of a pax extended header and extracts the path and size (if present).
+ */
+bool parsePaxRecords(std::string_view records, std::optional<std::string>& path, std::optional<uint64_t>& size) {
+    while (!records.empty()) {
+        uint64_t recordLength = 0;
+        uint64_t pos = 0;
+        for (; pos < records.size() && records[pos] >= '0' && records[pos] <= '9'; ++pos) {
+            recordLength = recordLength * 10 + static_cast<uint64_t>(records[pos] - '0');
+        }
+        if (pos == records.size() || records[pos] != ' ' || recordLength <= pos + 1 || recordLength > records.size() || records[recordLength - 1] != '\n') {
+            return false;
+        }
+        auto const record = records.substr(pos + 1, recordLength - pos - 2);
+        auto const separator = record.find('=');
+        if (separator == std::string_view::npos) {
+            return false;
+        }
+        auto const key = record.substr(0, separator);
+        auto const value = record.substr(separator + 1);
+        if (key == "path") {
+            path = std::string(value);
+        } else if (key == "size") {
+            uint64_t parsedSize = 0;
+            for (auto c : value) {
+                if (c < '0' || c > '9') {
+                    return false;
+                }
+                parsedSize = parsedSize * 10 + static_cast<uint64_t>(c - '0');
+            }
+            size = parsedSize;
+        }
+        records.remove_prefix(recordLength);
+    }
+    return true;
+}
+}  // namespace detail
+
+std::shared_ptr<ArchiveReader::MappedArchive const> ArchiveReader::MappedArchive::create(std::filesystem::path const& file) {
+    int const fileDescriptor = open(file.c_str(), O_RDONLY);
+    if (fileDescriptor < 0) {
+        return nullptr;
+    }
+    struct stat fileStatus;
+    if (fstat(fileDescriptor, &fileStatus) != 0 || !S_ISREG(fileStatus.st_mode) || static_cast<uint64_t>(fileStatus.st_size) < BlockSize) {
+        close(fileDescriptor);
+        return nullptr;
+    }
+    void* data = mmap(nullptr, fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    if (data == MAP_FAILED) {
+        STORM_LOG_DEBUG("Unable to map " << file << " to memory: " << std::strerror(errno));
+        close(fileDescriptor);
+        return nullptr;
+    }
+    std::shared_ptr<MappedArchive> result(new MappedArchive(fileDescriptor, static_cast<char const*>(data), fileStatus.st_size));
+    if (!result->indexEntries()) {
+        STORM_LOG_DEBUG("File " << file << " is not an uncompressed tar archive that can be read from memory.");
+        return nullptr;
+    }
+    // The entries are typically read in the order in which they appear in the archive.
+    madvise(data, fileStatus.st_size, MADV_SEQUENTIAL);
+    return result;
+}
+
+ArchiveReader::MappedArchive::MappedArchive(int fileDescriptor, char const* data, uint64_t size) : fileDescriptor(fileDescriptor), data(data), size(size) {
+    // Intentionally left empty.
+}
+
+ArchiveReader::MappedArchive::~MappedArchive() {
+    munmap(const_cast<char*>(data), size);
+    close(fileDescriptor);
+}
+
+std::vector<ArchiveReader::MappedEntry> const& ArchiveReader::MappedArchive::getEntries() const {
+    return entries;
+}
+
+bool ArchiveReader::MappedArchive::indexEntries() {
+    // Name and size of the next entry as given by a preceding pax extended header or GNU long name entry.
+    std::optional<std::string> nextName;
+    std::optional<uint64_t> nextSize;
+    uint64_t offset = 0;
+    while (offset + BlockSize <= size) {
+        char const* header = data + offset;
+        if (std::all_of(header, header + BlockSize, [](char c) { return c == '\0'; })) {
+            return true;  // end-of-archive marker
+        }
+        if (std::memcmp(header + 257, "ustar", 5) != 0 || !detail::hasValidTarChecksum(header, BlockSize)) {
+            return false;
+        }
+        auto entrySize = detail::parseTarNumber(header + 124, 12);
+        char const typeFlag = header[156];
+        bool const isFileOrDir = typeFlag == '0' || typeFlag == '\0' || typeFlag == '5';
+        if (isFileOrDir && nextSize.has_value()) {
+            entrySize = nextSize;
+        }
+        uint64_t const dataOffset = offset + BlockSize;
+        if (!entrySize.has_value() || entrySize.value() > size - dataOffset) {
+            return false;
+        }
+        std::string_view const entryData(data + dataOffset, entrySize.value());
+        if (typeFlag == 'x') {
+            if (!detail::parsePaxRecords(entryData, nextName, nextSize)) {
+                return false;
+            }
+        } else if (typeFlag == 'L') {
+            nextName = std::string(detail::tarHeaderField(entryData.data(), entryData.size()));
+        } else if (isFileOrDir) {
+            if (!nextName.has_value()) {
+                // The full name is the prefix (if present) followed by the name
+                auto const prefix = detail::tarHeaderField(header + 345, 155);
+                auto const name = detail::tarHeaderField(header, 100);
+                nextName = prefix.empty() ? std::string(name) : std::string(prefix) + "/" + std::string(name);
+            }
+            bool const isDir = typeFlag == '5';
+            entries.push_back({std::move(nextName.value()), isDir, entryData.data(), isDir ? 0 : entryData.size()});
+            nextName.reset();
+            nextSize.reset();
+        } else if (typeFlag != 'g') {
+            return false;  // Links, devices, etc. are left to libarchive
+        }
+        offset = dataOffset + (entrySize.value() + BlockSize - 1) / BlockSize * BlockSize;
+    }
+    return offset == size;
+}
+
 #ifdef STORM_HAVE_LIBARCHIVE
 /*!
  * Checks the result of an archive operation and throws an exception if the result is not ok.
@@ -37,7 +257,14 @@ ArchiveReader::ArchiveReadEntry::ArchiveReadEntry(archive_entry* currentEntry, a
 }
 #endif
 
+ArchiveReader::ArchiveReadEntry::ArchiveReadEntry(MappedEntry const* mappedEntry) : _mappedEntry(mappedEntry) {
+    STORM_LOG_ASSERT(_mappedEntry, "No valid entry loaded.");
+}
+
 std::filesystem::path ArchiveReader::ArchiveReadEntry::name() const {
+    if (_mappedEntry) {
+        return _mappedEntry->name;
+    }
 #ifdef STORM_HAVE_LIBARCHIVE
     STORM_LOG_THROW(_currentEntry, storm::exceptions::FileIoException, "No valid entry loaded.");
     std::filesystem::path result;
@@ -52,6 +279,9 @@ std::filesystem::path ArchiveReader::ArchiveReadEntry::name() const {
 }
 
 bool ArchiveReader::ArchiveReadEntry::isDir() const {
+    if (_mappedEntry) {
+        return _mappedEntry->isDir;
+    }
 #ifdef STORM_HAVE_LIBARCHIVE
     STORM_LOG_THROW(_currentEntry, storm::exceptions::FileIoException, "No valid entry loaded.");
     return archive_entry_filetype(_currentEntry) == AE_IFDIR;
@@ -66,6 +296,9 @@ using Vec = typename ArchiveReader::ArchiveReadEntry::VectorType<T>;
 template<typename T, std::endian Endianness>
     requires(std::is_arithmetic_v<T>)
 Vec<T> ArchiveReader::ArchiveReadEntry::toVector() {
+    if (_mappedEntry) {
+        return mappedToVector<T, Endianness>();
+    }
 #ifdef STORM_HAVE_LIBARCHIVE
     using BucketType = decltype(std::declval<storm::storage::BitVector&>().getBucket({}));
     constexpr bool IsBitVector = std::is_same_v<T, bool>;
@@ -157,7 +390,42 @@ Vec<T> ArchiveReader::ArchiveReadEntry::toVector() {
 #endif
 }
 
+template<typename T, std::endian Endianness>
+Vec<T> ArchiveReader::ArchiveReadEntry::mappedToVector() {
+    using BucketType = decltype(std::declval<storm::storage::BitVector&>().getBucket({}));
+    constexpr bool IsBitVector = std::is_same_v<T, bool>;
+    using DataType = std::conditional_t<IsBitVector, BucketType, T>;  // for BitVectors, we use uint64_t as the underlying type
+    STORM_LOG_THROW((_mappedEntry->size % sizeof(DataType) == 0), storm::exceptions::FileIoException,
+                    "Archive entry '" << name() << "' can not be extracted as vector of a " << sizeof(DataType) << "-bytes type: File size "
+                                      << _mappedEntry->size << " bytes is not a multiple of " << sizeof(DataType) << " bytes.");
+    // Tar entries start at multiples of 512 bytes and the mapping is page-aligned, so the data is suitably aligned.
+    STORM_LOG_ASSERT(reinterpret_cast<std::uintptr_t>(_mappedEntry->data) % alignof(DataType) == 0, "Unaligned archive entry data.");
+    std::span<const DataType> const values(reinterpret_cast<const DataType*>(_mappedEntry->data), _mappedEntry->size / sizeof(DataType));
+
+    // The data is copied directly from the mapped file, i.e., without going through intermediate buffers.
+    if constexpr (IsBitVector) {
+        Vec<T> content(values.size() * sizeof(BucketType) * 8);  // 8 bits in a byte
+        for (uint64_t bucket = 0; bucket < values.size(); ++bucket) {
+            auto bits = values[bucket];
+            if constexpr (Endianness != std::endian::native) {
+                bits = storm::utility::byteSwap(bits);
+            }
+            // Our bit vectors store the items in reverse order, i.e., the first item is indicated by the most significant bit
+            content.setBucket(bucket, storm::utility::reverseBits(bits));
+        }
+        return content;
+    } else if constexpr (Endianness == std::endian::native || sizeof(DataType) == 1) {
+        return Vec<T>(values.begin(), values.end());
+    } else {
+        auto swapped = values | std::ranges::views::transform(storm::utility::byteSwap<DataType>);
+        return Vec<T>(swapped.begin(), swapped.end());
+    }
+}
+
 std::string ArchiveReader::ArchiveReadEntry::toString() {
+    if (_mappedEntry) {
+        return std::string(_mappedEntry->data, _mappedEntry->size);
+    }
 #ifdef STORM_HAVE_LIBARCHIVE
     // Prepare the vector to store the data, using given size (if available)
     std::string content;
@@ -193,7 +461,15 @@ ArchiveReader::Iterator::Iterator(std::filesystem::path const& filename) : _arch
 }
 #endif
 
+ArchiveReader::Iterator::Iterator(std::shared_ptr<MappedArchive const> mappedArchive, uint64_t entryIndex)
+    : _mappedArchive(std::move(mappedArchive)), _mappedEntryIndex(entryIndex) {
+    STORM_LOG_ASSERT(_mappedArchive && _mappedEntryIndex <= _mappedArchive->getEntries().size(), "Invalid mapped archive entry.");
+}
+
 bool ArchiveReader::Iterator::operator==(Iterator const& other) const {
+    if (_mappedArchive || other._mappedArchive) {
+        return _mappedArchive == other._mappedArchive && _mappedEntryIndex == other._mappedEntryIndex;
+    }
 #ifdef STORM_HAVE_LIBARCHIVE
     return _currentEntry == other._currentEntry;
 #else
@@ -202,17 +478,18 @@ bool ArchiveReader::Iterator::operator==(Iterator const& other) const {
 }
 
 bool ArchiveReader::Iterator::operator!=(Iterator const& other) const {
-#ifdef STORM_HAVE_LIBARCHIVE
-    return _currentEntry != other._currentEntry;
-#else
-    STORM_LOG_THROW(false, storm::exceptions::MissingLibraryException, "Reading archives is not supported. Storm is compiled without LibArchive.");
-#endif
+    return !(*this == other);
 }
 
 /*!
  * Move to the next entry in the archive.
  */
 typename ArchiveReader::Iterator& ArchiveReader::Iterator::operator++() {
+    if (_mappedArchive) {
+        STORM_LOG_ASSERT(_mappedEntryIndex < _mappedArchive->getEntries().size(), "Iterating past the end of the archive.");
+        ++_mappedEntryIndex;
+        return *this;
+    }
 #ifdef STORM_HAVE_LIBARCHIVE
     int r = archive_read_next_header(_archive.get(), &_currentEntry);
     if (r == ARCHIVE_EOF) {
@@ -229,6 +506,9 @@ typename ArchiveReader::Iterator& ArchiveReader::Iterator::operator++() {
 }
 
 typename ArchiveReader::ArchiveReadEntry ArchiveReader::Iterator::operator*() const {
+    if (_mappedArchive) {
+        return ArchiveReadEntry(&_mappedArchive->getEntries()[_mappedEntryIndex]);
+    }
 #ifdef STORM_HAVE_LIBARCHIVE
     return ArchiveReadEntry(_currentEntry, _archive.get());
 #else
@@ -286,9 +566,20 @@ bool ArchiveReader::isReadableArchive() const {
 #endif
 }
 
-ArchiveReader::ArchiveReader(std::filesystem::path const& file) : file(file) {};
+ArchiveReader::ArchiveReader(std::filesystem::path const& file, bool allowMemoryMapping) : file(file) {
+    if (allowMemoryMapping && std::filesystem::is_regular_file(file)) {
+        mappedArchive = MappedArchive::create(file);
+    }
+}
+
+bool ArchiveReader::isMemoryMapped() const {
+    return mappedArchive != nullptr;
+}
 
 typename ArchiveReader::Iterator ArchiveReader::begin() const {
+    if (mappedArchive) {
+        return Iterator(mappedArchive, 0);
+    }
 #ifdef STORM_HAVE_LIBARCHIVE
     return Iterator(file);
 #else
@@ -297,6 +588,9 @@ typename ArchiveReader::Iterator ArchiveReader::begin() const {
 }
 
 typename ArchiveReader::Iterator ArchiveReader::end() const {
+    if (mappedArchive) {
+        return Iterator(mappedArchive, mappedArchive->getEntries().size());
+    }
 #ifdef STORM_HAVE_LIBARCHIVE
     return Iterator();
 #else
@@ -304,8 +598,8 @@ typename ArchiveReader::Iterator ArchiveReader::end() const {
 #endif
 }
 
-ArchiveReader openArchive(std::filesystem::path const& file) {
-    return ArchiveReader(file);
+ArchiveReader openArchive(std::filesystem::path const& file, bool allowMemoryMapping) {
+    return ArchiveReader(file, allowMemoryMapping);
 }
 
 template Vec<char> ArchiveReader::ArchiveReadEntry::toVector<char, std::endian::little>();
@@ -24,6 +24,12 @@ static_assert(std::endian::native == std::endian::little || std::endian::native
 
 class ArchiveReader {
    private:
+    /*!
+     * An uncompressed archive that is mapped to memory and the locations of its entries.
+     */
+    class MappedArchive;
+    struct MappedEntry;
+
 #ifdef STORM_HAVE_LIBARCHIVE
     /*!
      * Auxiliary struct to delete archive objects (not the archive from disk!)
@@ -41,6 +47,7 @@ class ArchiveReader {
 #ifdef STORM_HAVE_LIBARCHIVE
         ArchiveReadEntry(archive_entry* currentEntry, archive* archive);
 #endif
+        ArchiveReadEntry(MappedEntry const* mappedEntry);
 
         /*!
          * Get the current entry’s path (filename) inside the archive.
@@ -71,11 +78,19 @@ class ArchiveReader {
         std::string toString();
 
        private:
+        /*!
+         * Extracts the data of a mapped entry as a vector of the given type.
+         */
+        template<typename T, std::endian Endianness>
+        VectorType<T> mappedToVector();
+
 #ifdef STORM_HAVE_LIBARCHIVE
         static constexpr size_t BufferSize = 8192;
-        archive_entry* const _currentEntry;
-        archive* _archive;
+        archive_entry* const _currentEntry{nullptr};
+        archive* _archive{nullptr};
 #endif
+        // Only set if the entry is read from a memory-mapped archive.
+        MappedEntry const* _mappedEntry{nullptr};
     };
     class Iterator {
        public:
@@ -83,6 +98,7 @@ class ArchiveReader {
 #ifdef STORM_HAVE_LIBARCHIVE
         Iterator(std::filesystem::path const& filename);
 #endif
+        Iterator(std::shared_ptr<MappedArchive const> mappedArchive, uint64_t entryIndex);
 
         bool operator==(Iterator const& other) const;
         bool operator!=(Iterator const& other) const;
@@ -99,9 +115,17 @@ class ArchiveReader {
         std::unique_ptr<archive, ArchiveDeleter> _archive;
         archive_entry* _currentEntry{nullptr};
 #endif
+        // Only set if the entries are read from a memory-mapped archive.
+        std::shared_ptr<MappedArchive const> _mappedArchive;
+        uint64_t _mappedEntryIndex{0};
     };
 
-    ArchiveReader(std::filesystem::path const& file);
+    /*!
+     * @param file path to an archive file
+     * @param allowMemoryMapping if true and the file is an uncompressed tar archive, the file is mapped to memory and the entries are read directly from
+     * the mapped data. Otherwise (or if mapping fails), the entries are extracted using libarchive.
+     */
+    ArchiveReader(std::filesystem::path const& file, bool allowMemoryMapping = true);
 
     /*!
      * @return true if the provided file is a readable archive
@@ -109,27 +133,34 @@ class ArchiveReader {
      */
     bool isReadableArchive() const;
 
+    /*!
+     * @return true if the entries are read from a memory-mapped file
+     */
+    bool isMemoryMapped() const;
+
     /*!
      * @return an iterator to the beginning of the archive entries
-     * @throws MissingLibraryException if libarchive is not installed.
+     * @throws MissingLibraryException if libarchive is not installed and the archive is not memory-mapped.
      */
     Iterator begin() const;
 
     /*!
      * @return an iterator to the end of the archive entries
-     * @throws MissingLibraryException if libarchive is not installed
+     * @throws MissingLibraryException if libarchive is not installed and the archive is not memory-mapped.
      */
     Iterator end() const;
 
    private:
     std::filesystem::path const file;
+    std::shared_ptr<MappedArchive const> mappedArchive;
 };
 
 /*!
  * Reads an archive file
  * @param file path to an archive file
+ * @param allowMemoryMapping whether uncompressed tar archives may be mapped to memory
  * @return A range-like object to iterate over the entries in the archive.
  */
-ArchiveReader openArchive(std::filesystem::path const& file);
+ArchiveReader openArchive(std::filesystem::path const& file, bool allowMemoryMapping = true);
 }  // namespace io
 }  // namespace storm
\ No newline at end of file
@@ -1,5 +1,8 @@
 #include "storm/io/ArchiveWriter.h"
 
+#include <array>
+#include <string>
+
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/storage/BitVector.h"
 #include "storm/utility/macros.h"
@@ -7,7 +10,8 @@
 namespace storm::io {
 
 #ifdef STORM_HAVE_LIBARCHIVE
-ArchiveWriter::ArchiveWriter(std::filesystem::path const& filename, CompressionMode const compression) : _archive(archive_write_new(), ArchiveDeleter{}) {
+ArchiveWriter::ArchiveWriter(std::filesystem::path const& filename, CompressionMode const compression, uint64_t const numberOfThreads)
+    : _archive(archive_write_new(), ArchiveDeleter{}) {
     STORM_LOG_THROW(_archive, storm::exceptions::FileIoException, "Failed to create archive reader.");
 
     // Set format to gzipped TAR with restricted pax extensions
@@ -16,10 +20,15 @@ ArchiveWriter::ArchiveWriter(std::filesystem::path const& filename, CompressionM
             break;
         case CompressionMode::Gzip:
             archive_write_add_filter_gzip(_archive.get());
+            STORM_LOG_WARN_COND(numberOfThreads == 1, "Gzip compression does not support multiple threads. Consider using xz compression instead.");
             break;
         case CompressionMode::Xz:
         case CompressionMode::Default:  // Following suggestions from UMB, we use xz as default compression
             archive_write_add_filter_xz(_archive.get());
+            if (numberOfThreads != 1) {
+                // The multi-threaded encoder splits the data into blocks that are compressed independently. libarchive treats 0 as 'auto-detect'.
+                checkResult(archive_write_set_filter_option(_archive.get(), "xz", "threads", std::to_string(numberOfThreads).c_str()));
+            }
             break;
         default:
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Unsupported compression mode.");
@@ -30,7 +39,7 @@ ArchiveWriter::ArchiveWriter(std::filesystem::path const& filename, CompressionM
     checkResult(archive_write_open_filename(_archive.get(), filename.c_str()));
 }
 #else
-ArchiveWriter::ArchiveWriter(std::filesystem::path const&, CompressionMode const) {
+ArchiveWriter::ArchiveWriter(std::filesystem::path const&, CompressionMode const, uint64_t const) {
     STORM_LOG_THROW(false, storm::exceptions::MissingLibraryException, "Writing archives is not supported. Storm is compiled without LibArchive.");
 }
 #endif
@@ -67,6 +76,19 @@ void ArchiveWriter::addFile(std::filesystem::path const& archivePath, char const
     addFileFromChunks(archivePath, getNextChunk, size);
 }
 
+void ArchiveWriter::addFile(std::filesystem::path const& archivePath, std::FILE* data, std::size_t const size) {
+    std::array<char, BufferSize> buffer;
+    std::size_t remainingBytes = size;
+    auto getNextChunk = [&]() {
+        auto const numBytesRead = std::fread(buffer.data(), 1, std::min<std::size_t>(remainingBytes, BufferSize), data);
+        STORM_LOG_THROW(numBytesRead > 0 || remainingBytes == 0, storm::exceptions::FileIoException,
+                        "Unable to read contents of file '" << archivePath << "' from temporary file.");
+        remainingBytes -= numBytesRead;
+        return std::span<char const>(buffer.data(), numBytesRead);
+    };
+    addFileFromChunks(archivePath, getNextChunk, size);
+}
+
 void ArchiveWriter::addBinaryFile(std::filesystem::path const& archivePath, storm::storage::BitVector const& data) {
     using BucketType = decltype(std::declval<storm::storage::BitVector&>().getBucket({}));
     static_assert(BufferSize % sizeof(BucketType) == 0, "Buffer size must be a multiple of sizeof(BucketType).");
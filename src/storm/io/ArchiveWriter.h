@@ -1,6 +1,7 @@
 #pragma once
 
 #include <bit>
+#include <cstdio>
 #include <filesystem>
 #include <memory>
 #include <span>
@@ -44,8 +45,9 @@ class ArchiveWriter {
    public:
     /*!
     Create a new archive and open it as a file on disk.
+    @param numberOfThreads The number of threads used for compression (0 means 'auto-detect'). Only xz compression makes use of multiple threads.
     */
-    ArchiveWriter(std::filesystem::path const& filename, CompressionMode const compression);
+    ArchiveWriter(std::filesystem::path const& filename, CompressionMode const compression, uint64_t const numberOfThreads = 1);
 
     /*!
       Adds a (sub-) directory to the archive
@@ -59,6 +61,14 @@ class ArchiveWriter {
      */
     void addFile(std::filesystem::path const& archivePath, char const* data, std::size_t const size);
 
+    /*!
+     * Add a file to the archive whose contents are read from the given (temporary) file.
+     * @param archivePath The file’s path inside the archive
+     * @param data The file from which the contents are read, starting at its current position
+     * @param size The number of bytes to read
+     */
+    void addFile(std::filesystem::path const& archivePath, std::FILE* data, std::size_t const size);
+
     /*!
      * Add a file to the archive using a binary encoding of the provided data.
      * @param archivePath The file’s path inside the archive
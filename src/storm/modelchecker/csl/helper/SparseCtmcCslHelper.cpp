@@ -1,5 +1,7 @@
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 
+#include <optional>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/exceptions/InvalidOperationException.h"
@@ -9,6 +11,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/solver/multiplier/Multiplier.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/numerical.h"
@@ -515,12 +518,22 @@ std::vector<ValueType> SparseCtmcCslHelper::computeAllTransientProbabilities(Env
                                                                              storm::storage::BitVector const& phiStates,
                                                                              storm::storage::BitVector const& psiStates,
                                                                              std::vector<ValueType> const& exitRates, ValueType timeBound) {
+    return std::move(
+        computeAllTransientProbabilities(env, rateMatrix, initialStates, phiStates, psiStates, exitRates, std::vector<ValueType>{timeBound}).front());
+}
+
+template<typename ValueType>
+    requires storm::NumberTraits<ValueType>::SupportsExponential
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeAllTransientProbabilities(
+    Environment const& env, storm::storage::SparseMatrix<ValueType> const& rateMatrix, storm::storage::BitVector const& initialStates,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates,
+    std::vector<ValueType> const& timeBounds) {
     // Compute transient probabilities going from initial state
     // Instead of y=Px we now compute y=xP <=> y^T=P^Tx^T via transposition
     uint_fast64_t numberOfStates = rateMatrix.getRowCount();
 
-    // Create the result vector.
-    std::vector<ValueType> result = std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>());
+    // Create the result vectors.
+    std::vector<std::vector<ValueType>> result(timeBounds.size(), std::vector<ValueType>(numberOfStates, storm::utility::zero<ValueType>()));
 
     storm::storage::SparseMatrix<ValueType> transposedMatrix(rateMatrix);
     transposedMatrix.makeRowsAbsorbing(psiStates);
@@ -571,11 +584,19 @@ std::vector<ValueType> SparseCtmcCslHelper::computeAllTransientProbabilities(Env
             }
             ++i;
         }
-        // Finally compute the transient probabilities.
-        std::vector<ValueType> subresult =
-            computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, timeBound, uniformizationRate, values, epsilon);
-
-        storm::utility::vector::setVectorValues(result, relevantStates, subresult);
+        // Finally compute the transient probabilities. A single time bound is handled by the single-bound variant, which uses the configured multiplier
+        // and only resorts to the batched computation if multiple threads are requested.
+        if (timeBounds.size() == 1) {
+            std::vector<ValueType> subresult =
+                computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, timeBounds.front(), uniformizationRate, values, epsilon);
+            storm::utility::vector::setVectorValues(result.front(), relevantStates, subresult);
+        } else {
+            std::vector<std::vector<ValueType>> subresults =
+                computeTransientProbabilities<ValueType>(env, uniformizedMatrix, nullptr, timeBounds, uniformizationRate, values, epsilon);
+            for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+                storm::utility::vector::setVectorValues(result[timeBoundIndex], relevantStates, subresults[timeBoundIndex]);
+            }
+        }
     }
 
     return result;
@@ -626,6 +647,13 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
         return values;
     }
 
+    // Multi-threaded multiplications are provided by the batched variant.
+    if (!useMixedPoissonProbabilities && env.solver().timeBounded().getNumberOfThreads() != 1) {
+        return std::move(
+            computeTransientProbabilities(env, uniformizedMatrix, addVector, std::vector<ValueType>{timeBound}, uniformizationRate, std::move(values), epsilon)
+                .front());
+    }
+
     // Use Fox-Glynn to get the truncation points and the weights.
     storm::utility::numerical::FoxGlynnResult<ValueType> foxGlynnResult = storm::utility::numerical::foxGlynn(lambda, epsilon);
     STORM_LOG_DEBUG("Fox-Glynn cutoff points: left=" << foxGlynnResult.left << ", right=" << foxGlynnResult.right);
@@ -720,6 +748,85 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
     return result;
 }
 
+template<typename ValueType>
+    requires storm::NumberTraits<ValueType>::SupportsExponential
+std::vector<std::vector<ValueType>> SparseCtmcCslHelper::computeTransientProbabilities(Environment const& env,
+                                                                                       storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                                       std::vector<ValueType> const* addVector,
+                                                                                       std::vector<ValueType> const& timeBounds, ValueType uniformizationRate,
+                                                                                       std::vector<ValueType> values, ValueType epsilon) {
+    STORM_LOG_WARN_COND(epsilon > storm::utility::convertNumber<ValueType>(1e-20),
+                        "Very low truncation error " << epsilon << " requested. Numerical inaccuracies are possible.");
+    uint64_t const numberOfRows = uniformizedMatrix.getRowCount();
+
+    // Use Fox-Glynn to get the truncation points and the weights of each time bound. Time bounds in which no time can pass do not need
+    // any iterations as the current values are the result.
+    std::vector<std::vector<ValueType>> result(timeBounds.size());
+    std::vector<std::optional<storm::utility::numerical::FoxGlynnResult<ValueType>>> foxGlynnResults(timeBounds.size());
+    uint64_t numberOfIterations = 0;
+    for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+        ValueType lambda = timeBounds[timeBoundIndex] * uniformizationRate;
+        if (storm::utility::isZero(lambda)) {
+            result[timeBoundIndex] = values;
+            continue;
+        }
+        auto const& foxGlynnResult = foxGlynnResults[timeBoundIndex].emplace(storm::utility::numerical::foxGlynn(lambda, epsilon));
+        STORM_LOG_DEBUG("Fox-Glynn cutoff points for time bound " << timeBounds[timeBoundIndex] << ": left=" << foxGlynnResult.left
+                                                                  << ", right=" << foxGlynnResult.right);
+        numberOfIterations = std::max<uint64_t>(numberOfIterations, foxGlynnResult.right);
+        if (foxGlynnResult.left == 0) {
+            result[timeBoundIndex] = values;
+            storm::utility::vector::scaleVectorInPlace(result[timeBoundIndex], foxGlynnResult.weights.front());
+        } else {
+            result[timeBoundIndex] = std::vector<ValueType>(numberOfRows, storm::utility::zero<ValueType>());
+        }
+    }
+
+    auto threadPool = storm::utility::ThreadPool::getShared(env.solver().timeBounded().getNumberOfThreads());
+    STORM_LOG_DEBUG("Starting " << numberOfIterations << " iterations for " << timeBounds.size() << " time bounds with " << numberOfRows << " x "
+                                << uniformizedMatrix.getColumnCount() << " matrix using " << threadPool->getNumberOfWorkers() << " threads.");
+
+    // In each iteration, we compute the next power of the matrix applied to the values and add the weighted result to all time bounds whose
+    // truncation points enclose the current iteration. Both happen in a single pass over the rows, which is distributed among the workers.
+    uint64_t const rowsPerTask = 4096;
+    uint64_t const numberOfTasks = (numberOfRows + rowsPerTask - 1) / rowsPerTask;
+    std::vector<ValueType> nextValues(numberOfRows);
+    std::vector<std::pair<std::vector<ValueType>*, ValueType>> weightedResults;
+    for (uint64_t iteration = 1; iteration <= numberOfIterations; ++iteration) {
+        weightedResults.clear();
+        for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+            auto const& foxGlynnResult = foxGlynnResults[timeBoundIndex];
+            if (foxGlynnResult && foxGlynnResult->left <= iteration && iteration <= foxGlynnResult->right) {
+                weightedResults.emplace_back(&result[timeBoundIndex], foxGlynnResult->weights[iteration - foxGlynnResult->left]);
+            }
+        }
+
+        threadPool->parallelFor(numberOfTasks, [&](uint64_t taskIndex, uint64_t) {
+            uint64_t const endRow = std::min(numberOfRows, (taskIndex + 1) * rowsPerTask);
+            for (uint64_t row = taskIndex * rowsPerTask; row < endRow; ++row) {
+                ValueType newValue = addVector ? (*addVector)[row] : storm::utility::zero<ValueType>();
+                for (auto const& entry : uniformizedMatrix.getRow(row)) {
+                    newValue += entry.getValue() * values[entry.getColumn()];
+                }
+                nextValues[row] = newValue;
+                for (auto const& [resultVector, weight] : weightedResults) {
+                    (*resultVector)[row] += weight * newValue;
+                }
+            }
+        });
+        std::swap(values, nextValues);
+    }
+
+    // Finally, divide the results by the total weights
+    for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+        if (foxGlynnResults[timeBoundIndex]) {
+            storm::utility::vector::scaleVectorInPlace<ValueType, ValueType>(
+                result[timeBoundIndex], storm::utility::one<ValueType>() / foxGlynnResults[timeBoundIndex]->totalWeight);
+        }
+    }
+    return result;
+}
+
 template<typename ValueType>
 storm::storage::SparseMatrix<ValueType> SparseCtmcCslHelper::computeProbabilityMatrix(storm::storage::SparseMatrix<ValueType> const& rateMatrix,
                                                                                       std::vector<ValueType> const& exitRates) {
@@ -808,6 +915,11 @@ template std::vector<double> SparseCtmcCslHelper::computeAllTransientProbabiliti
     Environment const& env, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& initialStates,
     storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates, double timeBound);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeAllTransientProbabilities(
+    Environment const& env, storm::storage::SparseMatrix<double> const& rateMatrix, storm::storage::BitVector const& initialStates,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, std::vector<double> const& exitRates,
+    std::vector<double> const& timeBounds);
+
 template storm::storage::SparseMatrix<double> SparseCtmcCslHelper::computeUniformizedMatrix(storm::storage::SparseMatrix<double> const& rateMatrix,
                                                                                             storm::storage::BitVector const& maybeStates,
                                                                                             double uniformizationRate, std::vector<double> const& exitRates);
@@ -817,6 +929,10 @@ template std::vector<double> SparseCtmcCslHelper::computeTransientProbabilities(
                                                                                 std::vector<double> const* addVector, double timeBound,
                                                                                 double uniformizationRate, std::vector<double> values, double epsilon);
 
+template std::vector<std::vector<double>> SparseCtmcCslHelper::computeTransientProbabilities(
+    Environment const& env, storm::storage::SparseMatrix<double> const& uniformizedMatrix, std::vector<double> const* addVector,
+    std::vector<double> const& timeBounds, double uniformizationRate, std::vector<double> values, double epsilon);
+
 template std::vector<storm::RationalNumber> SparseCtmcCslHelper::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& rateMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, std::vector<storm::RationalNumber> const& exitRateVector,
@@ -84,6 +84,22 @@ class SparseCtmcCslHelper {
                                                                    storm::storage::BitVector const& psiStates, std::vector<ValueType> const& exitRates,
                                                                    ValueType timeBound);
 
+    /*!
+     * Computes the transient probabilities of all states for each of the given time bounds. All time bounds are handled in a single pass
+     * over the powers of the uniformized matrix.
+     *
+     * @return For each time bound, the vector of transient probabilities.
+     */
+    template<typename ValueType>
+        requires storm::NumberTraits<ValueType>::SupportsExponential
+    static std::vector<std::vector<ValueType>> computeAllTransientProbabilities(Environment const& env,
+                                                                                storm::storage::SparseMatrix<ValueType> const& rateMatrix,
+                                                                                storm::storage::BitVector const& initialStates,
+                                                                                storm::storage::BitVector const& phiStates,
+                                                                                storm::storage::BitVector const& psiStates,
+                                                                                std::vector<ValueType> const& exitRates,
+                                                                                std::vector<ValueType> const& timeBounds);
+
     /*!
      * Computes the matrix representing the transitions of the uniformized CTMC.
      *
@@ -119,6 +135,27 @@ class SparseCtmcCslHelper {
                                                                 std::vector<ValueType> const* addVector, ValueType timeBound, ValueType uniformizationRate,
                                                                 std::vector<ValueType> values, ValueType epsilon);
 
+    /*!
+     * Computes the transient probabilities for multiple time bounds at once. The powers of the uniformized matrix are shared among all time bounds,
+     * i.e., only as many matrix-vector multiplications as required for the largest time bound are performed. Each multiplication is distributed
+     * over rows using the number of threads set in the time bounded solver environment.
+     *
+     * @param uniformizedMatrix The uniformized transition matrix.
+     * @param addVector A vector that is added in each step as a possible compensation for removing absorbing states
+     * with a non-zero initial value. If this is not supposed to be used, it can be set to nullptr.
+     * @param timeBounds The time bounds to use.
+     * @param uniformizationRate The used uniformization rate.
+     * @param values A vector mapping each state to an initial probability.
+     * @param epsilon The precision used for computing the truncation points
+     * @return For each time bound, the vector of transient probabilities.
+     */
+    template<typename ValueType>
+        requires storm::NumberTraits<ValueType>::SupportsExponential
+    static std::vector<std::vector<ValueType>> computeTransientProbabilities(Environment const& env,
+                                                                             storm::storage::SparseMatrix<ValueType> const& uniformizedMatrix,
+                                                                             std::vector<ValueType> const* addVector, std::vector<ValueType> const& timeBounds,
+                                                                             ValueType uniformizationRate, std::vector<ValueType> values, ValueType epsilon);
+
     /*!
      * Converts the given rate-matrix into a time-abstract probability matrix.
      *
@@ -21,6 +21,9 @@ const std::string BisimulationSettings::signatureModeOptionName = "sigmode";
 const std::string BisimulationSettings::reuseOptionName = "reuse";
 const std::string BisimulationSettings::initialPartitionOptionName = "init";
 const std::string BisimulationSettings::refinementModeOptionName = "refine";
+const std::string BisimulationSettings::sparseRefinementModeOptionName = "sparserefine";
+const std::string BisimulationSettings::threadsOptionName = "threads";
+const std::string BisimulationSettings::onTheFlyOptionName = "onthefly";
 const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
 
 BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
@@ -91,6 +94,29 @@ BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueString("full")
                                          .build())
                         .build());
+
+    std::vector<std::string> sparseRefinementModes = {"splitter", "signature"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, sparseRefinementModeOptionName, true,
+                                                   "Sets which refinement mode to use in sparse bisimulation (signature only applies to strong bisimulation).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(sparseRefinementModes))
+                                         .setDefaultValueString("splitter")
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false,
+                                                   "The number of threads used for signature-based refinement in sparse bisimulation.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, onTheFlyOptionName, false,
+                                                   "If set, the strong bisimulation quotient of sparse DTMCs and CTMCs is built during exploration.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -173,6 +199,22 @@ BisimulationSettings::RefinementMode BisimulationSettings::getRefinementMode() c
     return RefinementMode::Full;
 }
 
+BisimulationSettings::SparseRefinementMode BisimulationSettings::getSparseRefinementMode() const {
+    std::string sparseRefinementModeAsString = this->getOption(sparseRefinementModeOptionName).getArgumentByName("mode").getValueAsString();
+    if (sparseRefinementModeAsString == "signature") {
+        return SparseRefinementMode::Signature;
+    }
+    return SparseRefinementMode::Splitter;
+}
+
+uint64_t BisimulationSettings::getNumberOfThreads() const {
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool BisimulationSettings::isOnTheFlySet() const {
+    return this->getOption(onTheFlyOptionName).getHasOptionBeenSet();
+}
+
 bool BisimulationSettings::check() const {
     bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
     STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet,
@@ -24,6 +24,8 @@ class BisimulationSettings : public ModuleSettings {
 
     enum class RefinementMode { Full, ChangedStates };
 
+    enum class SparseRefinementMode { Splitter, Signature };
+
     /*!
      * Creates a new set of bisimulation settings.
      */
@@ -96,6 +98,24 @@ class BisimulationSettings : public ModuleSettings {
      */
     RefinementMode getRefinementMode() const;
 
+    /*!
+     * Retrieves the refinement mode to use in sparse bisimulation.
+     * NOTE: only applies to sparse bisimulation.
+     */
+    SparseRefinementMode getSparseRefinementMode() const;
+
+    /*!
+     * Retrieves the number of threads to use for signature-based refinement in sparse bisimulation (0 means 'auto-detect').
+     * NOTE: only applies to sparse bisimulation.
+     */
+    uint64_t getNumberOfThreads() const;
+
+    /*!
+     * Retrieves whether the quotient of a sparse deterministic model is to be built during state-space exploration.
+     * NOTE: only applies to sparse bisimulation.
+     */
+    bool isOnTheFlySet() const;
+
     virtual bool check() const override;
 
     // The name of the module.
@@ -112,6 +132,9 @@ class BisimulationSettings : public ModuleSettings {
     static const std::string initialPartitionOptionName;
     static const std::string refinementModeOptionName;
     static const std::string parallelismModeOptionName;
+    static const std::string sparseRefinementModeOptionName;
+    static const std::string threadsOptionName;
+    static const std::string onTheFlyOptionName;
     static const std::string exactArithmeticDdOptionName;
 };
 }  // namespace modules
@@ -149,6 +149,11 @@ class BuildSettings : public ModuleSettings {
      */
     uint64_t getExplorationStateLimit() const;
 
+    /*!
+     * Retrieves the number of threads that expand states concurrently during the explicit state space exploration (0 means 'auto-detect').
+     */
+    uint64_t getNumberOfExplorationThreads() const;
+
     // The name of the module.
     static const std::string moduleName;
 };
@@ -29,6 +29,7 @@ const std::string IOSettings::exportCdfOptionShortName = "cdf";
 const std::string IOSettings::exportSchedulerOptionName = "exportscheduler";
 const std::string IOSettings::exportCheckResultOptionName = "exportresult";
 const std::string IOSettings::exportCompressionOptionName = "compression";
+const std::string IOSettings::exportCompressionThreadsOptionName = "compression-threads";
 const std::string IOSettings::exportDigitsOptionName = "digits";
 const std::string IOSettings::explicitOptionName = "explicit";
 const std::string IOSettings::explicitOptionShortName = "exp";
@@ -100,6 +101,15 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                                          .build())
                         .build());
 
+    this->addOption(storm::settings::OptionBuilder(
+                        moduleName, exportCompressionThreadsOptionName, false,
+                        "Sets the number of threads used for compressing exported files. Only xz compression supports multiple threads.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+
     this->addOption(storm::settings::OptionBuilder(moduleName, exportDigitsOptionName, false, "Sets number of output digits of export (if supported).")
                         .setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("num", "Number of digits.").build())
@@ -337,6 +347,10 @@ storm::io::CompressionMode IOSettings::getCompressionMode() const {
     return storm::io::getCompressionModeFromString(mode);
 }
 
+uint64_t IOSettings::getCompressionThreads() const {
+    return this->getOption(exportCompressionThreadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool IOSettings::isExportDigitsSet() const {
     return this->getOption(exportDigitsOptionName).getHasOptionBeenSet();
 }
@@ -73,6 +73,12 @@ class IOSettings : public ModuleSettings {
      */
     storm::io::CompressionMode getCompressionMode() const;
 
+    /*!
+     * Retrieves the number of threads used for compressing exported files (0 means 'auto-detect').
+     * @note The export might not support multi-threaded compression
+     */
+    uint64_t getCompressionThreads() const;
+
     /*!
      * Retrieves whether the number of digits for exporting floating point numbers was set
      */
@@ -443,6 +449,7 @@ class IOSettings : public ModuleSettings {
     static const std::string exportSchedulerOptionName;
     static const std::string exportCheckResultOptionName;
     static const std::string exportCompressionOptionName;
+    static const std::string exportCompressionThreadsOptionName;
     static const std::string exportDigitsOptionName;
     static const std::string explicitOptionName;
     static const std::string explicitOptionShortName;
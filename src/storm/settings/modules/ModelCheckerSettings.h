@@ -33,6 +33,13 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves the number of threads used for the qualitative (graph-based) analysis of explicit models.
+     *
+     * @return The number of threads (0 means 'auto-detect').
+     */
+    uint64_t getNumberOfGraphAnalysisThreads() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -40,6 +47,7 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string graphAnalysisThreadsOptionName;
 };
 
 }  // namespace modules
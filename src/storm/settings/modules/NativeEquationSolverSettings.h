@@ -105,6 +105,13 @@ class NativeEquationSolverSettings : public ModuleSettings {
      */
     storm::solver::MultiplicationStyle getPowerMethodMultiplicationStyle() const;
 
+    /*!
+     * Retrieves the number of threads to use for value iteration sweeps.
+     *
+     * @return The number of threads (where 0 means 'auto-detect').
+     */
+    uint64_t getNumberOfThreads() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -120,6 +127,7 @@ class NativeEquationSolverSettings : public ModuleSettings {
     static const std::string absoluteOptionName;
     static const std::string intervalIterationSymmetricUpdatesOptionName;
     static const std::string powerMethodMultiplicationStyleOptionName;
+    static const std::string threadsOptionName;
 };
 
 }  // namespace modules
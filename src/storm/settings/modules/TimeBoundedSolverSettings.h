@@ -50,6 +50,16 @@ class TimeBoundedSolverSettings : public ModuleSettings {
      */
     double getUnifPlusKappa() const;
 
+    /*!
+     * Retrieves whether the number of threads for transient analysis has been set.
+     */
+    bool isNumberOfThreadsSet() const;
+
+    /*!
+     * Retrieves the number of threads used for the matrix-vector multiplications of transient analysis (0 means 'auto-detect').
+     */
+    uint64_t getNumberOfThreads() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -58,6 +68,7 @@ class TimeBoundedSolverSettings : public ModuleSettings {
     static const std::string precisionOptionName;
     static const std::string absoluteOptionName;
     static const std::string unifPlusKappaOptionName;
+    static const std::string threadsOptionName;
 };
 
 }  // namespace modules
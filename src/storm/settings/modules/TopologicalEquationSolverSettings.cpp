@@ -24,6 +24,7 @@ const std::string TopologicalEquationSolverSettings::moduleName = "topological";
 const std::string TopologicalEquationSolverSettings::underlyingEquationSolverOptionName = "eqsolver";
 const std::string TopologicalEquationSolverSettings::underlyingMinMaxMethodOptionName = "minmax";
 const std::string TopologicalEquationSolverSettings::extendRelevantValuesOptionName = "relevant-values";
+const std::string TopologicalEquationSolverSettings::threadsOptionName = "threads";
 
 #ifdef STORM_HAVE_GMM
 const std::string defaultEqSolverString = "gmm++";
@@ -63,6 +64,15 @@ TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleS
         storm::settings::OptionBuilder(moduleName, extendRelevantValuesOptionName, true, "Sets whether relevant values are set to the underlying solver.")
             .setIsAdvanced()
             .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, true,
+                                                   "Sets the number of threads used to decompose the system into SCCs and to solve independent SCCs "
+                                                   "concurrently. Exact and parametric models are always solved sequentially.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads (0 means 'auto-detect').")
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
 }
 
 bool TopologicalEquationSolverSettings::isUnderlyingEquationSolverTypeSet() const {
@@ -128,6 +138,14 @@ bool TopologicalEquationSolverSettings::isExtendRelevantValues() const {
     return this->getOption(extendRelevantValuesOptionName).getHasOptionBeenSet();
 }
 
+bool TopologicalEquationSolverSettings::isNumberOfThreadsSet() const {
+    return this->getOption(threadsOptionName).getHasOptionBeenSet();
+}
+
+uint64_t TopologicalEquationSolverSettings::getNumberOfThreads() const {
+    return this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
 bool TopologicalEquationSolverSettings::check() const {
     if (this->isUnderlyingEquationSolverTypeSet() && getUnderlyingEquationSolverType() == storm::solver::EquationSolverType::Topological) {
         STORM_LOG_WARN("Underlying solver type of the topological solver can not be the topological solver.");
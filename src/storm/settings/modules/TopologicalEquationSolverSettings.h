@@ -65,6 +65,20 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
      */
     bool isExtendRelevantValues() const;
 
+    /*!
+     * Retrieves whether the number of threads has been set.
+     *
+     * @return True iff the number of threads has been set.
+     */
+    bool isNumberOfThreadsSet() const;
+
+    /*!
+     * Retrieves the number of threads to use for the SCC decomposition and for solving independent SCCs concurrently.
+     *
+     * @return The number of threads (where 0 means 'auto-detect').
+     */
+    uint64_t getNumberOfThreads() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -75,6 +89,7 @@ class TopologicalEquationSolverSettings : public ModuleSettings {
     static const std::string underlyingEquationSolverOptionName;
     static const std::string underlyingMinMaxMethodOptionName;
     static const std::string extendRelevantValuesOptionName;
+    static const std::string threadsOptionName;
 };
 
 }  // namespace modules
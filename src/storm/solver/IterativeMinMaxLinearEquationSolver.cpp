@@ -6,6 +6,7 @@
 #include "storm/adapters/IntervalAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/NotImplementedException.h"
@@ -667,6 +668,12 @@ bool IterativeMinMaxLinearEquationSolver<ValueType, SolutionType>::solveEquation
                                                                                                 std::vector<SolutionType>& x,
                                                                                                 std::vector<ValueType> const& b) const {
     setUpViOperator();
+    if (viOperatorTriv) {
+        viOperatorTriv->setNumberOfThreads(env.solver().native().getNumberOfThreads());
+    }
+    if (viOperatorNontriv) {
+        viOperatorNontriv->setNumberOfThreads(env.solver().native().getNumberOfThreads());
+    }
     // By default, we can not provide any guarantee
     SolverGuarantee guarantee = SolverGuarantee::None;
 
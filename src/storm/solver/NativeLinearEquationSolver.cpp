@@ -360,6 +360,7 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment cons
     STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (Power)");
     // Prepare the solution vectors.
     setUpViOperator();
+    viOperator->setNumberOfThreads(env.solver().native().getNumberOfThreads());
 
     SolverGuarantee guarantee = SolverGuarantee::None;
     if (this->hasCustomTerminationCondition()) {
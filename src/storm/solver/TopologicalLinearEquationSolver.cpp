@@ -1,10 +1,14 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include <algorithm>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 
@@ -61,11 +65,17 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     bool needAdaptPrecision =
         env.solver().isForceSoundness() &&
         env.solver().getPrecisionOfLinearEquationSolver(env.solver().topological().getUnderlyingEquationSolverType()).first.is_initialized();
-
-    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
+    // Independent SCCs are solved concurrently if multiple threads are requested. This requires the depth of each SCC.
+    // Exact and parametric arithmetic is not safe to be used concurrently, so SCCs of such models are always solved sequentially.
+    bool const solveConcurrently = !storm::NumberTraits<ValueType>::IsExact && env.solver().topological().getNumberOfThreads() != 1;
+    STORM_LOG_WARN_COND(!storm::NumberTraits<ValueType>::IsExact || env.solver().topological().getNumberOfThreads() == 1,
+                        "Concurrent topological solving is not supported for exact or parametric value types. Solving SCCs sequentially.");
+
+    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize) ||
+        (solveConcurrently && !this->sortedSccDecomposition->hasSccDepth())) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(needAdaptPrecision, solveConcurrently ? env.solver().topological().getNumberOfThreads() : 1);
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -108,26 +118,30 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
                 }
             }
         }
-        storm::storage::BitVector sccAsBitVector(x.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
-            } else {
-                sccAsBitVector.clear();
-                for (auto const& state : scc) {
-                    sccAsBitVector.set(state, true);
+        if (solveConcurrently) {
+            returnValue = solveSccsConcurrently(sccSolverEnvironment, x, b, newRelevantValues, env.solver().topological().getNumberOfThreads());
+        } else {
+            storm::storage::BitVector sccAsBitVector(x.size(), false);
+            uint64_t sccIndex = 0;
+            storm::utility::ProgressMeasurement progress("states");
+            progress.setMaxCount(x.size());
+            progress.startNewMeasurement(0);
+            for (auto const& scc : *this->sortedSccDecomposition) {
+                if (scc.size() == 1) {
+                    returnValue = solveTrivialScc(*scc.begin(), x, b) && returnValue;
+                } else {
+                    sccAsBitVector.clear();
+                    for (auto const& state : scc) {
+                        sccAsBitVector.set(state, true);
+                    }
+                    returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b, newRelevantValues, this->sccSolver) && returnValue;
+                }
+                ++sccIndex;
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                    break;
                 }
-                returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b, newRelevantValues) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
             }
         }
     }
@@ -140,15 +154,79 @@ bool TopologicalLinearEquationSolver<ValueType>::internalSolveEquations(Environm
 }
 
 template<typename ValueType>
-void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const {
     // Obtain the scc decomposition
     this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions()
+                      .forceTopologicalSort()
+                      .computeSccDepths(needLongestChainSize || numberOfThreads != 1)
+                      .numberOfThreads(numberOfThreads));
     if (needLongestChainSize) {
         this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
     }
 }
 
+template<typename ValueType>
+bool TopologicalLinearEquationSolver<ValueType>::solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x,
+                                                                       std::vector<ValueType> const& b,
+                                                                       std::optional<storm::storage::BitVector> const& relevantValues,
+                                                                       uint64_t numberOfThreads) const {
+    STORM_LOG_ASSERT(this->sortedSccDecomposition->hasSccDepth(), "SCC depths are required to solve SCCs concurrently.");
+    // An SCC only depends on SCCs with a smaller depth. We therefore process the SCCs level by level, starting with the bottom SCCs (depth 0).
+    std::vector<std::vector<uint64_t>> sccsPerDepth(this->sortedSccDecomposition->getMaxSccDepth() + 1);
+    for (uint64_t sccIndex = 0; sccIndex < this->sortedSccDecomposition->size(); ++sccIndex) {
+        sccsPerDepth[this->sortedSccDecomposition->getSccDepth(sccIndex)].push_back(sccIndex);
+    }
+
+    auto threadPool = storm::utility::ThreadPool::getShared(numberOfThreads);
+    uint64_t const numberOfWorkers = threadPool->getNumberOfWorkers();
+    STORM_LOG_INFO("Solving " << this->sortedSccDecomposition->size() << " SCCs in " << sccsPerDepth.size() << " levels using " << numberOfWorkers
+                              << " threads.");
+
+    // Each worker has its own solver and auxiliary data. Within a level, workers only write entries of x that belong to their SCC.
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> sccSolvers(numberOfWorkers);
+    std::vector<storm::storage::BitVector> sccsAsBitVectors(numberOfWorkers, storm::storage::BitVector(x.size(), false));
+    std::vector<char> workerReturnValues(numberOfWorkers, true);
+    // Sub-environments are created lazily upon first access, so the workers must not share an environment. The copies are made on this thread.
+    std::vector<storm::Environment> workerEnvironments(numberOfWorkers, sccSolverEnvironment);
+    // Make sure that the row group indices are not created lazily by one of the workers.
+    this->A->getRowGroupIndices();
+
+    uint64_t numberOfSolvedSccs = 0;
+    storm::utility::ProgressMeasurement progress("SCCs");
+    progress.setMaxCount(this->sortedSccDecomposition->size());
+    progress.startNewMeasurement(0);
+    for (auto const& sccIndices : sccsPerDepth) {
+        threadPool->parallelFor(sccIndices.size(), [&](uint64_t taskIndex, uint64_t workerIndex) {
+            auto const& scc = this->sortedSccDecomposition->getBlock(sccIndices[taskIndex]);
+            bool sccReturnValue;
+            if (scc.size() == 1) {
+                sccReturnValue = solveTrivialScc(*scc.begin(), x, b);
+            } else {
+                auto& sccAsBitVector = sccsAsBitVectors[workerIndex];
+                for (auto const& state : scc) {
+                    sccAsBitVector.set(state, true);
+                }
+                sccReturnValue = solveScc(workerEnvironments[workerIndex], sccAsBitVector, x, b, relevantValues, sccSolvers[workerIndex]);
+                // Reset only the bits of this SCC (which is cheaper than clearing the whole bit vector).
+                for (auto const& state : scc) {
+                    sccAsBitVector.set(state, false);
+                }
+            }
+            if (!sccReturnValue) {
+                workerReturnValues[workerIndex] = false;
+            }
+        });
+        numberOfSolvedSccs += sccIndices.size();
+        progress.updateProgress(numberOfSolvedSccs);
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Topological solver aborted after analyzing " << numberOfSolvedSccs << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+            break;
+        }
+    }
+    return std::all_of(workerReturnValues.begin(), workerReturnValues.end(), [](char const& value) { return value; });
+}
+
 template<typename ValueType>
 bool TopologicalLinearEquationSolver<ValueType>::solveTrivialScc(uint64_t const& sccState, std::vector<ValueType>& globalX,
                                                                  std::vector<ValueType> const& globalB) const {
@@ -205,23 +283,24 @@ bool TopologicalLinearEquationSolver<ValueType>::solveFullyConnectedEquationSyst
 template<typename ValueType>
 bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc,
                                                           std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB,
-                                                          std::optional<storm::storage::BitVector> const& globalRelevantValues) const {
+                                                          std::optional<storm::storage::BitVector> const& globalRelevantValues,
+                                                          std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver) const {
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!sccSolver) {
+        sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        sccSolver->setCachingEnabled(true);
     }
     if (globalRelevantValues) {
-        this->sccSolver->setRelevantValues((*globalRelevantValues) % scc);
+        sccSolver->setRelevantValues((*globalRelevantValues) % scc);
     }
 
     // Matrix
-    bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+    bool asEquationSystem = sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
     storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
     if (asEquationSystem) {
         sccA.convertToEquationSystem();
     }
-    this->sccSolver->setMatrix(std::move(sccA));
+    sccSolver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -241,20 +320,20 @@ bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment con
 
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        sccSolver->setLowerBound(this->getLowerBound());
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+        sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        sccSolver->setUpperBound(this->getUpperBound());
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+        sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
     }
 
     // std::cout << "rhs is " << storm::utility::vector::toString(sccB) << '\n';
     // std::cout << "x is " << storm::utility::vector::toString(sccX) << '\n';
 
-    bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+    bool returnvalue = sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
     storm::utility::vector::setVectorValues(globalX, scc, sccX);
     return returnvalue;
 }
@@ -36,8 +36,12 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
 
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
-    // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-    void createSortedSccDecomposition(bool needLongestChainSize) const;
+    // Creates an SCC decomposition and sorts the SCCs according to a topological sort. SCC depths are computed if multiple threads are used.
+    void createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const;
+
+    // Solves all SCCs such that SCCs with the same depth (which are independent of each other) are solved concurrently
+    bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                               std::optional<storm::storage::BitVector> const& relevantValues, uint64_t numberOfThreads) const;
 
     // Solves the SCC with the given index
     // ... for the case that the SCC is trivial
@@ -46,7 +50,8 @@ class TopologicalLinearEquationSolver : public LinearEquationSolver<ValueType> {
     bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     // ... for the remaining cases (1 < scc.size() < x.size())
     bool solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX,
-                  std::vector<ValueType> const& globalB, std::optional<storm::storage::BitVector> const& globalRelevantValues) const;
+                  std::vector<ValueType> const& globalB, std::optional<storm::storage::BitVector> const& globalRelevantValues,
+                  std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver) const;
 
     // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
     // when the solver is destructed.
@@ -1,5 +1,7 @@
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
+#include <algorithm>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
@@ -7,9 +9,11 @@
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/ProgressMeasurement.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/Stopwatch.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 
@@ -57,11 +61,17 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
 
     // For sound computations we need to increase the precision in each SCC
     bool needAdaptPrecision = env.solver().isForceSoundness();
-
-    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
+    // Independent SCCs are solved concurrently if multiple threads are requested. This requires the depth of each SCC.
+    // Exact and parametric arithmetic is not safe to be used concurrently, so SCCs of such models are always solved sequentially.
+    bool const solveConcurrently = !storm::NumberTraits<ValueType>::IsExact && env.solver().topological().getNumberOfThreads() != 1;
+    STORM_LOG_WARN_COND(!storm::NumberTraits<ValueType>::IsExact || env.solver().topological().getNumberOfThreads() == 1,
+                        "Concurrent topological solving is not supported for exact or parametric value types. Solving SCCs sequentially.");
+
+    if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize) ||
+        (solveConcurrently && !this->sortedSccDecomposition->hasSccDepth())) {
         STORM_LOG_TRACE("Creating SCC decomposition.");
         storm::utility::Stopwatch sccSw(true);
-        createSortedSccDecomposition(needAdaptPrecision);
+        createSortedSccDecomposition(needAdaptPrecision, solveConcurrently ? env.solver().topological().getNumberOfThreads() : 1);
         sccSw.stop();
         STORM_LOG_INFO("SCC decomposition computed in "
                        << sccSw << ". Found " << this->sortedSccDecomposition->size() << " SCC(s) containing a total of " << x.size()
@@ -114,39 +124,33 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
                 }
             }
         }
-        storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-        storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-        uint64_t sccIndex = 0;
-        storm::utility::ProgressMeasurement progress("states");
-        progress.setMaxCount(x.size());
-        progress.startNewMeasurement(0);
-        for (auto const& scc : *this->sortedSccDecomposition) {
-            if (scc.size() == 1) {
-                returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-            } else {
-                STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
-                sccRowGroupsAsBitVector.clear();
-                sccRowsAsBitVector.clear();
-                for (auto const& group : scc) {  // Group refers to state
-                    sccRowGroupsAsBitVector.set(group, true);
-
-                    if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
-                        for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                            sccRowsAsBitVector.set(row, true);
-                        }
-                    } else {
-                        auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
-                        sccRowsAsBitVector.set(row, true);
-                        STORM_LOG_TRACE("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
-                    }
+        if (solveConcurrently) {
+            returnValue = solveSccsConcurrently(sccSolverEnvironment, dir, x, b, newRelevantValues, env.solver().topological().getNumberOfThreads());
+        } else {
+            storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+            storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+            uint64_t sccIndex = 0;
+            storm::utility::ProgressMeasurement progress("states");
+            progress.setMaxCount(x.size());
+            progress.startNewMeasurement(0);
+            for (auto const& scc : *this->sortedSccDecomposition) {
+                if (scc.size() == 1) {
+                    returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
+                } else {
+                    STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                    sccRowGroupsAsBitVector.clear();
+                    sccRowsAsBitVector.clear();
+                    setSccRowGroupsAndRows(scc, sccRowGroupsAsBitVector, sccRowsAsBitVector);
+                    returnValue =
+                        solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b, newRelevantValues, this->sccSolver) &&
+                        returnValue;
+                }
+                ++sccIndex;
+                progress.updateProgress(sccIndex);
+                if (storm::utility::resources::isTerminate()) {
+                    STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+                    break;
                 }
-                returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b, newRelevantValues) && returnValue;
-            }
-            ++sccIndex;
-            progress.updateProgress(sccIndex);
-            if (storm::utility::resources::isTerminate()) {
-                STORM_LOG_WARN("Topological solver aborted after analyzing " << sccIndex << "/" << this->sortedSccDecomposition->size() << " SCCs.");
-                break;
             }
         }
 
@@ -168,15 +172,101 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::internalSol
 }
 
 template<typename ValueType, typename SolutionType>
-void TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+void TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const {
     // Obtain the scc decomposition
     this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(
-        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+        *this->A, storm::storage::StronglyConnectedComponentDecompositionOptions()
+                      .forceTopologicalSort()
+                      .computeSccDepths(needLongestChainSize || numberOfThreads != 1)
+                      .numberOfThreads(numberOfThreads));
     if (needLongestChainSize) {
         this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
     }
 }
 
+template<typename ValueType, typename SolutionType>
+bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveSccsConcurrently(storm::Environment const& sccSolverEnvironment,
+                                                                                           OptimizationDirection dir, std::vector<SolutionType>& x,
+                                                                                           std::vector<ValueType> const& b,
+                                                                                           std::optional<storm::storage::BitVector> const& relevantValues,
+                                                                                           uint64_t numberOfThreads) const {
+    STORM_LOG_ASSERT(this->sortedSccDecomposition->hasSccDepth(), "SCC depths are required to solve SCCs concurrently.");
+    // An SCC only depends on SCCs with a smaller depth. We therefore process the SCCs level by level, starting with the bottom SCCs (depth 0).
+    std::vector<std::vector<uint64_t>> sccsPerDepth(this->sortedSccDecomposition->getMaxSccDepth() + 1);
+    for (uint64_t sccIndex = 0; sccIndex < this->sortedSccDecomposition->size(); ++sccIndex) {
+        sccsPerDepth[this->sortedSccDecomposition->getSccDepth(sccIndex)].push_back(sccIndex);
+    }
+
+    auto threadPool = storm::utility::ThreadPool::getShared(numberOfThreads);
+    uint64_t const numberOfWorkers = threadPool->getNumberOfWorkers();
+    STORM_LOG_INFO("Solving " << this->sortedSccDecomposition->size() << " SCCs in " << sccsPerDepth.size() << " levels using " << numberOfWorkers
+                              << " threads.");
+
+    // Each worker has its own solver and auxiliary data. Within a level, workers only write entries of x (and of the scheduler) that belong to their SCC.
+    std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> sccSolvers(numberOfWorkers);
+    std::vector<storm::storage::BitVector> sccRowGroups(numberOfWorkers, storm::storage::BitVector(x.size(), false));
+    std::vector<storm::storage::BitVector> sccRows(numberOfWorkers, storm::storage::BitVector(b.size(), false));
+    std::vector<char> workerReturnValues(numberOfWorkers, true);
+    // Sub-environments are created lazily upon first access, so the workers must not share an environment. The copies are made on this thread.
+    std::vector<storm::Environment> workerEnvironments(numberOfWorkers, sccSolverEnvironment);
+    // Make sure that the row group indices are not created lazily by one of the workers.
+    auto const& rowGroupIndices = this->A->getRowGroupIndices();
+
+    uint64_t numberOfSolvedSccs = 0;
+    storm::utility::ProgressMeasurement progress("SCCs");
+    progress.setMaxCount(this->sortedSccDecomposition->size());
+    progress.startNewMeasurement(0);
+    for (auto const& sccIndices : sccsPerDepth) {
+        threadPool->parallelFor(sccIndices.size(), [&](uint64_t taskIndex, uint64_t workerIndex) {
+            auto const& scc = this->sortedSccDecomposition->getBlock(sccIndices[taskIndex]);
+            bool sccReturnValue;
+            if (scc.size() == 1) {
+                sccReturnValue = solveTrivialScc(*scc.begin(), dir, x, b);
+            } else {
+                auto& workerSccRowGroups = sccRowGroups[workerIndex];
+                auto& workerSccRows = sccRows[workerIndex];
+                setSccRowGroupsAndRows(scc, workerSccRowGroups, workerSccRows);
+                sccReturnValue =
+                    solveScc(workerEnvironments[workerIndex], dir, workerSccRowGroups, workerSccRows, x, b, relevantValues, sccSolvers[workerIndex]);
+                // Reset only the bits of this SCC (which is cheaper than clearing the whole bit vectors).
+                for (auto const& group : scc) {
+                    workerSccRowGroups.set(group, false);
+                    workerSccRows.setMultiple(rowGroupIndices[group], rowGroupIndices[group + 1] - rowGroupIndices[group], false);
+                }
+            }
+            if (!sccReturnValue) {
+                workerReturnValues[workerIndex] = false;
+            }
+        });
+        numberOfSolvedSccs += sccIndices.size();
+        progress.updateProgress(numberOfSolvedSccs);
+        if (storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Topological solver aborted after analyzing " << numberOfSolvedSccs << "/" << this->sortedSccDecomposition->size() << " SCCs.");
+            break;
+        }
+    }
+    return std::all_of(workerReturnValues.begin(), workerReturnValues.end(), [](char const& value) { return value; });
+}
+
+template<typename ValueType, typename SolutionType>
+void TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::setSccRowGroupsAndRows(storm::storage::StronglyConnectedComponent const& scc,
+                                                                                            storm::storage::BitVector& sccRowGroups,
+                                                                                            storm::storage::BitVector& sccRows) const {
+    for (auto const& group : scc) {  // Group refers to state
+        sccRowGroups.set(group, true);
+
+        if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
+            for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                sccRows.set(row, true);
+            }
+        } else {
+            auto row = this->A->getRowGroupIndices()[group] + this->getInitialScheduler()[group];
+            sccRows.set(row, true);
+            STORM_LOG_TRACE("Fixing state " << group << " to choice " << this->getInitialScheduler()[group] << ".");
+        }
+    }
+}
+
 template<typename ValueType, typename SolutionType>
 bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveTrivialScc(uint64_t const& sccState, OptimizationDirection dir,
                                                                                      std::vector<SolutionType>& globalX,
@@ -310,21 +400,21 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveFullyC
 }
 
 template<typename ValueType, typename SolutionType>
-bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir,
-                                                                              storm::storage::BitVector const& sccRowGroups,
-                                                                              storm::storage::BitVector const& sccRows, std::vector<SolutionType>& globalX,
-                                                                              std::vector<ValueType> const& globalB,
-                                                                              std::optional<storm::storage::BitVector> const& globalRelevantValues) const {
+bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(
+    storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups,
+    storm::storage::BitVector const& sccRows, std::vector<SolutionType>& globalX, std::vector<ValueType> const& globalB,
+    std::optional<storm::storage::BitVector> const& globalRelevantValues,
+    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver) const {
     // Set up the SCC solver
-    if (!this->sccSolver) {
-        this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-        this->sccSolver->setCachingEnabled(true);
+    if (!sccSolver) {
+        sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+        sccSolver->setCachingEnabled(true);
     }
-    this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-    this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-    this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+    sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
+    sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
+    sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
     if (globalRelevantValues) {
-        this->sccSolver->setRelevantValues((*globalRelevantValues) % sccRowGroups);
+        sccSolver->setRelevantValues((*globalRelevantValues) % sccRowGroups);
     }
 
     storm::storage::SparseMatrix<ValueType> sccA;
@@ -339,7 +429,7 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
             // As we removed the entries where the choice was fixed, we need to change the scheduler.
             // We set the scheduler to 0 for those states.
             storm::utility::vector::setVectorValues<uint_fast64_t>(sccInitChoices, choiceFixedForStateSCC, 0);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            sccSolver->setInitialScheduler(std::move(sccInitChoices));
         }
 
     } else {
@@ -348,11 +438,11 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
         // initial scheduler
         if (this->hasInitialScheduler()) {
             auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-            this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+            sccSolver->setInitialScheduler(std::move(sccInitChoices));
         }
     }
 
-    this->sccSolver->setMatrix(std::move(sccA));
+    sccSolver->setMatrix(std::move(sccA));
 
     // x Vector
     auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
@@ -370,21 +460,21 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
         sccB.push_back(std::move(bi));
     }
 
-    auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
-    this->sccSolver->clearBounds();
+    auto req = sccSolver->getRequirements(sccSolverEnvironment, dir);
+    sccSolver->clearBounds();
     // lower/upper bounds
     if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setLowerBound(this->getLowerBound());
+        sccSolver->setLowerBound(this->getLowerBound());
         req.clearLowerBounds();
     } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+        sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
         req.clearLowerBounds();
     }
     if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-        this->sccSolver->setUpperBound(this->getUpperBound());
+        sccSolver->setUpperBound(this->getUpperBound());
         req.clearUpperBounds();
     } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-        this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+        sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
         req.clearUpperBounds();
     }
 
@@ -397,14 +487,14 @@ bool TopologicalMinMaxLinearEquationSolver<ValueType, SolutionType>::solveScc(st
     }
     STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException,
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-    this->sccSolver->setRequirementsChecked(true);
+    sccSolver->setRequirementsChecked(true);
 
     // Invoke scc solver
-    bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+    bool res = sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
 
     // Set Scheduler choices
     if (this->isTrackSchedulerSet()) {
-        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+        storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, sccSolver->getSchedulerChoices());
     }
 
     // Set solution
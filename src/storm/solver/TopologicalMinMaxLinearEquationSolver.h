@@ -35,8 +35,17 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
    private:
     storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
-    // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-    void createSortedSccDecomposition(bool needLongestChainSize) const;
+    // Creates an SCC decomposition and sorts the SCCs according to a topological sort. SCC depths are computed if multiple threads are used.
+    void createSortedSccDecomposition(bool needLongestChainSize, uint64_t numberOfThreads) const;
+
+    // Solves all SCCs such that SCCs with the same depth (which are independent of each other) are solved concurrently
+    bool solveSccsConcurrently(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<SolutionType>& x,
+                               std::vector<ValueType> const& b, std::optional<storm::storage::BitVector> const& relevantValues,
+                               uint64_t numberOfThreads) const;
+
+    // Sets the row groups and rows (considering fixed choices) of the given SCC in the provided bit vectors. Other bits are not touched.
+    void setSccRowGroupsAndRows(storm::storage::StronglyConnectedComponent const& scc, storm::storage::BitVector& sccRowGroups,
+                                storm::storage::BitVector& sccRows) const;
 
     // Solves the SCC with the given index
     // ... for the case that the SCC is trivial
@@ -47,7 +56,8 @@ class TopologicalMinMaxLinearEquationSolver : public StandardMinMaxLinearEquatio
     // ... for the remaining cases (1 < scc.size() < x.size())
     bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups,
                   storm::storage::BitVector const& sccRows, std::vector<SolutionType>& globalX, std::vector<ValueType> const& globalB,
-                  std::optional<storm::storage::BitVector> const& globalRelevantValues) const;
+                  std::optional<storm::storage::BitVector> const& globalRelevantValues,
+                  std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver) const;
 
     // cached auxiliary data
     mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
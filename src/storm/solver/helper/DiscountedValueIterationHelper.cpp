@@ -58,6 +58,10 @@ class DiscountedVIOperatorBackend {
         return false;
     }
 
+    void merge(DiscountedVIOperatorBackend const& other) {
+        isConverged &= other.isConverged;
+    }
+
    private:
     storm::utility::Extremum<Dir, ValueType> best;
     uint64_t currentIteration = 0;
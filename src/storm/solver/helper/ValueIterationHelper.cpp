@@ -50,6 +50,10 @@ class VIOperatorBackend {
         return false;
     }
 
+    void merge(VIOperatorBackend const& other) {
+        isConverged &= other.isConverged;
+    }
+
    private:
     storm::utility::Extremum<Dir, ValueType> best;
     ValueType const precision;
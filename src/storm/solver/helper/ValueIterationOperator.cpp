@@ -1,11 +1,13 @@
 #include "storm/solver/helper/ValueIterationOperator.h"
 
+#include <algorithm>
 #include <optional>
 
 #include "storm/adapters/IntervalAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/threads.h"
 
 namespace storm::solver::helper {
 
@@ -77,6 +79,9 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMat
             }
         }
     }
+    if (numberOfThreads != 1) {
+        setUpParallelization();
+    }
 }
 
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
@@ -91,6 +96,60 @@ void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setMat
     setMatrix<true>(matrix, rowGroupIndices);
 }
 
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setNumberOfThreads(uint64_t numberOfThreads) {
+    if (this->numberOfThreads != numberOfThreads) {
+        this->numberOfThreads = numberOfThreads;
+        setUpParallelization();
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::setUpParallelization() {
+    auto const actualNumberOfThreads = numberOfThreads == 0 ? std::max<uint64_t>(1, storm::utility::getNumberOfThreads()) : numberOfThreads;
+    if (actualNumberOfThreads > 1 && !storm::IsIntervalType<ValueType>) {
+        threadPool = storm::utility::ThreadPool::getShared(actualNumberOfThreads);
+        computeChunks();
+    } else {
+        threadPool.reset();
+        chunks.clear();
+    }
+}
+
+template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
+void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::computeChunks() {
+    // Chunks should fit into the (L2) cache, but there should also be enough chunks to balance the load among the workers
+    uint64_t const minChunkSize = 1ull << 12;
+    uint64_t const maxChunkSize = 1ull << 15;
+    uint64_t const chunksPerWorker = 8;
+    uint64_t const chunkSize =
+        std::clamp<uint64_t>(matrixValues.size() / (chunksPerWorker * std::max<uint64_t>(1, threadPool->getNumberOfWorkers())), minChunkSize, maxChunkSize);
+    chunks.clear();
+    IndexType position = 0;
+    IndexType valueOffset = 0;
+    for (IndexType columnOffset = 0; columnOffset + 1 < matrixColumns.size(); ++columnOffset) {
+        auto const column = matrixColumns[columnOffset];
+        if (column < StartOfRowIndicator) {
+            ++valueOffset;
+            continue;
+        }
+        // With trivial row grouping, each row is a row group
+        if (TrivialRowGrouping || (column & StartOfRowGroupIndicator) == StartOfRowGroupIndicator) {
+            if (chunks.empty() || valueOffset - chunks.back().valueOffset >= chunkSize) {
+                chunks.push_back({position, columnOffset, valueOffset});
+            }
+            ++position;
+        }
+    }
+    STORM_LOG_ASSERT(valueOffset == matrixValues.size(), "Unexpected number of matrix entries.");
+    chunks.push_back({position, matrixColumns.size() - 1, valueOffset});
+    if (chunks.size() <= 2) {
+        // Parallelization does not pay off for a single chunk
+        chunks.clear();
+        threadPool.reset();
+    }
+}
+
 template<typename ValueType, bool TrivialRowGrouping, typename SolutionType>
 void ValueIterationOperator<ValueType, TrivialRowGrouping, SolutionType>::unsetIgnoredRows() {
     for (auto& c : matrixColumns) {
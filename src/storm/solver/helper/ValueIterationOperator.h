@@ -1,10 +1,13 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <boost/range/adaptor/reversed.hpp>
 #include <boost/range/irange.hpp>
 #include <functional>
+#include <memory>
 #include <optional>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -15,6 +18,8 @@
 #include "storm/solver/helper/ValueIterationOperatorForward.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/sparse/StateType.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -132,6 +137,17 @@ class ValueIterationOperator {
         return applyRobust<RobustDir>(operand, operand, offsets, backend);
     }
 
+    /*!
+     * Sets the number of threads used when applying the operator.
+     * With more than one thread, the row groups are partitioned into chunks of consecutive groups that are processed concurrently.
+     * This only affects applications where input and output operand differ (i.e., Jacobi-style sweeps) and where the backend provides a
+     * `merge(BackendType const&)` method that combines the state of a copy of the backend (e.g. for convergence checks). The method `abort()` of the
+     * backend is checked per group and worker; once a worker aborts, no further chunks are started.
+     * In all other cases, the operator is applied sequentially.
+     * @param numberOfThreads the number of threads to use. Zero means that the number of threads is detected automatically.
+     */
+    void setNumberOfThreads(uint64_t numberOfThreads);
+
     /*!
      * Sets rows that will be skipped when applying the operator.
      * @note each row group shall have at least one row that is not ignored
@@ -173,10 +189,68 @@ class ValueIterationOperator {
     bool apply(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend) const {
         auto const outSize = TrivialRowGrouping ? getSize(operandOut) : rowGroupIndices->size() - 1;
         STORM_LOG_ASSERT(TrivialRowGrouping || getSize(operandOut) >= outSize, "Dimension mismatch");
+        if constexpr (supportsParallelApply<OperandType, BackendType>()) {
+            if (threadPool && &operandIn != &operandOut) {
+                return applyParallel<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(operandOut, operandIn, offsets, backend,
+                                                                                                                     outSize);
+            }
+        }
         backend.startNewIteration();
         auto matrixValueIt = matrixValues.cbegin();
         auto matrixColumnIt = matrixColumns.cbegin();
-        for (auto groupIndex : indexRange<Backward>(0, outSize)) {
+        if (!applyGroups<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(operandOut, operandIn, offsets, backend, outSize, 0,
+                                                                                                           outSize, matrixColumnIt, matrixValueIt)) {
+            return backend.converged();
+        }
+        STORM_LOG_ASSERT(matrixColumnIt + 1 == matrixColumns.cend(), "Unexpected position of matrix column iterator.");
+        STORM_LOG_ASSERT(matrixValueIt == matrixValues.cend(), "Unexpected position of matrix column iterator.");
+        backend.endOfIteration();
+        return backend.converged();
+    }
+
+    /*!
+     * Variant of `apply` where the row groups are processed concurrently in chunks. Each worker uses its own copy of the backend.
+     * Once all chunks are processed, the copies are merged into the given backend via backend.merge(workerBackend).
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows, OptimizationDirection RobustDirection>
+    bool applyParallel(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend, uint64_t outSize) const {
+        STORM_LOG_ASSERT(chunks.size() > 1 && chunks.back().firstPosition == outSize, "Chunks do not match the size of the operand.");
+        backend.startNewIteration();
+        std::vector<BackendType> workerBackends(threadPool->getNumberOfWorkers(), backend);
+        std::atomic<bool> aborted{false};
+        threadPool->parallelFor(chunks.size() - 1, [&](uint64_t chunkIndex, uint64_t workerIndex) {
+            if (aborted.load(std::memory_order_relaxed)) {
+                return;
+            }
+            auto const& chunk = chunks[chunkIndex];
+            auto matrixColumnIt = matrixColumns.cbegin() + chunk.columnOffset;
+            auto matrixValueIt = matrixValues.cbegin() + chunk.valueOffset;
+            if (!applyGroups<OperandType, OffsetType, BackendType, Backward, SkipIgnoredRows, RobustDirection>(
+                    operandOut, operandIn, offsets, workerBackends[workerIndex], outSize, chunk.firstPosition, chunks[chunkIndex + 1].firstPosition,
+                    matrixColumnIt, matrixValueIt)) {
+                aborted.store(true, std::memory_order_relaxed);
+            }
+        });
+        for (auto const& workerBackend : workerBackends) {
+            backend.merge(workerBackend);
+        }
+        if (aborted.load(std::memory_order_relaxed)) {
+            return backend.converged();
+        }
+        backend.endOfIteration();
+        return backend.converged();
+    }
+
+    /*!
+     * Processes the row groups at the given positions (w.r.t. the order in which the groups are stored) and advances the given iterators accordingly.
+     * @return false iff the backend requested an abort.
+     */
+    template<typename OperandType, typename OffsetType, typename BackendType, bool Backward, bool SkipIgnoredRows, OptimizationDirection RobustDirection>
+    bool applyGroups(OperandType& operandOut, OperandType const& operandIn, OffsetType const& offsets, BackendType& backend, uint64_t outSize,
+                     uint64_t firstPosition, uint64_t endPosition, std::vector<IndexType>::const_iterator& matrixColumnIt,
+                     typename std::vector<ValueType>::const_iterator& matrixValueIt) const {
+        for (auto position : boost::irange(firstPosition, endPosition)) {
+            auto const groupIndex = Backward ? outSize - 1 - position : position;
             STORM_LOG_ASSERT(matrixColumnIt != matrixColumns.end(), "VI Operator in invalid state.");
             STORM_LOG_ASSERT(*matrixColumnIt >= StartOfRowIndicator, "VI Operator in invalid state.");
             if constexpr (TrivialRowGrouping) {
@@ -208,13 +282,24 @@ class ValueIterationOperator {
                 backend.applyUpdate(operandOut[groupIndex], groupIndex);
             }
             if (backend.abort()) {
-                return backend.converged();
+                return false;
             }
         }
-        STORM_LOG_ASSERT(matrixColumnIt + 1 == matrixColumns.cend(), "Unexpected position of matrix column iterator.");
-        STORM_LOG_ASSERT(matrixValueIt == matrixValues.cend(), "Unexpected position of matrix column iterator.");
-        backend.endOfIteration();
-        return backend.converged();
+        return true;
+    }
+
+    /*!
+     * @return true iff the operator can be applied in parallel with the given types.
+     * This requires that the backend can be copied and merged. Interval models are not supported as their rows share a cache.
+     * Exact and parametric value types are always processed sequentially as their arithmetic is not safe to be used concurrently.
+     */
+    template<typename OperandType, typename BackendType>
+    static constexpr bool supportsParallelApply() {
+        if constexpr (storm::IsIntervalType<ValueType> || storm::NumberTraits<ValueType>::IsExact) {
+            return false;
+        } else {
+            return std::is_copy_constructible_v<BackendType> && requires(BackendType & backend, BackendType const& other) { backend.merge(other); };
+        }
     }
 
     // Auxiliary methods to deal with various OperandTypes and OffsetTypes
@@ -440,6 +525,40 @@ class ValueIterationOperator {
      */
     std::vector<IndexType> const* rowGroupIndices;
 
+    /*!
+     * A chunk of consecutive row groups that is processed by a single worker when the operator is applied in parallel
+     */
+    struct Chunk {
+        IndexType firstPosition;  // position of the first group of the chunk (w.r.t. the order in which the groups are stored)
+        IndexType columnOffset;   // offset of the first group in 'matrixColumns'
+        IndexType valueOffset;    // offset of the first group in 'matrixValues'
+    };
+
+    /*!
+     * Sets up the thread pool and the chunks according to the number of threads and the current matrix
+     */
+    void setUpParallelization();
+
+    /*!
+     * Partitions the row groups into chunks. The last chunk is a sentinel that marks the end of the matrix.
+     */
+    void computeChunks();
+
+    /*!
+     * Chunks for parallel applications. Empty if the operator is applied sequentially.
+     */
+    std::vector<Chunk> chunks;
+
+    /*!
+     * The pool of workers used for parallel applications. nullptr if the operator is applied sequentially.
+     */
+    std::shared_ptr<storm::utility::ThreadPool> threadPool;
+
+    /*!
+     * The number of threads that shall be used. Zero means that it is detected automatically.
+     */
+    uint64_t numberOfThreads{1};
+
     /*!
      * True iff the matrix was set in backward orders
      */
@@ -143,6 +143,15 @@ bool BitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const
     return findBucket(key).first;
 }
 
+template<class ValueType, class Hash>
+std::optional<ValueType> BitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+    std::pair<bool, uint64_t> flagBucketPair = this->findBucket(key);
+    if (flagBucketPair.first) {
+        return values[flagBucketPair.second];
+    }
+    return std::nullopt;
+}
+
 template<class ValueType, class Hash>
 typename BitVectorHashMap<ValueType, Hash>::const_iterator BitVectorHashMap<ValueType, Hash>::begin() const {
     return const_iterator(*this, occupied.begin());
@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <optional>
 
 #include "storm/storage/BitVector.h"
 
@@ -117,6 +118,15 @@ class BitVectorHashMap {
      */
     bool contains(storm::storage::BitVector const& key) const;
 
+    /*!
+     * Searches for the given key in the map. As opposed to calling contains and getValue, this only searches once.
+     * This method does not modify the map and can therefore be called concurrently (as long as the map is not modified).
+     *
+     * @param key The key to search.
+     * @return The value associated with the given key or nothing if the key is not contained in the map.
+     */
+    std::optional<ValueType> find(storm::storage::BitVector const& key) const;
+
     /*!
      * Retrieves an iterator to the elements of the map.
      *
@@ -0,0 +1,479 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "storm/exceptions/InternalException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm::storage {
+
+namespace detail {
+// The number of slots of the previous table that are migrated at once.
+static const uint64_t migrationChunkSize = 256;
+
+// Hash values are truncated such that they fit into the state word of a slot (next to the slot status).
+static const uint64_t hashMask = (1ull << 62) - 1;
+
+// Retrieves an index that is (most likely) unique for the calling thread.
+static uint64_t getThreadIndex() {
+    static std::atomic<uint64_t> nextThreadIndex{0};
+    static thread_local uint64_t const threadIndex = nextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+    return threadIndex;
+}
+
+// Waits until the given state word no longer indicates a slot that is being filled.
+static uint64_t waitWhileReserved(std::atomic<uint64_t> const& slotState, uint64_t state, uint64_t reservedStatus, uint64_t statusMask) {
+    for (uint64_t spins = 0; (state & statusMask) == reservedStatus; ++spins) {
+        if (spins > 64) {
+            std::this_thread::yield();
+        }
+        state = slotState.load(std::memory_order_acquire);
+    }
+    return state;
+}
+}  // namespace detail
+
+template<typename ValueType, typename Hash>
+struct ConcurrentBitVectorHashMap<ValueType, Hash>::Table {
+    Table(uint64_t sizeExponent, uint64_t wordsPerKey)
+        : sizeExponent(sizeExponent),
+          numberOfSlots(1ull << sizeExponent),
+          slotStates(std::make_unique<std::atomic<uint64_t>[]>(numberOfSlots)),
+          keys(std::make_unique<uint64_t[]>(numberOfSlots * wordsPerKey)),
+          values(std::make_unique<ValueType[]>(numberOfSlots)) {
+        // Intentionally left empty.
+    }
+
+    uint64_t numberOfChunks() const {
+        return (numberOfSlots + detail::migrationChunkSize - 1) / detail::migrationChunkSize;
+    }
+
+    uint64_t sizeExponent;
+    uint64_t numberOfSlots;
+    std::unique_ptr<std::atomic<uint64_t>[]> slotStates;
+    std::unique_ptr<uint64_t[]> keys;
+    std::unique_ptr<ValueType[]> values;
+};
+
+template<typename ValueType, typename Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map,
+                                                                                                                    uint64_t tableIndex, uint64_t slot)
+    : map(map), tableIndex(tableIndex), slot(slot) {
+    skipUnoccupiedSlots();
+}
+
+template<typename ValueType, typename Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator==(ConcurrentBitVectorHashMapIterator const& other) const {
+    return &map == &other.map && tableIndex == other.tableIndex && slot == other.slot;
+}
+
+template<typename ValueType, typename Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator!=(ConcurrentBitVectorHashMapIterator const& other) const {
+    return !(*this == other);
+}
+
+template<typename ValueType, typename Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator&
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator++() {
+    ++slot;
+    skipUnoccupiedSlots();
+    return *this;
+}
+
+template<typename ValueType, typename Hash>
+std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator*() const {
+    Table const& table = tableIndex == 0 ? *map.previousTable.load() : *map.currentTable.load();
+    storm::storage::BitVector key(map.bucketSize);
+    for (uint64_t word = 0; word < map.wordsPerKey; ++word) {
+        key.setBucket(word, table.keys[slot * map.wordsPerKey + word]);
+    }
+    return std::make_pair(std::move(key), table.values[slot]);
+}
+
+template<typename ValueType, typename Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::skipUnoccupiedSlots() {
+    // Entries of the previous table that are already migrated are skipped as they are also contained in the current table.
+    for (; tableIndex < 2; ++tableIndex, slot = 0) {
+        Table const* table = tableIndex == 0 ? map.previousTable.load() : map.currentTable.load();
+        if (table == nullptr) {
+            continue;
+        }
+        for (; slot < table->numberOfSlots; ++slot) {
+            if ((table->slotStates[slot].load(std::memory_order_acquire) & statusMask) == SlotStatus::Occupied) {
+                return;
+            }
+        }
+    }
+}
+
+template<typename ValueType, typename Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::OperationGuard::OperationGuard(ConcurrentBitVectorHashMap const& map) {
+    auto& counters = map.runningOperations;
+    uint64_t const counterIndex = detail::getThreadIndex() % numberOfOperationCounters;
+    while (true) {
+        uint64_t const currentEpoch = map.epoch.load();
+        counter = &counters[currentEpoch & 1][counterIndex].value;
+        counter->fetch_add(1);
+        if (map.epoch.load() == currentEpoch) {
+            return;
+        }
+        // The epoch has changed in the meantime, so we retry with the new epoch.
+        counter->fetch_sub(1, std::memory_order_release);
+    }
+}
+
+template<typename ValueType, typename Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::OperationGuard::~OperationGuard() {
+    release();
+}
+
+template<typename ValueType, typename Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::OperationGuard::release() {
+    if (counter != nullptr) {
+        counter->fetch_sub(1, std::memory_order_release);
+        counter = nullptr;
+    }
+}
+
+template<typename ValueType, typename Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor)
+    : bucketSize(bucketSize),
+      wordsPerKey(bucketSize / 64),
+      loadFactor(loadFactor),
+      maximalLoadFactor((1.0 + loadFactor) / 2.0),
+      currentTable(nullptr),
+      previousTable(nullptr),
+      previousTableStable(true),
+      resizing(false),
+      nextChunkToMigrate(0),
+      numberOfMigratedChunks(0),
+      numberOfElements(0),
+      resizeThreshold(0),
+      epoch(0) {
+    STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+    STORM_LOG_THROW(loadFactor > 0.0 && loadFactor < 1.0, storm::exceptions::InvalidArgumentException, "Illegal load factor " << loadFactor << ".");
+
+    uint64_t sizeExponent = 4;
+    while ((1ull << sizeExponent) < initialSize) {
+        ++sizeExponent;
+    }
+    currentTable.store(new Table(sizeExponent, wordsPerKey));
+    resizeThreshold.store(static_cast<uint64_t>(loadFactor * (1ull << sizeExponent)));
+}
+
+template<typename ValueType, typename Hash>
+ConcurrentBitVectorHashMap<ValueType, Hash>::~ConcurrentBitVectorHashMap() {
+    delete previousTable.load();
+    delete currentTable.load();
+}
+
+template<typename ValueType, typename Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+    return findOrCreateImpl(key, &value, nullptr).first;
+}
+
+template<typename ValueType, typename Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrCreate(storm::storage::BitVector const& key,
+                                                                                      std::function<ValueType()> const& createValue) {
+    return findOrCreateImpl(key, nullptr, &createValue);
+}
+
+template<typename ValueType, typename Hash>
+std::pair<ValueType, bool> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrCreateImpl(storm::storage::BitVector const& key, ValueType const* value,
+                                                                                          std::function<ValueType()> const* createValue) {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Unexpected key size.");
+    uint64_t const hash = computeHash(key);
+    std::pair<ValueType, bool> result;
+    while (true) {
+        OperationGuard guard(*this);
+        Table* current;
+        Table* previous;
+        if (!loadTables(current, previous)) {
+            guard.release();
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Keys that are not yet migrated are still found in the previous table. Since that table is no longer modified, keys that are not found there are
+        // only inserted into the current table.
+        if (previous != nullptr) {
+            if (auto previousValue = findInTable(*previous, key, hash)) {
+                result = std::make_pair(*previousValue, false);
+                break;
+            }
+        }
+
+        uint64_t const mask = current->numberOfSlots - 1;
+        uint64_t slot = getHomeSlot(*current, hash);
+        uint64_t probes = 0;
+        bool found = false;
+        while (!found) {
+            STORM_LOG_THROW(probes < current->numberOfSlots, storm::exceptions::InternalException, "Hash map is full.");
+            auto& slotState = current->slotStates[slot];
+            uint64_t state = slotState.load(std::memory_order_acquire);
+            if (state == SlotStatus::Empty) {
+                if (numberOfElements.fetch_add(1, std::memory_order_relaxed) >= maximalLoadFactor * current->numberOfSlots) {
+                    // The table is too full to insert further keys. We retry once the table has been resized.
+                    numberOfElements.fetch_sub(1, std::memory_order_relaxed);
+                    break;
+                }
+                if (!slotState.compare_exchange_strong(state, (hash << 2) | SlotStatus::Reserved, std::memory_order_acquire)) {
+                    // Another thread has reserved the slot in the meantime, so we inspect it again.
+                    numberOfElements.fetch_sub(1, std::memory_order_relaxed);
+                    continue;
+                }
+                for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                    current->keys[slot * wordsPerKey + word] = key.getBucket(word);
+                }
+                current->values[slot] = value != nullptr ? *value : (*createValue)();
+                result = std::make_pair(current->values[slot], true);
+                slotState.store((hash << 2) | SlotStatus::Occupied, std::memory_order_release);
+                found = true;
+            } else if ((state >> 2) == hash) {
+                detail::waitWhileReserved(slotState, state, SlotStatus::Reserved, statusMask);
+                if (keyEquals(*current, slot, key)) {
+                    result = std::make_pair(current->values[slot], false);
+                    found = true;
+                }
+            }
+            slot = (slot + 1) & mask;
+            ++probes;
+        }
+        if (found) {
+            break;
+        }
+        guard.release();
+        growIfNecessary();
+        std::this_thread::yield();
+    }
+    growIfNecessary();
+    return result;
+}
+
+template<typename ValueType, typename Hash>
+std::optional<ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::find(storm::storage::BitVector const& key) const {
+    STORM_LOG_ASSERT(key.size() == bucketSize, "Unexpected key size.");
+    uint64_t const hash = computeHash(key);
+    while (true) {
+        OperationGuard guard(*this);
+        Table* current;
+        Table* previous;
+        if (!loadTables(current, previous)) {
+            guard.release();
+            std::this_thread::yield();
+            continue;
+        }
+        if (previous != nullptr) {
+            if (auto previousValue = findInTable(*previous, key, hash)) {
+                return previousValue;
+            }
+        }
+        return findInTable(*current, key, hash);
+    }
+}
+
+template<typename ValueType, typename Hash>
+ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
+    auto value = find(key);
+    STORM_LOG_ASSERT(value.has_value(), "Unknown key.");
+    return *value;
+}
+
+template<typename ValueType, typename Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+    return find(key).has_value();
+}
+
+template<typename ValueType, typename Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+    return numberOfElements.load(std::memory_order_relaxed);
+}
+
+template<typename ValueType, typename Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+    OperationGuard guard(*this);
+    return currentTable.load()->numberOfSlots;
+}
+
+template<typename ValueType, typename Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::begin() const {
+    return const_iterator(*this, 0, 0);
+}
+
+template<typename ValueType, typename Hash>
+typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::end() const {
+    return const_iterator(*this, 2, 0);
+}
+
+template<typename ValueType, typename Hash>
+std::optional<ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::findInTable(Table const& table, storm::storage::BitVector const& key,
+                                                                                   uint64_t hash) const {
+    uint64_t const mask = table.numberOfSlots - 1;
+    uint64_t slot = getHomeSlot(table, hash);
+    for (uint64_t probes = 0; probes < table.numberOfSlots; ++probes, slot = (slot + 1) & mask) {
+        auto const& slotState = table.slotStates[slot];
+        uint64_t state = slotState.load(std::memory_order_acquire);
+        if (state == SlotStatus::Empty) {
+            return std::nullopt;
+        }
+        if ((state >> 2) == hash) {
+            detail::waitWhileReserved(slotState, state, SlotStatus::Reserved, statusMask);
+            if (keyEquals(table, slot, key)) {
+                return table.values[slot];
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+template<typename ValueType, typename Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::loadTables(Table*& current, Table*& previous) const {
+    current = currentTable.load();
+    previous = previousTable.load();
+    if (current != currentTable.load() || previous == current) {
+        // A resize happened while loading the tables.
+        return false;
+    }
+    return previous == nullptr || previousTableStable.load();
+}
+
+template<typename ValueType, typename Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::insertMigratedEntry(Table& table, uint64_t const* keyWords, ValueType const& value, uint64_t hash) {
+    uint64_t const mask = table.numberOfSlots - 1;
+    uint64_t slot = getHomeSlot(table, hash);
+    for (uint64_t probes = 0; probes < table.numberOfSlots; ++probes, slot = (slot + 1) & mask) {
+        auto& slotState = table.slotStates[slot];
+        uint64_t state = SlotStatus::Empty;
+        if (slotState.compare_exchange_strong(state, (hash << 2) | SlotStatus::Reserved, std::memory_order_acquire)) {
+            std::copy(keyWords, keyWords + wordsPerKey, table.keys.get() + slot * wordsPerKey);
+            table.values[slot] = value;
+            slotState.store((hash << 2) | SlotStatus::Occupied, std::memory_order_release);
+            return;
+        }
+    }
+    STORM_LOG_THROW(false, storm::exceptions::InternalException, "Hash map is full.");
+}
+
+template<typename ValueType, typename Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::growIfNecessary() {
+    // Once the load factor is exceeded, a resize is started. If the table gets too full before the previous resize is complete, we help with the migration.
+    if (!resizing.load() && numberOfElements.load(std::memory_order_relaxed) <= resizeThreshold.load(std::memory_order_relaxed)) {
+        return;
+    }
+    while (true) {
+        double currentLoad;
+        {
+            OperationGuard guard(*this);
+            currentLoad = static_cast<double>(numberOfElements.load(std::memory_order_relaxed)) / currentTable.load()->numberOfSlots;
+        }
+        if (resizing.load()) {
+            bool const migrated = migrateChunk();
+            if (currentLoad <= maximalLoadFactor) {
+                return;
+            }
+            if (!migrated) {
+                std::this_thread::yield();
+            }
+        } else if (currentLoad > loadFactor) {
+            bool expected = false;
+            if (resizing.compare_exchange_strong(expected, true)) {
+                startResize();
+                migrateChunk();
+                return;
+            }
+        } else {
+            return;
+        }
+    }
+}
+
+template<typename ValueType, typename Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::startResize() {
+    Table* oldTable = currentTable.load();
+    STORM_LOG_TRACE("Increasing size of concurrent hash map from " << oldTable->numberOfSlots << " to " << 2 * oldTable->numberOfSlots << ".");
+    Table* newTable = new Table(oldTable->sizeExponent + 1, wordsPerKey);
+    nextChunkToMigrate.store(0);
+    numberOfMigratedChunks.store(0);
+    previousTableStable.store(false);
+    previousTable.store(oldTable);
+    currentTable.store(newTable);
+    resizeThreshold.store(static_cast<uint64_t>(loadFactor * newTable->numberOfSlots), std::memory_order_relaxed);
+
+    // Operations that started before switching the tables might still insert into the old table. The old table can only be migrated once they are done.
+    waitForOperations(epoch.fetch_add(1));
+    previousTableStable.store(true);
+}
+
+template<typename ValueType, typename Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::migrateChunk() {
+    Table* previous;
+    uint64_t numberOfChunks;
+    {
+        OperationGuard guard(*this);
+        Table* current;
+        if (!loadTables(current, previous) || previous == nullptr) {
+            return false;
+        }
+        numberOfChunks = previous->numberOfChunks();
+        uint64_t const chunk = nextChunkToMigrate.fetch_add(1);
+        if (chunk >= numberOfChunks) {
+            return false;
+        }
+        uint64_t const chunkEnd = std::min<uint64_t>(previous->numberOfSlots, (chunk + 1) * detail::migrationChunkSize);
+        for (uint64_t slot = chunk * detail::migrationChunkSize; slot < chunkEnd; ++slot) {
+            auto& slotState = previous->slotStates[slot];
+            uint64_t const state = slotState.load(std::memory_order_acquire);
+            if ((state & statusMask) == SlotStatus::Occupied) {
+                insertMigratedEntry(*current, previous->keys.get() + slot * wordsPerKey, previous->values[slot], state >> 2);
+                slotState.store((state & ~statusMask) | SlotStatus::Migrated, std::memory_order_release);
+            }
+        }
+    }
+
+    if (numberOfMigratedChunks.fetch_add(1) + 1 == numberOfChunks) {
+        // All entries are migrated. The old table can be deleted once no operation accesses it anymore.
+        previousTable.store(nullptr);
+        waitForOperations(epoch.fetch_add(1));
+        delete previous;
+        resizing.store(false);
+    }
+    return true;
+}
+
+template<typename ValueType, typename Hash>
+void ConcurrentBitVectorHashMap<ValueType, Hash>::waitForOperations(uint64_t epoch) const {
+    for (auto const& counter : runningOperations[epoch & 1]) {
+        while (counter.value.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+template<typename ValueType, typename Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::computeHash(storm::storage::BitVector const& key) const {
+    return static_cast<uint64_t>(hasher(key)) & detail::hashMask;
+}
+
+template<typename ValueType, typename Hash>
+uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getHomeSlot(Table const& table, uint64_t hash) const {
+    // Fibonacci hashing spreads the hash values over the slots, even if only the lower bits of the hash are well-distributed.
+    return (hash * 0x9E3779B97F4A7C15ull) >> (64 - table.sizeExponent);
+}
+
+template<typename ValueType, typename Hash>
+bool ConcurrentBitVectorHashMap<ValueType, Hash>::keyEquals(Table const& table, uint64_t slot, storm::storage::BitVector const& key) const {
+    uint64_t const* keyWords = table.keys.get() + slot * wordsPerKey;
+    for (uint64_t word = 0; word < wordsPerKey; ++word) {
+        if (keyWords[word] != key.getBucket(word)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template class ConcurrentBitVectorHashMap<uint64_t>;
+template class ConcurrentBitVectorHashMap<uint32_t>;
+
+}  // namespace storm::storage
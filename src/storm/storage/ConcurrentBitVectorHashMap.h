@@ -0,0 +1,205 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm::storage {
+
+/*!
+ * A hash map whose keys are bit vectors that supports concurrent queries and insertions. As for BitVectorHashMap, the keys must be bit vectors with a
+ * length that is a multiple of 64 and entries can not be removed.
+ *
+ * The keys are stored packed into a contiguous array and are found via lock-free open addressing (linear probing), where each slot has an atomic state
+ * word that also holds a fingerprint of the hash value of the key. When the load factor is exceeded, a table of twice the size is installed and the
+ * entries of the old table are migrated incrementally (chunk-wise) by the subsequent insertions. This avoids a long pause for rehashing all keys at once.
+ */
+template<typename ValueType, typename Hash = Murmur3BitVectorHash<uint64_t>>
+class ConcurrentBitVectorHashMap {
+    struct Table;
+
+   public:
+    class ConcurrentBitVectorHashMapIterator {
+       public:
+        /*!
+         * Creates an iterator that points to the given slot of the given table of the map.
+         *
+         * @param map The map of the iterator.
+         * @param tableIndex The index of the table (0 for the table that is currently migrated and 1 for the current table).
+         * @param slot The slot the iterator points to.
+         */
+        ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, uint64_t tableIndex, uint64_t slot);
+
+        // Methods to compare two iterators.
+        bool operator==(ConcurrentBitVectorHashMapIterator const& other) const;
+        bool operator!=(ConcurrentBitVectorHashMapIterator const& other) const;
+
+        // Methods to move iterator forward.
+        ConcurrentBitVectorHashMapIterator& operator++();
+
+        // Method to retrieve the currently pointed-to bit vector and its mapped-to value.
+        std::pair<storm::storage::BitVector, ValueType> operator*() const;
+
+       private:
+        // Moves the iterator to the next occupied slot (including the current one).
+        void skipUnoccupiedSlots();
+
+        ConcurrentBitVectorHashMap const& map;
+        uint64_t tableIndex;
+        uint64_t slot;
+    };
+
+    typedef ConcurrentBitVectorHashMapIterator const_iterator;
+
+    /*!
+     * Creates a new hash map with the given bucket size and initial size.
+     *
+     * @param bucketSize The size of the keys that this map can hold. This value must be a multiple of 64.
+     * @param initialSize The number of keys for which storage is initially available.
+     * @param loadFactor The load factor that determines at which point the size of the underlying storage is increased.
+     */
+    ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize = 1000, double loadFactor = 0.75);
+
+    ~ConcurrentBitVectorHashMap();
+
+    ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const&) = delete;
+    ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const&) = delete;
+
+    /*!
+     * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the key is inserted with the given value.
+     * If the same key is inserted concurrently, all callers obtain the same value.
+     *
+     * @param key The key to search or insert.
+     * @param value The value that is inserted if the key is not already found in the map.
+     * @return The found value if the key is already contained in the map and the provided new value otherwise.
+     */
+    ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+    /*!
+     * Searches for the given key in the map. If it is not found, the key is inserted with the value obtained from the given function. The function is
+     * invoked at most once and only if the key is actually inserted by this call. Concurrent queries for the same key wait until the value is available.
+     *
+     * @param key The key to search or insert.
+     * @param createValue A function that yields the value of the key in case it is inserted.
+     * @return The value of the key and a flag that indicates whether the key was inserted by this call.
+     */
+    std::pair<ValueType, bool> findOrCreate(storm::storage::BitVector const& key, std::function<ValueType()> const& createValue);
+
+    /*!
+     * Retrieves the value associated with the given key (if any).
+     */
+    std::optional<ValueType> find(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the value associated with the given key. The key must be contained in the map.
+     */
+    ValueType getValue(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Checks if the given key is already contained in the map.
+     */
+    bool contains(storm::storage::BitVector const& key) const;
+
+    /*!
+     * Retrieves the number of elements in the map.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves the number of slots of the (current) underlying table.
+     */
+    uint64_t capacity() const;
+
+    /*!
+     * Retrieves an iterator to the elements of the map. Iterating must not happen concurrently with insertions.
+     */
+    const_iterator begin() const;
+    const_iterator end() const;
+
+   private:
+    // The status that is stored in the lower bits of the state word of each slot. The remaining bits hold a fingerprint of the hash of the key.
+    enum SlotStatus : uint64_t { Empty = 0, Reserved = 1, Occupied = 2, Migrated = 3 };
+    static const uint64_t statusMask = 3;
+
+    // Counts the operations that are currently executed on the map, distributed over multiple cache lines to reduce contention.
+    struct alignas(64) OperationCounter {
+        std::atomic<uint64_t> value{0};
+    };
+    static const uint64_t numberOfOperationCounters = 32;
+
+    // Registers an operation in the current epoch, which prevents that tables that are visible to the operation are deleted.
+    class OperationGuard {
+       public:
+        explicit OperationGuard(ConcurrentBitVectorHashMap const& map);
+        ~OperationGuard();
+        void release();
+
+       private:
+        std::atomic<uint64_t>* counter;
+    };
+
+    std::pair<ValueType, bool> findOrCreateImpl(storm::storage::BitVector const& key, ValueType const* value, std::function<ValueType()> const* createValue);
+
+    // Searches the key in the given table. A slot that is being filled with a possibly matching key is waited for.
+    std::optional<ValueType> findInTable(Table const& table, storm::storage::BitVector const& key, uint64_t hash) const;
+
+    // Loads the current table and the table that is currently migrated (if any) consistently.
+    // Returns false if insertions into the table that is migrated might still be pending. The caller then has to retry later.
+    bool loadTables(Table*& current, Table*& previous) const;
+
+    // Inserts a key that is known not to be contained in the table.
+    void insertMigratedEntry(Table& table, uint64_t const* keyWords, ValueType const& value, uint64_t hash);
+
+    // Triggers a resize or helps migrating the entries of the previous table. Must not be called while an operation is registered.
+    void growIfNecessary();
+    void startResize();
+    bool migrateChunk();
+
+    // Waits until all operations that were started in the given epoch are finished.
+    void waitForOperations(uint64_t epoch) const;
+
+    uint64_t computeHash(storm::storage::BitVector const& key) const;
+    uint64_t getHomeSlot(Table const& table, uint64_t hash) const;
+    bool keyEquals(Table const& table, uint64_t slot, storm::storage::BitVector const& key) const;
+
+    // The size of the keys (in bits and in 64-bit words).
+    uint64_t bucketSize;
+    uint64_t wordsPerKey;
+
+    // The load factor that triggers a resize and the load factor up to which insertions are possible while a resize is in progress.
+    double loadFactor;
+    double maximalLoadFactor;
+
+    // The table into which new keys are inserted and the table whose entries are currently migrated into the current table (if any).
+    std::atomic<Table*> currentTable;
+    std::atomic<Table*> previousTable;
+
+    // Set once all insertions into the previous table have finished, i.e., once the previous table is no longer modified (except for migration marks).
+    std::atomic<bool> previousTableStable;
+
+    // Set while a resize (including the migration and the deletion of the old table) is in progress.
+    std::atomic<bool> resizing;
+
+    // The next chunk of the previous table to migrate and the number of migrated chunks.
+    std::atomic<uint64_t> nextChunkToMigrate;
+    std::atomic<uint64_t> numberOfMigratedChunks;
+
+    std::atomic<uint64_t> numberOfElements;
+
+    // The number of elements above which the current table is resized.
+    std::atomic<uint64_t> resizeThreshold;
+
+    // The current epoch and the number of running operations for even and odd epochs, respectively.
+    mutable std::atomic<uint64_t> epoch;
+    mutable std::array<std::array<OperationCounter, numberOfOperationCounters>, 2> runningOperations;
+
+    Hash hasher;
+};
+
+}  // namespace storm::storage
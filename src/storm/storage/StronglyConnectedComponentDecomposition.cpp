@@ -1,9 +1,17 @@
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <span>
+
 #include "storm/adapters/IntervalAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/NumberTraits.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/vector.h"
@@ -40,6 +48,11 @@ StronglyConnectedComponentDecompositionOptions& StronglyConnectedComponentDecomp
     return *this;
 }
 
+StronglyConnectedComponentDecompositionOptions& StronglyConnectedComponentDecompositionOptions::numberOfThreads(uint64_t value) {
+    threadCount = value;
+    return *this;
+}
+
 void SccDecompositionMemoryCache::initialize(uint64_t numStates) {
     preorderNumbers.assign(numStates, std::numeric_limits<uint64_t>::max());
     recursionStateStack.clear();
@@ -223,6 +236,353 @@ void performSccDecompositionGCM(storm::storage::SparseMatrix<ValueType> const& t
     }
 }
 
+namespace detail {
+
+/*!
+ * Invokes the given callback for each successor of the given state that is contained in the considered subsystem.
+ */
+template<typename ValueType, typename CallbackType>
+void forEachSuccessorInSubsystem(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::OptionalRef<storm::storage::BitVector const> subsystem,
+                                 storm::OptionalRef<storm::storage::BitVector const> choices, uint64_t state, CallbackType&& callback) {
+    for (uint64_t row = transitionMatrix.getRowGroupIndices()[state], rowEnd = transitionMatrix.getRowGroupIndices()[state + 1]; row != rowEnd; ++row) {
+        if (choices && !choices->get(row)) {
+            continue;
+        }
+        for (auto const& successor : transitionMatrix.getRow(row)) {
+            if ((!subsystem || subsystem->get(successor.getColumn())) && successor.getValue() != storm::utility::zero<ValueType>()) {
+                callback(successor.getColumn());
+            }
+        }
+    }
+}
+
+/*!
+ * Splits [0, numberOfStates) into ranges and invokes callback(begin, end) for each range in parallel.
+ * Range boundaries are multiples of 64 so that each bucket of a bit vector over the states is only written by a single thread.
+ */
+void parallelForStateRanges(storm::utility::ThreadPool& threadPool, uint64_t numberOfStates, std::function<void(uint64_t, uint64_t)> const& callback) {
+    uint64_t const rangeSize = 1ull << 12;
+    threadPool.parallelFor((numberOfStates + rangeSize - 1) / rangeSize, [&numberOfStates, &callback](uint64_t rangeIndex, uint64_t) {
+        uint64_t const begin = rangeIndex * rangeSize;
+        callback(begin, std::min(begin + rangeSize, numberOfStates));
+    });
+}
+
+/*!
+ * Processes the current frontier (cache.frontier) in parallel. The callback is invoked as callback(item, nextFrontier), where items that are
+ * inserted into nextFrontier make up the frontier afterwards.
+ */
+void processFrontier(storm::utility::ThreadPool& threadPool, SccDecompositionMemoryCache& cache,
+                     std::function<void(uint64_t, std::vector<uint64_t>&)> const& callback) {
+    uint64_t const chunkSize = 1ull << 10;
+    cache.workerFrontiers.resize(threadPool.getNumberOfWorkers());
+    for (auto& workerFrontier : cache.workerFrontiers) {
+        workerFrontier.clear();
+    }
+    threadPool.parallelFor((cache.frontier.size() + chunkSize - 1) / chunkSize, [&cache, &callback](uint64_t chunkIndex, uint64_t workerIndex) {
+        auto& nextFrontier = cache.workerFrontiers[workerIndex];
+        for (uint64_t i = chunkIndex * chunkSize, end = std::min<uint64_t>(i + chunkSize, cache.frontier.size()); i < end; ++i) {
+            callback(cache.frontier[i], nextFrontier);
+        }
+    });
+    cache.frontier.clear();
+    for (auto const& workerFrontier : cache.workerFrontiers) {
+        cache.frontier.insert(cache.frontier.end(), workerFrontier.begin(), workerFrontier.end());
+    }
+}
+
+}  // namespace detail
+
+/*!
+ * Computes a mapping of states to their SCCs using multiple threads. The algorithm proceeds in the following steps (cf. the Multistep approach by
+ * Slota et al.):
+ *  1. Trivial SCCs are removed by iteratively trimming states without predecessors or successors among the remaining states.
+ *  2. A single forward-backward search is started from a pivot with a high degree. This typically identifies large SCCs.
+ *  3. The remaining states (which are a union of SCCs) are handled by the sequential algorithm of Gabow/Cheriyan/Mehlhorn.
+ *  4. SCC indices are assigned deterministically. If a topological sort or SCC depths are requested, the SCCs are sorted according to their depth.
+ *
+ * @param transitionMatrix The transition matrix of the system to decompose.
+ * @param options options for the decomposition
+ * @param threadPool The threads that are used.
+ * @param result The resulting information will be stored into this struct. Assumed to be initialized.
+ * @param cache memory used by the algorithm. Assumed to be initialized.
+ */
+template<typename ValueType>
+void performSccDecompositionParallel(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                     StronglyConnectedComponentDecompositionOptions const& options, storm::utility::ThreadPool& threadPool,
+                                     SccDecompositionResult& result, SccDecompositionMemoryCache& cache) {
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+    uint64_t const noScc = std::numeric_limits<uint64_t>::max();
+    auto const& subsystem = options.optSubsystem;
+    auto isInSubsystem = [&subsystem](uint64_t state) { return !subsystem || subsystem->get(state); };
+    auto& stateToScc = result.stateToSccMapping;
+    // Make sure that the row group indices are not created lazily by one of the workers.
+    transitionMatrix.getRowGroupIndices();
+    // The depths are computed at the very end. We prevent the sequential algorithm from computing (wrong) depths.
+    std::optional<std::vector<uint64_t>> sccDepths;
+    sccDepths.swap(result.sccDepths);
+
+    // Intermediately, SCCs obtained from steps 1 and 2 are labeled with the index of one of their states.
+    // SCCs obtained from step 3 are labeled with numberOfStates + i, where i is the index assigned by the sequential algorithm.
+    auto tryAssignLabel = [&stateToScc, &noScc](uint64_t state, uint64_t label) {
+        uint64_t expected = noScc;
+        return std::atomic_ref<uint64_t>(stateToScc[state]).compare_exchange_strong(expected, label, std::memory_order_relaxed);
+    };
+
+    // Compute the predecessors of each state (ignoring selfloops) as well as the in- and out-degrees.
+    cache.outDegrees.assign(numberOfStates, 0);
+    cache.predecessorIndications.assign(numberOfStates + 1, 0);
+    detail::parallelForStateRanges(threadPool, numberOfStates, [&](uint64_t begin, uint64_t end) {
+        for (uint64_t state = begin; state < end; ++state) {
+            if (isInSubsystem(state)) {
+                detail::forEachSuccessorInSubsystem(transitionMatrix, subsystem, options.optChoices, state, [&](uint64_t successor) {
+                    if (successor == state) {
+                        result.nonTrivialStates.set(state, true);
+                    } else {
+                        ++cache.outDegrees[state];
+                        std::atomic_ref<uint64_t>(cache.predecessorIndications[successor + 1]).fetch_add(1, std::memory_order_relaxed);
+                    }
+                });
+            }
+        }
+    });
+    cache.inDegrees.assign(cache.predecessorIndications.begin() + 1, cache.predecessorIndications.end());
+    std::partial_sum(cache.predecessorIndications.begin(), cache.predecessorIndications.end(), cache.predecessorIndications.begin());
+    cache.predecessors.resize(cache.predecessorIndications.back());
+    cache.positions.assign(cache.predecessorIndications.begin(), cache.predecessorIndications.end() - 1);
+    detail::parallelForStateRanges(threadPool, numberOfStates, [&](uint64_t begin, uint64_t end) {
+        for (uint64_t state = begin; state < end; ++state) {
+            if (isInSubsystem(state)) {
+                detail::forEachSuccessorInSubsystem(transitionMatrix, subsystem, options.optChoices, state, [&](uint64_t successor) {
+                    if (successor != state) {
+                        cache.predecessors[std::atomic_ref<uint64_t>(cache.positions[successor]).fetch_add(1, std::memory_order_relaxed)] = state;
+                    }
+                });
+            }
+        }
+    });
+    auto getPredecessors = [&cache](uint64_t state) {
+        return std::span<uint64_t const>(cache.predecessors).subspan(cache.predecessorIndications[state],
+                                                                     cache.predecessorIndications[state + 1] - cache.predecessorIndications[state]);
+    };
+
+    // Step 1: Trimming. A state without (remaining) predecessors or successors forms a singleton SCC.
+    cache.frontier.clear();
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (isInSubsystem(state) && (cache.inDegrees[state] == 0 || cache.outDegrees[state] == 0)) {
+            stateToScc[state] = state;
+            cache.frontier.push_back(state);
+        }
+    }
+    while (!cache.frontier.empty()) {
+        detail::processFrontier(threadPool, cache, [&](uint64_t state, std::vector<uint64_t>& nextFrontier) {
+            detail::forEachSuccessorInSubsystem(transitionMatrix, subsystem, options.optChoices, state, [&](uint64_t successor) {
+                if (successor != state && std::atomic_ref<uint64_t>(cache.inDegrees[successor]).fetch_sub(1, std::memory_order_relaxed) == 1 &&
+                    tryAssignLabel(successor, successor)) {
+                    nextFrontier.push_back(successor);
+                }
+            });
+            for (auto const predecessor : getPredecessors(state)) {
+                if (std::atomic_ref<uint64_t>(cache.outDegrees[predecessor]).fetch_sub(1, std::memory_order_relaxed) == 1 &&
+                    tryAssignLabel(predecessor, predecessor)) {
+                    nextFrontier.push_back(predecessor);
+                }
+            }
+        });
+    }
+
+    // Step 2: Forward-backward search from the remaining state with the largest product of (remaining) in- and out-degree.
+    // Ties are broken by the state index to make the choice deterministic.
+    uint64_t pivot = noScc;
+    uint64_t pivotDegreeProduct = 0;
+    std::mutex pivotMutex;
+    auto updatePivot = [&pivot, &pivotDegreeProduct, &noScc](uint64_t state, uint64_t degreeProduct) {
+        if (pivot == noScc || degreeProduct > pivotDegreeProduct || (degreeProduct == pivotDegreeProduct && state < pivot)) {
+            pivot = state;
+            pivotDegreeProduct = degreeProduct;
+        }
+    };
+    detail::parallelForStateRanges(threadPool, numberOfStates, [&](uint64_t begin, uint64_t end) {
+        uint64_t rangePivot = noScc;
+        uint64_t rangePivotDegreeProduct = 0;
+        for (uint64_t state = begin; state < end; ++state) {
+            if (isInSubsystem(state) && stateToScc[state] == noScc) {
+                uint64_t const degreeProduct = cache.inDegrees[state] * cache.outDegrees[state];
+                if (rangePivot == noScc || degreeProduct > rangePivotDegreeProduct) {
+                    rangePivot = state;
+                    rangePivotDegreeProduct = degreeProduct;
+                }
+            }
+        }
+        if (rangePivot != noScc) {
+            std::lock_guard<std::mutex> lock(pivotMutex);
+            updatePivot(rangePivot, rangePivotDegreeProduct);
+        }
+    });
+    if (pivot != noScc) {
+        uint8_t const forwardFlag = 1, backwardFlag = 2;
+        cache.reachabilityFlags.assign(numberOfStates, 0);
+        cache.reachabilityFlags[pivot] = forwardFlag | backwardFlag;
+        // Forward search within the remaining states.
+        cache.frontier.assign(1, pivot);
+        while (!cache.frontier.empty()) {
+            detail::processFrontier(threadPool, cache, [&](uint64_t state, std::vector<uint64_t>& nextFrontier) {
+                detail::forEachSuccessorInSubsystem(transitionMatrix, subsystem, options.optChoices, state, [&](uint64_t successor) {
+                    if (stateToScc[successor] == noScc &&
+                        (std::atomic_ref<uint8_t>(cache.reachabilityFlags[successor]).fetch_or(forwardFlag, std::memory_order_relaxed) & forwardFlag) == 0) {
+                        nextFrontier.push_back(successor);
+                    }
+                });
+            });
+        }
+        // Backward search. It suffices to consider states that are forward reachable.
+        cache.frontier.assign(1, pivot);
+        while (!cache.frontier.empty()) {
+            detail::processFrontier(threadPool, cache, [&](uint64_t state, std::vector<uint64_t>& nextFrontier) {
+                for (auto const predecessor : getPredecessors(state)) {
+                    std::atomic_ref<uint8_t> flags(cache.reachabilityFlags[predecessor]);
+                    if ((flags.load(std::memory_order_relaxed) & forwardFlag) != 0 &&
+                        (flags.fetch_or(backwardFlag, std::memory_order_relaxed) & backwardFlag) == 0) {
+                        nextFrontier.push_back(predecessor);
+                    }
+                }
+            });
+        }
+        // States that are forward and backward reachable form the SCC of the pivot.
+        std::atomic<uint64_t> pivotSccSize = 0;
+        detail::parallelForStateRanges(threadPool, numberOfStates, [&](uint64_t begin, uint64_t end) {
+            uint64_t rangeSccSize = 0;
+            for (uint64_t state = begin; state < end; ++state) {
+                if (cache.reachabilityFlags[state] == (forwardFlag | backwardFlag)) {
+                    stateToScc[state] = pivot;
+                    ++rangeSccSize;
+                }
+            }
+            pivotSccSize.fetch_add(rangeSccSize, std::memory_order_relaxed);
+        });
+        if (pivotSccSize.load() > 1) {
+            detail::parallelForStateRanges(threadPool, numberOfStates, [&](uint64_t begin, uint64_t end) {
+                for (uint64_t state = begin; state < end; ++state) {
+                    if (stateToScc[state] == pivot) {
+                        result.nonTrivialStates.set(state, true);
+                    }
+                }
+            });
+        }
+    }
+
+    // Step 3: The remaining states are a union of SCCs that we decompose sequentially.
+    storm::storage::BitVector remainingStates(numberOfStates, false);
+    detail::parallelForStateRanges(threadPool, numberOfStates, [&](uint64_t begin, uint64_t end) {
+        for (uint64_t state = begin; state < end; ++state) {
+            if (isInSubsystem(state) && stateToScc[state] == noScc) {
+                remainingStates.set(state, true);
+            }
+        }
+    });
+    result.sccCount = numberOfStates;
+    uint64_t currentIndex = 0;
+    for (auto state : remainingStates) {
+        if (!cache.hasPreorderNumber(state)) {
+            performSccDecompositionGCM(transitionMatrix, storm::OptionalRef<storm::storage::BitVector const>(remainingStates), options.optChoices,
+                                       options.isTopologicalSortForced, state, currentIndex, result, cache);
+        }
+    }
+
+    // Step 4: Assign SCC indices in the order in which the SCCs are first encountered. The out-degrees are not needed anymore, so we reuse the memory.
+    auto& labelToScc = cache.outDegrees;
+    labelToScc.assign(result.sccCount, noScc);
+    result.sccCount = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (auto const label = stateToScc[state]; label != noScc && labelToScc[label] == noScc) {
+            labelToScc[label] = result.sccCount++;
+        }
+    }
+    detail::parallelForStateRanges(threadPool, numberOfStates, [&](uint64_t begin, uint64_t end) {
+        for (uint64_t state = begin; state < end; ++state) {
+            if (stateToScc[state] != noScc) {
+                stateToScc[state] = labelToScc[stateToScc[state]];
+            }
+        }
+    });
+
+    if (!sccDepths && !options.isTopologicalSortForced) {
+        return;
+    }
+
+    // Gather the states of each SCC.
+    cache.sccStateIndications.assign(result.sccCount + 1, 0);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (stateToScc[state] != noScc) {
+            ++cache.sccStateIndications[stateToScc[state] + 1];
+        }
+    }
+    std::partial_sum(cache.sccStateIndications.begin(), cache.sccStateIndications.end(), cache.sccStateIndications.begin());
+    cache.sccStates.resize(cache.sccStateIndications.back());
+    cache.positions.assign(cache.sccStateIndications.begin(), cache.sccStateIndications.end() - 1);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        if (stateToScc[state] != noScc) {
+            cache.sccStates[cache.positions[stateToScc[state]]++] = state;
+        }
+    }
+
+    // Count the transitions that leave each SCC. The in-degrees are not needed anymore, so we reuse the memory.
+    auto& sccOutDegrees = cache.inDegrees;
+    sccOutDegrees.assign(result.sccCount, 0);
+    detail::parallelForStateRanges(threadPool, numberOfStates, [&](uint64_t begin, uint64_t end) {
+        for (uint64_t state = begin; state < end; ++state) {
+            for (auto const predecessor : getPredecessors(state)) {
+                if (stateToScc[predecessor] != stateToScc[state]) {
+                    std::atomic_ref<uint64_t>(sccOutDegrees[stateToScc[predecessor]]).fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+    });
+
+    // Process the SCCs level by level, starting with the bottom SCCs. An SCC is in the next level once all its successor SCCs have been processed.
+    // Hence, the level of each SCC coincides with its depth. Within a level, SCCs are ordered by their (previous) index.
+    auto& newSccIndices = cache.outDegrees;
+    newSccIndices.assign(result.sccCount, noScc);
+    if (sccDepths) {
+        sccDepths->reserve(result.sccCount);
+    }
+    cache.frontier.clear();
+    for (uint64_t scc = 0; scc < result.sccCount; ++scc) {
+        if (sccOutDegrees[scc] == 0) {
+            cache.frontier.push_back(scc);
+        }
+    }
+    uint64_t newSccIndex = 0;
+    for (uint64_t depth = 0; !cache.frontier.empty(); ++depth) {
+        std::sort(cache.frontier.begin(), cache.frontier.end());
+        for (auto const scc : cache.frontier) {
+            newSccIndices[scc] = newSccIndex++;
+            if (sccDepths) {
+                sccDepths->push_back(depth);
+            }
+        }
+        detail::processFrontier(threadPool, cache, [&](uint64_t scc, std::vector<uint64_t>& nextFrontier) {
+            for (uint64_t i = cache.sccStateIndications[scc]; i < cache.sccStateIndications[scc + 1]; ++i) {
+                for (auto const predecessor : getPredecessors(cache.sccStates[i])) {
+                    auto const predecessorScc = stateToScc[predecessor];
+                    if (predecessorScc != scc && std::atomic_ref<uint64_t>(sccOutDegrees[predecessorScc]).fetch_sub(1, std::memory_order_relaxed) == 1) {
+                        nextFrontier.push_back(predecessorScc);
+                    }
+                }
+            }
+        });
+    }
+    STORM_LOG_ASSERT(newSccIndex == result.sccCount, "Unexpected number of processed SCCs.");
+    detail::parallelForStateRanges(threadPool, numberOfStates, [&](uint64_t begin, uint64_t end) {
+        for (uint64_t state = begin; state < end; ++state) {
+            if (stateToScc[state] != noScc) {
+                stateToScc[state] = newSccIndices[stateToScc[state]];
+            }
+        }
+    });
+    sccDepths.swap(result.sccDepths);
+}
+
 template<typename ValueType>
 void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  StronglyConnectedComponentDecompositionOptions const& options) {
@@ -284,6 +644,15 @@ void performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& tran
     result.initialize(numberOfStates, options.isComputeSccDepthsSet || options.areOnlyBottomSccsConsidered);
     cache.initialize(numberOfStates);
 
+    // Exact and parametric arithmetic is not safe to be used concurrently, so such matrices are always decomposed sequentially.
+    if (!storm::NumberTraits<ValueType>::IsExact && options.threadCount != 1) {
+        auto threadPool = storm::utility::ThreadPool::getShared(options.threadCount);
+        if (threadPool->getNumberOfWorkers() > 1) {
+            performSccDecompositionParallel(transitionMatrix, options, *threadPool, result, cache);
+            return;
+        }
+    }
+
     // Start the search for SCCs from every state in the block.
     uint64_t currentIndex = 0;
     auto performSccDecompFromState = [&](uint64_t startState) {
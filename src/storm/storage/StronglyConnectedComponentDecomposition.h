@@ -33,12 +33,18 @@ struct StronglyConnectedComponentDecompositionOptions {
     /// Sets if scc depths can be retrieved.
     StronglyConnectedComponentDecompositionOptions& computeSccDepths(bool value = true);
 
+    /// Sets the number of threads used for the decomposition (0 means auto-detect). With more than one thread, a parallel algorithm is used.
+    /// The resulting SCCs are the same, but they might be indexed differently.
+    /// Matrices with exact or parametric values are always decomposed sequentially.
+    StronglyConnectedComponentDecompositionOptions& numberOfThreads(uint64_t value);
+
     storm::OptionalRef<storm::storage::BitVector const> optSubsystem;
     storm::OptionalRef<storm::storage::BitVector const> optChoices;
     bool areNaiveSccsDropped = false;
     bool areOnlyBottomSccsConsidered = false;
     bool isTopologicalSortForced = false;
     bool isComputeSccDepthsSet = false;
+    uint64_t threadCount = 1;
 };
 
 /*!
@@ -50,6 +56,11 @@ struct SccDecompositionMemoryCache {
     void initialize(uint64_t numStates);
     bool hasPreorderNumber(uint64_t stateIndex) const;
     std::vector<uint64_t> preorderNumbers, recursionStateStack, s, p;
+
+    // Additional memory that is only used by the parallel algorithm.
+    std::vector<uint64_t> predecessorIndications, predecessors, inDegrees, outDegrees, positions, frontier, sccStateIndications, sccStates;
+    std::vector<std::vector<uint64_t>> workerFrontiers;
+    std::vector<uint8_t> reachabilityFlags;
 };
 
 /*!
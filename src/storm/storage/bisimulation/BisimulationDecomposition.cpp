@@ -1,6 +1,7 @@
 #include "storm/storage/bisimulation/BisimulationDecomposition.h"
 
 #include <chrono>
+#include <numeric>
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/AbortException.h"
@@ -16,7 +17,9 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -53,6 +56,8 @@ BisimulationDecomposition<ModelType, BlockDataType>::Options::Options()
       psiStates(),
       respectedAtomicPropositions(),
       buildQuotient(true),
+      signatureRefinement(false),
+      numberOfThreads(1),
       keepRewards(false),
       type(BisimulationType::Strong),
       bounded(false),
@@ -260,6 +265,14 @@ void BisimulationDecomposition<ModelType, BlockDataType>::computeBisimulationDec
 
 template<typename ModelType, typename BlockDataType>
 void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefinement() {
+    if (options.signatureRefinement) {
+        if (options.getType() == BisimulationType::Strong) {
+            performSignatureBasedPartitionRefinement();
+            return;
+        }
+        STORM_LOG_WARN("Signature-based refinement is only available for strong bisimulation. Falling back to splitter-based refinement.");
+    }
+
     // Insert all blocks into the splitter queue as a (potential) splitter.
     std::vector<Block<BlockDataType>*> splitterQueue;
     std::for_each(partition.getBlocks().begin(), partition.getBlocks().end(), [&](std::unique_ptr<Block<BlockDataType>> const& block) {
@@ -292,6 +305,220 @@ void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefine
     }
 }
 
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureBasedPartitionRefinement() {
+    auto const& transitionMatrix = model.getTransitionMatrix();
+    auto const& rowIndications = transitionMatrix.getRowIndices();
+    // The row grouping of deterministic models is created lazily, so we need to retrieve it before accessing it concurrently.
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    bool const nondeterministic = model.isNondeterministicModel();
+
+    // For nondeterministic models, the action rewards need to be respected by the signatures of the choices. For deterministic models, they are
+    // already respected by the initial partition.
+    std::vector<ValueType> const* choiceRewards = nullptr;
+    if (nondeterministic && options.getKeepRewards() && model.hasRewardModel() && model.getUniqueRewardModel().hasStateActionRewards()) {
+        choiceRewards = &model.getUniqueRewardModel().getStateActionRewardVector();
+    }
+
+    // The signature of a choice is a list of (block id, probability) pairs that is sorted by the block ids. It is stored in the range of the
+    // corresponding row of the transition matrix, so that the signatures of different states can be computed concurrently.
+    std::vector<std::pair<uint_fast64_t, ValueType>> signatureEntries(transitionMatrix.getEntryCount());
+    std::vector<uint_fast64_t> signatureSizes(transitionMatrix.getRowCount());
+
+    // For nondeterministic models, the signature of a state is the ordered list of distinct signatures of its choices.
+    std::vector<uint_fast64_t> orderedChoices(nondeterministic ? transitionMatrix.getRowCount() : 0);
+    std::vector<uint_fast64_t> numberOfDistinctChoices(nondeterministic ? model.getNumberOfStates() : 0);
+
+    // Returns a negative (positive) value if the signature of the first choice is smaller (larger) than the one of the second choice and zero
+    // if they are considered equal.
+    auto compareChoiceSignatures = [&](uint_fast64_t choice1, uint_fast64_t choice2) {
+        auto entryIt1 = signatureEntries.cbegin() + rowIndications[choice1];
+        auto entryIt2 = signatureEntries.cbegin() + rowIndications[choice2];
+        for (auto entryIte1 = entryIt1 + std::min(signatureSizes[choice1], signatureSizes[choice2]); entryIt1 != entryIte1; ++entryIt1, ++entryIt2) {
+            if (entryIt1->first != entryIt2->first) {
+                return entryIt1->first < entryIt2->first ? -1 : 1;
+            }
+            if (comparator.isLess(entryIt1->second, entryIt2->second)) {
+                return -1;
+            } else if (comparator.isLess(entryIt2->second, entryIt1->second)) {
+                return 1;
+            }
+        }
+        if (signatureSizes[choice1] != signatureSizes[choice2]) {
+            return signatureSizes[choice1] < signatureSizes[choice2] ? -1 : 1;
+        }
+        if (choiceRewards) {
+            if (comparator.isLess((*choiceRewards)[choice1], (*choiceRewards)[choice2])) {
+                return -1;
+            } else if (comparator.isLess((*choiceRewards)[choice2], (*choiceRewards)[choice1])) {
+                return 1;
+            }
+        }
+        return 0;
+    };
+
+    auto stateSignatureLess = [&](storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+        if (!nondeterministic) {
+            return compareChoiceSignatures(state1, state2) < 0;
+        }
+        auto choiceIt1 = orderedChoices.cbegin() + rowGroupIndices[state1];
+        auto choiceIt2 = orderedChoices.cbegin() + rowGroupIndices[state2];
+        for (auto choiceIte1 = choiceIt1 + std::min(numberOfDistinctChoices[state1], numberOfDistinctChoices[state2]); choiceIt1 != choiceIte1;
+             ++choiceIt1, ++choiceIt2) {
+            int comparison = compareChoiceSignatures(*choiceIt1, *choiceIt2);
+            if (comparison != 0) {
+                return comparison < 0;
+            }
+        }
+        return numberOfDistinctChoices[state1] < numberOfDistinctChoices[state2];
+    };
+
+    // Computes the signature of the given state wrt. the current partition. This only writes to data associated with the given state.
+    auto computeSignature = [&](storm::storage::sparse::state_type state) {
+        for (uint_fast64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+            auto signatureBegin = signatureEntries.begin() + rowIndications[choice];
+            auto signatureEnd = signatureBegin;
+            for (auto const& entry : transitionMatrix.getRow(choice)) {
+                if (!comparator.isZero(entry.getValue())) {
+                    signatureEnd->first = partition.getBlock(entry.getColumn()).getId();
+                    signatureEnd->second = entry.getValue();
+                    ++signatureEnd;
+                }
+            }
+            std::sort(signatureBegin, signatureEnd, [](auto const& entry1, auto const& entry2) { return entry1.first < entry2.first; });
+
+            // Sum up the probabilities of entries leading to the same block.
+            auto mergedEnd = signatureBegin;
+            for (auto entryIt = signatureBegin; entryIt != signatureEnd; ++entryIt) {
+                if (mergedEnd != signatureBegin && std::prev(mergedEnd)->first == entryIt->first) {
+                    std::prev(mergedEnd)->second += entryIt->second;
+                } else {
+                    if (mergedEnd != entryIt) {
+                        *mergedEnd = std::move(*entryIt);
+                    }
+                    ++mergedEnd;
+                }
+            }
+            signatureSizes[choice] = std::distance(signatureBegin, mergedEnd);
+        }
+
+        if (nondeterministic) {
+            auto choicesBegin = orderedChoices.begin() + rowGroupIndices[state];
+            auto choicesEnd = orderedChoices.begin() + rowGroupIndices[state + 1];
+            std::iota(choicesBegin, choicesEnd, rowGroupIndices[state]);
+            std::sort(choicesBegin, choicesEnd, [&](uint_fast64_t choice1, uint_fast64_t choice2) { return compareChoiceSignatures(choice1, choice2) < 0; });
+            auto distinctChoicesEnd = std::unique(choicesBegin, choicesEnd,
+                                                  [&](uint_fast64_t choice1, uint_fast64_t choice2) { return compareChoiceSignatures(choice1, choice2) == 0; });
+            numberOfDistinctChoices[state] = std::distance(choicesBegin, distinctChoicesEnd);
+        }
+    };
+
+    auto possiblyNeedsRefinement = [](Block<BlockDataType> const& block) { return block.getNumberOfStates() > 1 && !block.data().absorbing(); };
+
+    // Arithmetic on exact (and in particular parametric) values is not thread-safe, so we only use multiple threads for floating point values.
+    auto threadPool = storm::utility::ThreadPool::getShared(storm::NumberTraits<ValueType>::IsExact ? 1 : options.numberOfThreads);
+
+    // Initially, all blocks need to be refined.
+    std::vector<Block<BlockDataType>*> blocksToRefine;
+    for (auto const& block : partition.getBlocks()) {
+        if (possiblyNeedsRefinement(*block)) {
+            blocksToRefine.push_back(block.get());
+        }
+    }
+
+    // The maximal number of states whose signatures are computed in a single task.
+    uint_fast64_t const chunkSize = 1024;
+    std::vector<std::pair<uint_fast64_t, uint_fast64_t>> chunks;
+    std::vector<std::vector<uint_fast64_t>> rangesOfEqualSignatures;
+    std::vector<Block<BlockDataType>*> newBlocks;
+    storm::storage::BitVector blockNeedsRefinement;
+    uint_fast64_t iterations = 0;
+    while (!blocksToRefine.empty()) {
+        ++iterations;
+
+        // Process large blocks first, which tends to balance the load among the threads.
+        std::sort(blocksToRefine.begin(), blocksToRefine.end(),
+                  [](Block<BlockDataType> const* b1, Block<BlockDataType> const* b2) { return b1->getNumberOfStates() > b2->getNumberOfStates(); });
+
+        // Compute the signatures of all states in the blocks to refine. Large blocks are divided into several chunks.
+        chunks.clear();
+        for (auto block : blocksToRefine) {
+            for (uint_fast64_t chunkBegin = block->getBeginIndex(); chunkBegin < block->getEndIndex(); chunkBegin += chunkSize) {
+                chunks.emplace_back(chunkBegin, std::min<uint_fast64_t>(chunkBegin + chunkSize, block->getEndIndex()));
+            }
+        }
+        threadPool->parallelFor(chunks.size(), [&](uint64_t chunk, uint64_t) {
+            for (uint_fast64_t position = chunks[chunk].first; position < chunks[chunk].second; ++position) {
+                computeSignature(partition.getState(position));
+            }
+        });
+
+        // Sort the states of each block by their signatures and determine the ranges of equal signatures. As the blocks are disjoint, this can be
+        // done concurrently.
+        rangesOfEqualSignatures.resize(blocksToRefine.size());
+        threadPool->parallelFor(blocksToRefine.size(), [&](uint64_t blockIndex, uint64_t) {
+            Block<BlockDataType> const& block = *blocksToRefine[blockIndex];
+            partition.sortRange(block.getBeginIndex(), block.getEndIndex(), stateSignatureLess);
+            rangesOfEqualSignatures[blockIndex] = partition.computeRangesOfEqualValue(block.getBeginIndex(), block.getEndIndex(), stateSignatureLess);
+        });
+
+        // Now actually split the blocks. Since this modifies the (shared) list of blocks, it needs to be done sequentially.
+        newBlocks.clear();
+        for (uint_fast64_t blockIndex = 0; blockIndex < blocksToRefine.size(); ++blockIndex) {
+            Block<BlockDataType>& block = *blocksToRefine[blockIndex];
+            auto const& ranges = rangesOfEqualSignatures[blockIndex];
+            // The first and last entries are the bounds of the block, all others are the positions at which to split.
+            for (auto positionIt = ranges.begin() + 1, positionIte = ranges.end() - 1; positionIt < positionIte; ++positionIt) {
+                Block<BlockDataType>& newBlock = *this->partition.splitBlock(block, *positionIt).first->get();
+                newBlock.data().setHasRewards(block.data().hasRewards());
+                newBlocks.push_back(&newBlock);
+            }
+        }
+
+        // Only the signatures of predecessors of the new blocks have changed, so only their blocks need to be refined in the next round.
+        blocksToRefine.clear();
+        blockNeedsRefinement.resize(partition.size());
+        for (auto newBlock : newBlocks) {
+            for (auto stateIt = partition.begin(*newBlock), stateIte = partition.end(*newBlock); stateIt != stateIte; ++stateIt) {
+                for (auto const& predecessorEntry : backwardTransitions.getRow(*stateIt)) {
+                    if (comparator.isZero(predecessorEntry.getValue())) {
+                        continue;
+                    }
+
+                    // For nondeterministic models, the backward transitions lead to choices rather than states.
+                    storm::storage::sparse::state_type predecessor = predecessorEntry.getColumn();
+                    if (nondeterministic) {
+                        predecessor = std::distance(rowGroupIndices.begin(), std::upper_bound(rowGroupIndices.begin(), rowGroupIndices.end(), predecessor)) - 1;
+                    }
+
+                    Block<BlockDataType>& predecessorBlock = partition.getBlock(predecessor);
+                    if (!blockNeedsRefinement.get(predecessorBlock.getId()) && possiblyNeedsRefinement(predecessorBlock)) {
+                        blockNeedsRefinement.set(predecessorBlock.getId());
+                        blocksToRefine.push_back(&predecessorBlock);
+                    }
+                }
+            }
+        }
+        for (auto block : blocksToRefine) {
+            blockNeedsRefinement.set(block->getId(), false);
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            std::cout << "Performed " << iterations << " iterations of signature-based partition refinement before abort.\n";
+            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in bisimulation computation.");
+            break;
+        }
+    }
+    STORM_LOG_DEBUG("Signature-based partition refinement took " << iterations << " iterations and yielded " << partition.size() << " blocks.");
+
+    postProcessSignatureBasedPartitionRefinement();
+}
+
+template<typename ModelType, typename BlockDataType>
+void BisimulationDecomposition<ModelType, BlockDataType>::postProcessSignatureBasedPartitionRefinement() {
+    // Intentionally left empty.
+}
+
 template<typename ModelType, typename BlockDataType>
 std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
     STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException,
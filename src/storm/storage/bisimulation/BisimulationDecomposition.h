@@ -139,6 +139,13 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
         /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
         bool buildQuotient;
 
+        /// A flag that indicates whether the partition is refined based on the signatures of all states rather than splitter by splitter. This
+        /// only applies to strong bisimulation.
+        bool signatureRefinement;
+
+        /// The number of threads used for signature-based refinement (0 means 'auto-detect').
+        uint64_t numberOfThreads;
+
        private:
         std::optional<OptimizationDirection> optimalityType;
 
@@ -225,6 +232,20 @@ class BisimulationDecomposition : public Decomposition<StateBlock> {
      */
     void performPartitionRefinement();
 
+    /*!
+     * Performs the partition refinement by repeatedly splitting all blocks according to the signatures of their states. The signature of a state
+     * consists of the probabilities to move to each block (for each choice of the state, if the model is nondeterministic). In each round, the
+     * signatures are computed concurrently and the blocks are sorted and split concurrently. Only blocks containing a predecessor of a block that
+     * was created in the previous round are considered again.
+     */
+    void performSignatureBasedPartitionRefinement();
+
+    /*!
+     * A function that can update auxiliary data structures that are not maintained by the signature-based refinement. It is called after the
+     * signature-based refinement is finished.
+     */
+    virtual void postProcessSignatureBasedPartitionRefinement();
+
     /*!
      * Refines the partition by considering the given splitter. All blocks that become potential splitters
      * because of this refinement, are marked as splitters and inserted into the splitter vector.
@@ -43,6 +43,13 @@ void NondeterministicModelBisimulationDecomposition<ModelType>::initialize() {
     this->initializeQuotientDistributions();
 }
 
+template<typename ModelType>
+void NondeterministicModelBisimulationDecomposition<ModelType>::postProcessSignatureBasedPartitionRefinement() {
+    // The quotient distributions are not updated during signature-based refinement, so we recompute them wrt. the final partition.
+    std::fill(quotientDistributions.begin(), quotientDistributions.end(), storm::storage::DistributionWithReward<ValueType>());
+    this->initializeQuotientDistributions();
+}
+
 template<typename ModelType>
 void NondeterministicModelBisimulationDecomposition<ModelType>::createChoiceToStateMapping() {
     std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
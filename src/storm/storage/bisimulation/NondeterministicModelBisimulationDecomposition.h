@@ -38,6 +38,8 @@ class NondeterministicModelBisimulationDecomposition : public BisimulationDecomp
 
     virtual void initialize() override;
 
+    virtual void postProcessSignatureBasedPartitionRefinement() override;
+
    private:
     // Creates the mapping from the choice indices to the states.
     void createChoiceToStateMapping();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <set>
 #include <string>
@@ -32,6 +33,12 @@ struct ExportOptions {
      */
     storm::io::CompressionMode compression{storm::io::CompressionMode::Default};
 
+    /*!
+     * The number of threads used for compressing the exported UMB model (0 means 'auto-detect').
+     * Only xz compression makes use of multiple threads. The thread count does not affect the choice of the compression.
+     */
+    uint64_t numberOfThreads{1};
+
     /*!
      * Whether to canonicize POMDPs before export.
      */
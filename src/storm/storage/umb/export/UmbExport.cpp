@@ -136,13 +136,19 @@ void exportFiles(UmbStructure const& umbStructure, storm::io::ArchiveWriter& tar
 }  // namespace detail
 
 void toArchive(storm::umb::UmbModel const& umbModel, std::filesystem::path const& archivePath, ExportOptions const& options) {
+    toArchive(umbModel, archivePath, options, [](storm::io::ArchiveWriter&) {});
+}
+
+void toArchive(storm::umb::UmbModel const& umbModel, std::filesystem::path const& archivePath, ExportOptions const& options,
+               std::function<void(storm::io::ArchiveWriter&)> const& addFurtherFiles) {
     auto compression = options.compression;
     // Set gzip as default compression
     if (compression == storm::io::CompressionMode::Default) {
         compression = storm::io::CompressionMode::Gzip;
     }
-    storm::io::ArchiveWriter archiveWriter(archivePath, compression);
+    storm::io::ArchiveWriter archiveWriter(archivePath, compression, options.numberOfThreads);
     detail::exportFiles(umbModel, archiveWriter, {});
+    addFurtherFiles(archiveWriter);
 }
 
 }  // namespace storm::umb
\ No newline at end of file
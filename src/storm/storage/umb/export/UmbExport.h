@@ -1,13 +1,25 @@
 #pragma once
 
 #include <filesystem>
+#include <functional>
 #include <memory>
 
 #include "storm/storage/umb/export/ExportOptions.h"
 #include "storm/storage/umb/model/UmbModelForward.h"
 
+namespace storm::io {
+class ArchiveWriter;
+}
+
 namespace storm::umb {
 
 void toArchive(storm::umb::UmbModel const& umbModel, std::filesystem::path const& archivePath, ExportOptions const& options = {});
 
+/*!
+ * Writes the given UMB model to the archive and then invokes the given function which can add further files to the archive.
+ * This allows to export files whose data is not held by the given UMB model (e.g. because it does not fit into memory).
+ */
+void toArchive(storm::umb::UmbModel const& umbModel, std::filesystem::path const& archivePath, ExportOptions const& options,
+               std::function<void(storm::io::ArchiveWriter&)> const& addFurtherFiles);
+
 }  // namespace storm::umb
\ No newline at end of file
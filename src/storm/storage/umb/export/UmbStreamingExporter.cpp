@@ -0,0 +1,360 @@
+#include "storm/storage/umb/export/UmbStreamingExporter.h"
+
+#include <bit>
+
+#include "storm/storage/umb/export/UmbExport.h"
+#include "storm/storage/umb/model/StringEncoding.h"
+#include "storm/storage/umb/model/UmbModel.h"
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+#include "storm/io/ArchiveWriter.h"
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/utility/bitoperations.h"
+#include "storm/utility/macros.h"
+
+namespace storm::umb {
+
+namespace detail {
+
+// The number of bytes that are collected before they are written to the temporary file.
+static uint64_t const spoolBufferSize = 1ull << 16;
+
+template<typename T>
+SpooledVector<T>::SpooledVector() : file(std::tmpfile()), numberOfValues(0) {
+    STORM_LOG_THROW(file, storm::exceptions::FileIoException, "Unable to create temporary file for UMB export.");
+    buffer.reserve(spoolBufferSize / sizeof(T));
+}
+
+template<typename T>
+void SpooledVector<T>::push_back(T const& value) {
+    if constexpr (std::endian::native == std::endian::little) {
+        buffer.push_back(value);
+    } else {
+        buffer.push_back(storm::utility::byteSwap(value));
+    }
+    ++numberOfValues;
+    if (buffer.size() == buffer.capacity()) {
+        flush();
+    }
+}
+
+template<typename T>
+uint64_t SpooledVector<T>::size() const {
+    return numberOfValues;
+}
+
+template<typename T>
+void SpooledVector<T>::flush() {
+    if (!buffer.empty()) {
+        auto const numWritten = std::fwrite(buffer.data(), sizeof(T), buffer.size(), file.get());
+        STORM_LOG_THROW(numWritten == buffer.size(), storm::exceptions::FileIoException, "Unable to write to temporary file for UMB export.");
+        buffer.clear();
+    }
+}
+
+template<typename T>
+void SpooledVector<T>::writeToArchive(storm::io::ArchiveWriter& archiveWriter, std::filesystem::path const& archivePath) {
+    flush();
+    std::rewind(file.get());
+    archiveWriter.addFile(archivePath, file.get(), numberOfValues * sizeof(T));
+}
+
+template<typename T>
+void SpooledVector<T>::FileCloser::operator()(std::FILE* file) const noexcept {
+    if (file) {
+        std::fclose(file);  // temporary files are deleted when closed
+    }
+}
+
+template class SpooledVector<uint32_t>;
+template class SpooledVector<uint64_t>;
+template class SpooledVector<double>;
+
+}  // namespace detail
+
+UmbStreamingExporter::UmbStreamingExporter(storm::models::ModelType const& modelType, std::vector<RewardModelInformation> const& rewardModels,
+                                           bool hasChoiceActions, ExportOptions const& options)
+    : modelType(modelType),
+      options(options),
+      hasChoiceActions(hasChoiceActions),
+      numberOfStates(0),
+      numberOfChoices(0),
+      numberOfBranches(0),
+      rewardModels(rewardModels),
+      rewardHasNegativeAndPositiveValues(rewardModels.size(), {false, false}),
+      currentChoiceIsOpen(false),
+      currentStateIsMarkovian(false),
+      currentStateFirstChoice(0),
+      currentStateExitRate(0.0) {
+    using enum storm::models::ModelType;
+    STORM_LOG_THROW(modelType == Dtmc || modelType == Ctmc || modelType == Mdp || modelType == MarkovAutomaton, storm::exceptions::NotSupportedException,
+                    "Streaming UMB export is not supported for models of type " << modelType << ".");
+    STORM_LOG_THROW(options.valueType == ExportOptions::ValueType::Default || options.valueType == ExportOptions::ValueType::Double,
+                    storm::exceptions::NotSupportedException, "Streaming UMB export only supports double precision values.");
+
+    // Both CSRs start with 0
+    stateToChoices.push_back(0);
+    choiceToBranches.push_back(0);
+
+    for (auto const& rewardModel : rewardModels) {
+        stateRewards.emplace_back();
+        if (rewardModel.hasStateRewards) {
+            stateRewards.back().emplace();
+        }
+        choiceRewards.emplace_back();
+        if (rewardModel.hasChoiceRewards) {
+            choiceRewards.back().emplace();
+        }
+    }
+
+    if (hasChoiceActions) {
+        // Action 0 is the default action that is used for choices without any label.
+        actionNames.emplace_back();
+        actionToIndex.emplace("", 0);
+    }
+}
+
+UmbStreamingExporter::~UmbStreamingExporter() = default;
+
+void UmbStreamingExporter::beginState() {
+    if (numberOfStates > 0) {
+        endState();
+    }
+    ++numberOfStates;
+    currentStateIsMarkovian = false;
+    currentStateFirstChoice = numberOfChoices;
+    currentStateExitRate = 0.0;
+}
+
+void UmbStreamingExporter::setMarkovian() {
+    STORM_LOG_ASSERT(numberOfStates > 0, "No state has been started.");
+    currentStateIsMarkovian = true;
+}
+
+void UmbStreamingExporter::addStateReward(uint64_t rewardModelIndex, double value) {
+    STORM_LOG_ASSERT(stateRewards.at(rewardModelIndex).has_value(), "Reward model has no state rewards.");
+    STORM_LOG_ASSERT(stateRewards[rewardModelIndex]->size() + 1 == numberOfStates, "Unexpected number of state rewards.");
+    stateRewards[rewardModelIndex]->push_back(value);
+    auto& [hasNegative, hasPositive] = rewardHasNegativeAndPositiveValues[rewardModelIndex];
+    hasNegative |= value < 0.0;
+    hasPositive |= value > 0.0;
+}
+
+void UmbStreamingExporter::beginChoice(std::string_view action) {
+    STORM_LOG_ASSERT(numberOfStates > 0, "No state has been started.");
+    if (currentChoiceIsOpen) {
+        endChoice();
+    }
+    currentChoiceIsOpen = true;
+    if (hasChoiceActions) {
+        auto [actionIt, inserted] = actionToIndex.try_emplace(std::string(action), actionNames.size());
+        if (inserted) {
+            actionNames.emplace_back(action);
+        }
+        choiceToAction.push_back(actionIt->second);
+    }
+}
+
+void UmbStreamingExporter::addChoiceReward(uint64_t rewardModelIndex, double value) {
+    STORM_LOG_ASSERT(currentChoiceIsOpen, "No choice has been started.");
+    STORM_LOG_ASSERT(choiceRewards.at(rewardModelIndex).has_value(), "Reward model has no choice rewards.");
+    STORM_LOG_ASSERT(choiceRewards[rewardModelIndex]->size() == numberOfChoices, "Unexpected number of choice rewards.");
+    choiceRewards[rewardModelIndex]->push_back(value);
+    auto& [hasNegative, hasPositive] = rewardHasNegativeAndPositiveValues[rewardModelIndex];
+    hasNegative |= value < 0.0;
+    hasPositive |= value > 0.0;
+}
+
+void UmbStreamingExporter::addBranch(uint64_t target, double value) {
+    STORM_LOG_ASSERT(currentChoiceIsOpen, "No choice has been started.");
+    currentChoiceBranches.emplace_back(target, value);
+}
+
+uint64_t UmbStreamingExporter::getNumberOfStates() const {
+    return numberOfStates;
+}
+
+bool UmbStreamingExporter::isDeterministicModel() const {
+    return modelType == storm::models::ModelType::Dtmc || modelType == storm::models::ModelType::Ctmc;
+}
+
+void UmbStreamingExporter::endChoice() {
+    // Rates are translated to probabilities. The sum of the rates is the exit rate of the state.
+    bool const isRateChoice = modelType == storm::models::ModelType::Ctmc ||
+                              (modelType == storm::models::ModelType::MarkovAutomaton && currentStateIsMarkovian && numberOfChoices == currentStateFirstChoice);
+    double rateSum = 1.0;
+    if (isRateChoice) {
+        rateSum = 0.0;
+        for (auto const& branch : currentChoiceBranches) {
+            rateSum += branch.second;
+        }
+        currentStateExitRate = rateSum;
+    }
+    for (auto const& [target, value] : currentChoiceBranches) {
+        branchToTarget.push_back(target);
+        branchToProbability.push_back(isRateChoice ? value / rateSum : value);
+    }
+    numberOfBranches += currentChoiceBranches.size();
+    currentChoiceBranches.clear();
+    choiceToBranches.push_back(numberOfBranches);
+    ++numberOfChoices;
+    currentChoiceIsOpen = false;
+}
+
+void UmbStreamingExporter::endState() {
+    if (currentChoiceIsOpen) {
+        endChoice();
+    }
+    STORM_LOG_THROW(numberOfChoices > currentStateFirstChoice, storm::exceptions::InvalidOperationException,
+                    "State " << (numberOfStates - 1) << " has no choices.");
+    STORM_LOG_THROW(numberOfChoices == currentStateFirstChoice + 1 || !isDeterministicModel(),
+                    storm::exceptions::InvalidOperationException, "State " << (numberOfStates - 1) << " of a deterministic model has multiple choices.");
+    stateToChoices.push_back(numberOfChoices);
+    if (modelType == storm::models::ModelType::Ctmc || modelType == storm::models::ModelType::MarkovAutomaton) {
+        stateToExitRate.push_back(currentStateExitRate);
+    }
+    if (currentStateIsMarkovian) {
+        stateIsMarkovian.grow(numberOfStates);
+        stateIsMarkovian.set(numberOfStates - 1);
+    }
+}
+
+void UmbStreamingExporter::writeArchive(std::filesystem::path const& archivePath, storm::models::sparse::StateLabeling const& stateLabeling) {
+    if (numberOfStates > 0) {
+        endState();
+    }
+    STORM_LOG_THROW(stateLabeling.getNumberOfItems() == numberOfStates, storm::exceptions::InvalidOperationException,
+                    "The state labeling does not match the number of states.");
+
+    // The data that is kept in memory is exported via an umb model.
+    storm::umb::UmbModel umbModel;
+    auto& index = umbModel.index;
+    index.fileData.emplace();
+    index.fileData->setCreationDateToNow();
+    index.fileData->tool = "Storm";
+
+    auto& ts = index.transitionSystem;
+    using enum storm::umb::ModelIndex::TransitionSystem::Time;
+    switch (modelType) {
+        case storm::models::ModelType::Dtmc:
+            ts.time = Discrete;
+            ts.numPlayers = 0;
+            break;
+        case storm::models::ModelType::Ctmc:
+            ts.time = Stochastic;
+            ts.numPlayers = 0;
+            break;
+        case storm::models::ModelType::Mdp:
+            ts.time = Discrete;
+            ts.numPlayers = 1;
+            break;
+        default:
+            STORM_LOG_ASSERT(modelType == storm::models::ModelType::MarkovAutomaton, "Unexpected model type.");
+            ts.time = UrgentStochastic;
+            ts.numPlayers = 1;
+    }
+    ts.numStates = numberOfStates;
+    ts.numChoices = numberOfChoices;
+    ts.numChoiceActions = actionNames.size();
+    ts.numBranches = numberOfBranches;
+    ts.numBranchActions = 0;
+    ts.numObservations = 0;
+    ts.branchProbabilityType = {storm::umb::Type::Double, defaultBitSize(storm::umb::Type::Double)};
+    if (ts.time != Discrete) {
+        ts.exitRateType = ts.branchProbabilityType;
+    }
+
+    // initial states and labels
+    STORM_LOG_THROW(stateLabeling.containsLabel("init"), storm::exceptions::InvalidOperationException, "The state labeling has no initial states.");
+    umbModel.stateIsInitial = stateLabeling.getStates("init");
+    ts.numInitialStates = umbModel.stateIsInitial->getNumberOfSetBits();
+    for (auto const& label : stateLabeling.getLabels()) {
+        if (label == "init") {
+            continue;  // Initial states are handled separately.
+        }
+        auto identifier = umb::ModelIndex::Annotation::getValidIdentifierFromAlias(label);
+        auto& aps = index.aps(true).value();
+        STORM_LOG_THROW(!aps.contains(identifier), storm::exceptions::WrongFormatException, "AP with identifier '" << identifier << "' already exists.");
+        auto& apIndex = aps[identifier];
+        apIndex.alias = label;
+        apIndex.type = {storm::umb::Type::Bool, defaultBitSize(storm::umb::Type::Bool)};
+        apIndex.appliesTo.push_back(storm::umb::ModelIndex::Annotation::AppliesTo::States);
+        umbModel.aps(true).value()[identifier].states.emplace().values.template set<bool>(stateLabeling.getStates(label));
+    }
+
+    // rewards (the values are added from the temporary files below)
+    std::vector<std::string> rewardIdentifiers;
+    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
+        auto const& rewardModel = rewardModels[rewardModelIndex];
+        auto& rewards = index.rewards(true).value();
+        auto const& identifier = rewardIdentifiers.emplace_back(umb::ModelIndex::Annotation::getValidIdentifierFromAlias(rewardModel.name));
+        STORM_LOG_THROW(!rewards.contains(identifier), storm::exceptions::WrongFormatException, "Reward id '" << identifier << "' already exists.");
+        auto& rewardIndex = rewards[identifier];
+        if (!rewardModel.name.empty()) {
+            rewardIndex.alias = rewardModel.name;
+        }
+        auto const [hasNegative, hasPositive] = rewardHasNegativeAndPositiveValues[rewardModelIndex];
+        if (!hasNegative) {
+            rewardIndex.lower = 0;
+        } else if (!hasPositive) {
+            rewardIndex.upper = 0;
+        }
+        auto& rewardAnnotation = umbModel.rewards(true).value()[identifier];
+        if (rewardModel.hasStateRewards) {
+            rewardIndex.appliesTo.push_back(storm::umb::ModelIndex::Annotation::AppliesTo::States);
+            rewardAnnotation.states.emplace();
+        }
+        if (rewardModel.hasChoiceRewards) {
+            rewardIndex.appliesTo.push_back(storm::umb::ModelIndex::Annotation::AppliesTo::Choices);
+            rewardAnnotation.choices.emplace();
+        }
+        rewardIndex.type = ts.branchProbabilityType.value();
+    }
+
+    // Model type specific components
+    if (modelType == storm::models::ModelType::MarkovAutomaton) {
+        stateIsMarkovian.resize(numberOfStates);
+        umbModel.stateIsMarkovian = std::move(stateIsMarkovian);
+    }
+
+    // action strings (the values are added from the temporary file below)
+    if (hasChoiceActions) {
+        umbModel.choiceActions.emplace();
+        auto actionStrings = StringsBuilder(umbModel.choiceActions->strings.emplace(), umbModel.choiceActions->stringMapping.emplace());
+        for (auto const& actionName : actionNames) {
+            actionStrings.push_back(actionName);
+        }
+        actionStrings.finalize();
+    }
+
+    storm::umb::toArchive(umbModel, archivePath, options, [&](storm::io::ArchiveWriter& archiveWriter) {
+        if (!isDeterministicModel()) {
+            stateToChoices.writeToArchive(archiveWriter, "state-to-choices.bin");
+        }
+        if (ts.exitRateType.has_value()) {
+            stateToExitRate.writeToArchive(archiveWriter, "state-to-exit-rate.bin");
+        }
+        choiceToBranches.writeToArchive(archiveWriter, "choice-to-branches.bin");
+        branchToTarget.writeToArchive(archiveWriter, "branch-to-target.bin");
+        branchToProbability.writeToArchive(archiveWriter, "branch-to-probability.bin");
+        if (hasChoiceActions) {
+            choiceToAction.writeToArchive(archiveWriter, "actions/choices/values.bin");
+        }
+        for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModels.size(); ++rewardModelIndex) {
+            std::filesystem::path const rewardPath = std::filesystem::path("annotations") / "rewards" / rewardIdentifiers[rewardModelIndex];
+            if (auto& values = stateRewards[rewardModelIndex]) {
+                STORM_LOG_ASSERT(values->size() == numberOfStates, "Unexpected number of state rewards.");
+                values->writeToArchive(archiveWriter, rewardPath / "states" / "values.bin");
+            }
+            if (auto& values = choiceRewards[rewardModelIndex]) {
+                STORM_LOG_ASSERT(values->size() == numberOfChoices, "Unexpected number of choice rewards.");
+                values->writeToArchive(archiveWriter, rewardPath / "choices" / "values.bin");
+            }
+        }
+    });
+}
+
+}  // namespace storm::umb
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storm/models/ModelType.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/umb/export/ExportOptions.h"
+
+namespace storm {
+
+namespace models::sparse {
+class StateLabeling;
+}
+
+namespace io {
+class ArchiveWriter;
+}
+
+namespace umb {
+
+namespace detail {
+
+/*!
+ * Collects the (little endian) binary encoding of a sequence of values in a temporary file so that the values need not be kept in memory.
+ */
+template<typename T>
+class SpooledVector {
+   public:
+    SpooledVector();
+
+    void push_back(T const& value);
+
+    /*!
+     * @return the number of values added so far.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Writes all values to the given archive.
+     */
+    void writeToArchive(storm::io::ArchiveWriter& archiveWriter, std::filesystem::path const& archivePath);
+
+   private:
+    void flush();
+
+    struct FileCloser {
+        void operator()(std::FILE* file) const noexcept;
+    };
+
+    std::unique_ptr<std::FILE, FileCloser> file;
+    std::vector<T> buffer;
+    uint64_t numberOfValues;
+};
+
+}  // namespace detail
+
+/*!
+ * Writes a model to a UMB archive while its states are being explored.
+ * States, choices and branches have to be added in the order of their indices. Data whose size depends on the number of choices or branches is
+ * written to temporary files during exploration and only packed into the archive once the exploration is completed. Hence, the transition matrix of the
+ * model never needs to be held in memory.
+ * @note Only double precision values are supported as the encoding of rational numbers requires knowledge about all values upfront.
+ */
+class UmbStreamingExporter {
+   public:
+    struct RewardModelInformation {
+        std::string name;
+        bool hasStateRewards;
+        bool hasChoiceRewards;
+    };
+
+    /*!
+     * Prepares the export of a model of the given type.
+     * @param rewardModels The reward models of the model. Rewards are referred to by their index in this vector.
+     * @param hasChoiceActions If set, an action is exported for each choice.
+     */
+    UmbStreamingExporter(storm::models::ModelType const& modelType, std::vector<RewardModelInformation> const& rewardModels, bool hasChoiceActions,
+                         ExportOptions const& options);
+
+    ~UmbStreamingExporter();
+
+    /*!
+     * Starts a new state. The previous state (if any) is completed.
+     */
+    void beginState();
+
+    /*!
+     * Marks the current state as Markovian. For Markov automata, the first choice of a Markovian state is assumed to consist of rates.
+     */
+    void setMarkovian();
+
+    /*!
+     * Adds the reward of the current state for the given reward model. Has to be invoked exactly once per state for reward models with state rewards.
+     */
+    void addStateReward(uint64_t rewardModelIndex, double value);
+
+    /*!
+     * Starts a new choice of the current state. The previous choice (if any) is completed.
+     * @param action The action of the choice. Only relevant if choice actions are exported. The empty string refers to unlabeled choices.
+     */
+    void beginChoice(std::string_view action = {});
+
+    /*!
+     * Adds the reward of the current choice for the given reward model. Has to be invoked exactly once per choice for reward models with choice rewards.
+     */
+    void addChoiceReward(uint64_t rewardModelIndex, double value);
+
+    /*!
+     * Adds a branch to the current choice. For continuous-time models, the value of a branch of a Markovian choice is the rate.
+     */
+    void addBranch(uint64_t target, double value);
+
+    /*!
+     * @return the number of states added so far.
+     */
+    uint64_t getNumberOfStates() const;
+
+    /*!
+     * Completes the model and writes it to the given archive.
+     * @param stateLabeling The labeling of the states. The label "init" indicates the initial states.
+     */
+    void writeArchive(std::filesystem::path const& archivePath, storm::models::sparse::StateLabeling const& stateLabeling);
+
+   private:
+    bool isDeterministicModel() const;
+    void endChoice();
+    void endState();
+
+    storm::models::ModelType modelType;
+    ExportOptions options;
+    bool hasChoiceActions;
+
+    uint64_t numberOfStates;
+    uint64_t numberOfChoices;
+    uint64_t numberOfBranches;
+
+    // The data that is written to temporary files during exploration.
+    detail::SpooledVector<uint64_t> stateToChoices, choiceToBranches, branchToTarget;
+    detail::SpooledVector<double> branchToProbability, stateToExitRate;
+    detail::SpooledVector<uint32_t> choiceToAction;
+    std::vector<std::optional<detail::SpooledVector<double>>> stateRewards, choiceRewards;
+
+    // Data that only grows with the number of states or actions is kept in memory.
+    storm::storage::BitVector stateIsMarkovian;
+    std::vector<std::string> actionNames;
+    std::unordered_map<std::string, uint32_t> actionToIndex;
+    std::vector<RewardModelInformation> rewardModels;
+    std::vector<std::pair<bool, bool>> rewardHasNegativeAndPositiveValues;
+
+    // Information about the current state and choice.
+    bool currentChoiceIsOpen;
+    bool currentStateIsMarkovian;
+    uint64_t currentStateFirstChoice;
+    std::vector<std::pair<uint64_t, double>> currentChoiceBranches;
+    double currentStateExitRate;
+};
+
+}  // namespace umb
+}  // namespace storm
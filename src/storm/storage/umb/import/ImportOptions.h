@@ -22,5 +22,12 @@ struct ImportOptions {
      * State valuations will only be built if this is set to true *and* the umb model contains appropriate information.
      */
     bool buildStateValuations{true};
+
+    /*!
+     * Controls whether uncompressed UMB archives are mapped to memory.
+     * The files are then read directly from the mapped archive (which is shared with other processes via the page cache) instead of being extracted.
+     * Compressed archives are always extracted.
+     */
+    bool useMemoryMapping{true};
 };
 }  // namespace storm::umb
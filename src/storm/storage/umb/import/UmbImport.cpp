@@ -225,11 +225,13 @@ bool importVector(typename storm::io::ArchiveReader::ArchiveReadEntry& src, stor
     return found;
 }
 
-storm::umb::UmbModel fromArchive(std::filesystem::path const& umbArchive, ImportOptions const& /* options */) {
+storm::umb::UmbModel fromArchive(std::filesystem::path const& umbArchive, ImportOptions const& options) {
     storm::umb::UmbModel umbModel;
+    auto const archive = storm::io::openArchive(umbArchive, options.useMemoryMapping);
+    STORM_LOG_DEBUG("Reading UMB archive " << umbArchive << (archive.isMemoryMapped() ? " from memory-mapped file." : " using libarchive."));
     // First pass: find the index file
     bool indexFound = false;
-    for (auto entry : storm::io::openArchive(umbArchive)) {
+    for (auto entry : archive) {
         if (entry.name() == "index.json") {
             parseIndexFromString(entry.toString(), umbModel.index);
             indexFound = true;
@@ -240,7 +242,7 @@ storm::umb::UmbModel fromArchive(std::filesystem::path const& umbArchive, Import
     STORM_LOG_TRACE("Index file found in umb archive " << umbArchive << ": \n" << storm::dumpJson(storm::json<storm::RationalNumber>(umbModel.index)));
     // Second pass: load the bin files
     prepareAnnotations(umbModel);
-    for (auto entry : storm::io::openArchive(umbArchive)) {
+    for (auto entry : archive) {
         if (entry.name() == "index.json" || entry.isDir()) {
             continue;  // skip the index file and directories
         }
@@ -0,0 +1,131 @@
+#include "storm/utility/ThreadPool.h"
+
+#include <algorithm>
+#include <map>
+
+#include "storm/utility/macros.h"
+#include "storm/utility/threads.h"
+
+namespace storm::utility {
+
+namespace detail {
+// The pool whose tasks are currently executed by this thread (if any)
+static thread_local ThreadPool const* activePool = nullptr;
+}  // namespace detail
+
+ThreadPool::ThreadPool(uint64_t numberOfWorkers) {
+    if (numberOfWorkers == 0) {
+        numberOfWorkers = std::max<uint64_t>(1, storm::utility::getNumberOfThreads());
+    }
+    threads.reserve(numberOfWorkers - 1);
+    for (uint64_t workerIndex = 1; workerIndex < numberOfWorkers; ++workerIndex) {
+        threads.emplace_back(&ThreadPool::workerLoop, this, workerIndex);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stop = true;
+    }
+    batchAvailable.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+uint64_t ThreadPool::getNumberOfWorkers() const {
+    return threads.size() + 1;
+}
+
+void ThreadPool::parallelFor(uint64_t numberOfTasks, std::function<void(uint64_t, uint64_t)> const& task) {
+    std::unique_lock<std::mutex> batchLock(batchMutex, std::defer_lock);
+    if (threads.empty() || numberOfTasks <= 1 || detail::activePool == this || !batchLock.try_lock()) {
+        // Sequential fallback
+        for (uint64_t taskIndex = 0; taskIndex < numberOfTasks; ++taskIndex) {
+            task(taskIndex, 0);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        currentTask = &task;
+        this->numberOfTasks = numberOfTasks;
+        nextTask.store(0, std::memory_order_relaxed);
+        firstException = nullptr;
+        numberOfBusyThreads = threads.size();
+        ++generation;
+    }
+    batchAvailable.notify_all();
+
+    runTasks(0);
+
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock(stateMutex);
+        batchFinished.wait(lock, [this] { return numberOfBusyThreads == 0; });
+        currentTask = nullptr;
+        std::swap(exception, firstException);
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void ThreadPool::workerLoop(uint64_t workerIndex) {
+    uint64_t processedGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            batchAvailable.wait(lock, [this, &processedGeneration] { return stop || generation != processedGeneration; });
+            if (stop) {
+                return;
+            }
+            processedGeneration = generation;
+        }
+        runTasks(workerIndex);
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            STORM_LOG_ASSERT(numberOfBusyThreads > 0, "Unexpected number of busy threads.");
+            if (--numberOfBusyThreads == 0) {
+                batchFinished.notify_all();
+            }
+        }
+    }
+}
+
+void ThreadPool::runTasks(uint64_t workerIndex) {
+    auto const* previousPool = detail::activePool;
+    detail::activePool = this;
+    for (uint64_t taskIndex = nextTask.fetch_add(1, std::memory_order_relaxed); taskIndex < numberOfTasks;
+         taskIndex = nextTask.fetch_add(1, std::memory_order_relaxed)) {
+        try {
+            (*currentTask)(taskIndex, workerIndex);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            if (!firstException) {
+                firstException = std::current_exception();
+            }
+            // Prevent that further tasks are started
+            nextTask.store(numberOfTasks, std::memory_order_relaxed);
+        }
+    }
+    detail::activePool = previousPool;
+}
+
+std::shared_ptr<ThreadPool> ThreadPool::getShared(uint64_t numberOfWorkers) {
+    if (numberOfWorkers == 0) {
+        numberOfWorkers = std::max<uint64_t>(1, storm::utility::getNumberOfThreads());
+    }
+    static std::mutex sharedPoolsMutex;
+    static std::map<uint64_t, std::shared_ptr<ThreadPool>> sharedPools;
+    std::lock_guard<std::mutex> lock(sharedPoolsMutex);
+    auto& pool = sharedPools[numberOfWorkers];
+    if (!pool) {
+        pool = std::make_shared<ThreadPool>(numberOfWorkers);
+    }
+    return pool;
+}
+
+}  // namespace storm::utility
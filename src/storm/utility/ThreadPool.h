@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace storm::utility {
+
+/*!
+ * A pool of worker threads that processes batches of independent tasks.
+ * The thread that submits a batch participates in its execution, i.e., a pool with n workers spawns n-1 additional threads.
+ */
+class ThreadPool {
+   public:
+    /*!
+     * Creates a new thread pool.
+     * @param numberOfWorkers The number of workers (including the calling thread). Zero means that the number is detected automatically.
+     */
+    explicit ThreadPool(uint64_t numberOfWorkers = 0);
+
+    ~ThreadPool();
+
+    ThreadPool(ThreadPool const&) = delete;
+    ThreadPool& operator=(ThreadPool const&) = delete;
+
+    /*!
+     * @return the number of workers of this pool (including the calling thread).
+     */
+    uint64_t getNumberOfWorkers() const;
+
+    /*!
+     * Invokes task(taskIndex, workerIndex) for each taskIndex in [0, numberOfTasks), where workerIndex (0 <= workerIndex < getNumberOfWorkers())
+     * identifies the executing worker. Tasks with the same worker index are never executed concurrently.
+     * Tasks are distributed dynamically among the workers. The method returns once all tasks have been processed.
+     * If a task throws an exception, no further tasks are started and the first exception is rethrown.
+     *
+     * @note If this pool is already busy (e.g. parallelFor is called from within a task or concurrently from another thread),
+     *       the tasks are executed sequentially by the calling thread with worker index 0.
+     */
+    void parallelFor(uint64_t numberOfTasks, std::function<void(uint64_t, uint64_t)> const& task);
+
+    /*!
+     * Retrieves a pool with the given number of workers that is shared across the whole process.
+     * @param numberOfWorkers The number of workers (including the calling thread). Zero means that the number is detected automatically.
+     */
+    static std::shared_ptr<ThreadPool> getShared(uint64_t numberOfWorkers);
+
+   private:
+    void workerLoop(uint64_t workerIndex);
+    void runTasks(uint64_t workerIndex);
+
+    std::vector<std::thread> threads;
+
+    // Serializes submissions of batches
+    std::mutex batchMutex;
+
+    // Protects the members below
+    std::mutex stateMutex;
+    std::condition_variable batchAvailable;
+    std::condition_variable batchFinished;
+    std::function<void(uint64_t, uint64_t)> const* currentTask{nullptr};
+    uint64_t numberOfTasks{0};
+    uint64_t generation{0};
+    uint64_t numberOfBusyThreads{0};
+    std::exception_ptr firstException;
+    bool stop{false};
+
+    std::atomic<uint64_t> nextTask{0};
+};
+
+}  // namespace storm::utility
@@ -1,6 +1,8 @@
 #include "storm/utility/graph.h"
 
 #include <algorithm>
+#include <atomic>
+#include <optional>
 
 #include "storm/adapters/IntervalAdapter.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -18,6 +20,7 @@
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/sparse/StateType.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
@@ -25,6 +28,198 @@ namespace storm {
 namespace utility {
 namespace graph {
 
+namespace detail {
+// The number of frontier states that are processed within a single task of a parallel backward search.
+static uint64_t const frontierChunkSize = 1024;
+
+/*!
+ * Retrieves the thread pool to use for a backward search or nullptr if the search is to be performed sequentially.
+ *
+ * @param numberOfThreads The requested number of threads (0 means 'auto-detect').
+ */
+std::shared_ptr<storm::utility::ThreadPool> getThreadPoolForSearch(uint64_t numberOfThreads) {
+    if (numberOfThreads == 1) {
+        return nullptr;
+    }
+    auto threadPool = storm::utility::ThreadPool::getShared(numberOfThreads);
+    if (threadPool->getNumberOfWorkers() <= 1) {
+        return nullptr;
+    }
+    return threadPool;
+}
+
+/*!
+ * A set of states stored as a bitmap with the same layout as the buckets of a BitVector.
+ * States can be queried and inserted concurrently.
+ */
+class ConcurrentStateSet {
+   public:
+    explicit ConcurrentStateSet(storm::storage::BitVector const& initialStates) : numberOfStates(initialStates.size()), buckets(initialStates.bucketCount()) {
+        for (uint64_t bucketIndex = 0; bucketIndex < buckets.size(); ++bucketIndex) {
+            buckets[bucketIndex] = initialStates.getBucket(bucketIndex);
+        }
+    }
+
+    bool get(uint64_t state) {
+        return (std::atomic_ref<uint64_t>(buckets[state >> 6]).load(std::memory_order_relaxed) & getMask(state)) != 0;
+    }
+
+    /*!
+     * Inserts the given state and returns true iff the state was not contained before.
+     */
+    bool insert(uint64_t state) {
+        std::atomic_ref<uint64_t> bucket(buckets[state >> 6]);
+        uint64_t const mask = getMask(state);
+        return (bucket.load(std::memory_order_relaxed) & mask) == 0 && (bucket.fetch_or(mask, std::memory_order_relaxed) & mask) == 0;
+    }
+
+    /*!
+     * Converts this set into a BitVector. Must not be called concurrently with insert.
+     */
+    storm::storage::BitVector toBitVector() const {
+        storm::storage::BitVector result(numberOfStates);
+        for (uint64_t bucketIndex = 0; bucketIndex < buckets.size(); ++bucketIndex) {
+            result.setBucket(bucketIndex, buckets[bucketIndex]);
+        }
+        return result;
+    }
+
+   private:
+    static uint64_t getMask(uint64_t state) {
+        // The most significant bit of a bucket refers to the smallest index.
+        return 1ull << (63 - (state & 63));
+    }
+
+    uint64_t numberOfStates;
+    std::vector<uint64_t> buckets;
+};
+
+/*!
+ * Performs a level-synchronous backward search through the given states. The states of each level (the frontier) are processed concurrently.
+ * A phi-predecessor of a frontier state that is not yet contained in the given set is inserted (and explored in the next level) if the condition holds for it.
+ * As the set grows concurrently, the condition has to be monotone, i.e., once it holds for a state it has to hold for all supersets of the current set.
+ *
+ * @param threadPool The thread pool used to process the frontiers.
+ * @param backwardTransitions The reversed transition relation of the graph structure to search.
+ * @param phiStates The states that may be visited during the search.
+ * @param states The set of states that are already found. Will be extended during the search.
+ * @param frontier The states from which the search starts. The vector is used as temporary storage.
+ * @param maximalSteps If given, the search stops after the given number of levels.
+ * @param condition The condition that a predecessor has to satisfy in order to be inserted into the set.
+ */
+template<typename T, typename ConditionType>
+void performParallelBackwardSearch(storm::utility::ThreadPool& threadPool, storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                   storm::storage::BitVector const& phiStates, ConcurrentStateSet& states, std::vector<uint64_t>& frontier,
+                                   std::optional<uint64_t> const& maximalSteps, ConditionType const& condition) {
+    std::vector<std::vector<uint64_t>> workerFrontiers(threadPool.getNumberOfWorkers());
+    for (uint64_t level = 0; !frontier.empty() && (!maximalSteps || level < maximalSteps.value()); ++level) {
+        uint64_t const numberOfChunks = (frontier.size() + frontierChunkSize - 1) / frontierChunkSize;
+        threadPool.parallelFor(numberOfChunks, [&](uint64_t chunkIndex, uint64_t workerIndex) {
+            auto& nextFrontier = workerFrontiers[workerIndex];
+            uint64_t const chunkEnd = std::min<uint64_t>(frontier.size(), (chunkIndex + 1) * frontierChunkSize);
+            for (uint64_t frontierIndex = chunkIndex * frontierChunkSize; frontierIndex < chunkEnd; ++frontierIndex) {
+                for (auto const& predecessorEntry : backwardTransitions.getRow(frontier[frontierIndex])) {
+                    uint64_t const predecessor = predecessorEntry.getColumn();
+                    if (phiStates.get(predecessor) && !states.get(predecessor) && condition(predecessor) && states.insert(predecessor)) {
+                        nextFrontier.push_back(predecessor);
+                    }
+                }
+            }
+        });
+        frontier.clear();
+        for (auto& nextFrontier : workerFrontiers) {
+            frontier.insert(frontier.end(), nextFrontier.begin(), nextFrontier.end());
+            nextFrontier.clear();
+        }
+    }
+}
+
+template<typename T>
+storm::storage::BitVector performParallelProbGreater0E(storm::utility::ThreadPool& threadPool, storm::storage::SparseMatrix<T> const& backwardTransitions,
+                                                       storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                       std::optional<uint64_t> const& maximalSteps) {
+    ConcurrentStateSet statesWithProbabilityGreater0(psiStates);
+    std::vector<uint64_t> frontier(psiStates.begin(), psiStates.end());
+    performParallelBackwardSearch(threadPool, backwardTransitions, phiStates, statesWithProbabilityGreater0, frontier, maximalSteps,
+                                  [](uint64_t) { return true; });
+    return statesWithProbabilityGreater0.toBitVector();
+}
+
+template<typename T>
+storm::storage::BitVector performParallelProbGreater0A(storm::utility::ThreadPool& threadPool, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                                       std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                                       storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                                       storm::storage::BitVector const& psiStates,
+                                                       boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+    ConcurrentStateSet statesWithProbabilityGreater0(psiStates);
+    std::vector<uint64_t> frontier(psiStates.begin(), psiStates.end());
+    performParallelBackwardSearch(threadPool, backwardTransitions, phiStates, statesWithProbabilityGreater0, frontier, std::nullopt, [&](uint64_t state) {
+        // Check whether the state has at least one enabled choice and whether every enabled choice has a successor in the current state set.
+        uint64_t row = nondeterministicChoiceIndices[state];
+        uint64_t const endOfGroup = nondeterministicChoiceIndices[state + 1];
+        if (choiceConstraint && choiceConstraint->getNextSetIndex(row) >= endOfGroup) {
+            return false;
+        }
+        for (; row < endOfGroup; ++row) {
+            if (!choiceConstraint || choiceConstraint->get(row)) {
+                auto const& choice = transitionMatrix.getRow(row);
+                if (std::none_of(choice.begin(), choice.end(),
+                                 [&](auto const& successorEntry) { return statesWithProbabilityGreater0.get(successorEntry.getColumn()); })) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    });
+    return statesWithProbabilityGreater0.toBitVector();
+}
+
+template<typename T>
+storm::storage::BitVector performParallelProb1(storm::utility::ThreadPool& threadPool, storm::storage::SparseMatrix<T> const& transitionMatrix,
+                                               std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
+                                               storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+                                               storm::storage::BitVector const& psiStates, bool existential,
+                                               boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+    storm::storage::BitVector currentStates(phiStates.size(), true);
+    std::vector<uint64_t> frontier;
+
+    // Perform the loop as long as the set of states changes.
+    while (true) {
+        ConcurrentStateSet nextStates(psiStates);
+        frontier.assign(psiStates.begin(), psiStates.end());
+        performParallelBackwardSearch(threadPool, backwardTransitions, phiStates, nextStates, frontier, std::nullopt, [&](uint64_t state) {
+            // A choice is good if all its successors are in the current state set and at least one of them is in the next state set.
+            // We need one good choice (existential) or all choices need to be good (universal).
+            for (uint64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                if (!choiceConstraint || choiceConstraint->get(row)) {
+                    bool allSuccessorsInCurrentStates = true;
+                    bool hasNextStateSuccessor = false;
+                    for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                        if (!currentStates.get(successorEntry.getColumn())) {
+                            allSuccessorsInCurrentStates = false;
+                            break;
+                        } else if (!hasNextStateSuccessor && nextStates.get(successorEntry.getColumn())) {
+                            hasNextStateSuccessor = true;
+                        }
+                    }
+                    bool const isGoodChoice = allSuccessorsInCurrentStates && hasNextStateSuccessor;
+                    if (existential == isGoodChoice) {
+                        return existential;
+                    }
+                }
+            }
+            return !existential;
+        });
+
+        storm::storage::BitVector newStates = nextStates.toBitVector();
+        if (currentStates == newStates) {
+            return currentStates;
+        }
+        currentStates = std::move(newStates);
+    }
+}
+}  // namespace detail
+
 template<typename T>
 storm::storage::BitVector getReachableOneStep(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates) {
     storm::storage::BitVector result{initialStates.size()};
@@ -313,7 +508,13 @@ std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<T> const& t
 
 template<typename T>
 storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                              storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+                                              storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
+                                              uint64_t numberOfThreads) {
+    if (auto threadPool = detail::getThreadPoolForSearch(numberOfThreads)) {
+        return detail::performParallelProbGreater0E(*threadPool, backwardTransitions, phiStates, psiStates,
+                                                    useStepBound ? std::optional<uint64_t>(maximalSteps) : std::nullopt);
+    }
+
     // Prepare the resulting bit vector.
     uint_fast64_t numberOfStates = phiStates.size();
     storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
@@ -374,17 +575,20 @@ storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> co
 
 template<typename T>
 storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const&,
-                                       storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0) {
-    storm::storage::BitVector statesWithProbability1 = performProbGreater0(backwardTransitions, ~psiStates, ~statesWithProbabilityGreater0);
+                                       storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0,
+                                       uint64_t numberOfThreads) {
+    storm::storage::BitVector statesWithProbability1 =
+        performProbGreater0(backwardTransitions, ~psiStates, ~statesWithProbabilityGreater0, false, 0, numberOfThreads);
     statesWithProbability1.complement();
     return statesWithProbability1;
 }
 
 template<typename T>
 storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                       storm::storage::BitVector const& psiStates) {
-    storm::storage::BitVector statesWithProbabilityGreater0 = performProbGreater0(backwardTransitions, phiStates, psiStates);
-    storm::storage::BitVector statesWithProbability1 = performProbGreater0(backwardTransitions, ~psiStates, ~(statesWithProbabilityGreater0));
+                                       storm::storage::BitVector const& psiStates, uint64_t numberOfThreads) {
+    storm::storage::BitVector statesWithProbabilityGreater0 = performProbGreater0(backwardTransitions, phiStates, psiStates, false, 0, numberOfThreads);
+    storm::storage::BitVector statesWithProbability1 =
+        performProbGreater0(backwardTransitions, ~psiStates, ~(statesWithProbabilityGreater0), false, 0, numberOfThreads);
     statesWithProbability1.complement();
     return statesWithProbability1;
 }
@@ -404,10 +608,10 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(st
 template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                               storm::storage::BitVector const& phiStates,
-                                                                              storm::storage::BitVector const& psiStates) {
+                                                                              storm::storage::BitVector const& psiStates, uint64_t numberOfThreads) {
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
-    result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
-    result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
+    result.first = performProbGreater0(backwardTransitions, phiStates, psiStates, false, 0, numberOfThreads);
+    result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first, numberOfThreads);
     result.first.complement();
     return result;
 }
@@ -671,7 +875,13 @@ void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm
 
 template<typename T>
 storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                               storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+                                               storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
+                                               uint64_t numberOfThreads) {
+    if (auto threadPool = detail::getThreadPoolForSearch(numberOfThreads)) {
+        return detail::performParallelProbGreater0E(*threadPool, backwardTransitions, phiStates, psiStates,
+                                                    useStepBound ? std::optional<uint64_t>(maximalSteps) : std::nullopt);
+    }
+
     size_t numberOfStates = phiStates.size();
 
     // Prepare resulting bit vector.
@@ -731,8 +941,8 @@ storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> c
 
 template<typename T>
 storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                        storm::storage::BitVector const& psiStates) {
-    storm::storage::BitVector statesWithProbability0 = performProbGreater0E(backwardTransitions, phiStates, psiStates);
+                                        storm::storage::BitVector const& psiStates, uint64_t numberOfThreads) {
+    storm::storage::BitVector statesWithProbability0 = performProbGreater0E(backwardTransitions, phiStates, psiStates, false, 0, numberOfThreads);
     statesWithProbability0.complement();
     return statesWithProbability0;
 }
@@ -741,7 +951,13 @@ template<typename T>
 storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& transitionMatrix,
                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                        storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+                                        storm::storage::BitVector const& psiStates, boost::optional<storm::storage::BitVector> const& choiceConstraint,
+                                        uint64_t numberOfThreads) {
+    if (auto threadPool = detail::getThreadPoolForSearch(numberOfThreads)) {
+        return detail::performParallelProb1(*threadPool, transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, true,
+                                            choiceConstraint);
+    }
+
     size_t numberOfStates = phiStates.size();
 
     // Initialize the environment for the iterative algorithm.
@@ -820,12 +1036,12 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max
                                                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
-                                                                                 storm::storage::BitVector const& psiStates) {
+                                                                                 storm::storage::BitVector const& psiStates, uint64_t numberOfThreads) {
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
 
-    result.first = performProb0A(backwardTransitions, phiStates, psiStates);
+    result.first = performProb0A(backwardTransitions, phiStates, psiStates, numberOfThreads);
 
-    result.second = performProb1E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+    result.second = performProb1E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, boost::none, numberOfThreads);
     return result;
 }
 
@@ -842,7 +1058,15 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
                                                std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps,
-                                               boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+                                               boost::optional<storm::storage::BitVector> const& choiceConstraint, uint64_t numberOfThreads) {
+    if (!useStepBound) {
+        // The step bounded variant is not supported by the parallel search as it would require to keep track of the remaining steps for each state.
+        if (auto threadPool = detail::getThreadPoolForSearch(numberOfThreads)) {
+            return detail::performParallelProbGreater0A(*threadPool, transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates,
+                                                        choiceConstraint);
+        }
+    }
+
     size_t numberOfStates = phiStates.size();
 
     // Prepare resulting bit vector.
@@ -970,9 +1194,10 @@ template<typename T>
 storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<T> const& transitionMatrix,
                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                        storm::storage::BitVector const& psiStates) {
+                                        storm::storage::BitVector const& psiStates, uint64_t numberOfThreads) {
     storm::storage::BitVector statesWithProbability0 =
-        performProbGreater0A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+        performProbGreater0A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, false, 0, boost::none,
+                             numberOfThreads);
     statesWithProbability0.complement();
     return statesWithProbability0;
 }
@@ -988,7 +1213,12 @@ template<typename T>
 storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& transitionMatrix,
                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                        storm::storage::BitVector const& psiStates) {
+                                        storm::storage::BitVector const& psiStates, uint64_t numberOfThreads) {
+    if (auto threadPool = detail::getThreadPoolForSearch(numberOfThreads)) {
+        return detail::performParallelProb1(*threadPool, transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, false,
+                                            boost::none);
+    }
+
     size_t numberOfStates = phiStates.size();
 
     // Initialize the environment for the iterative algorithm.
@@ -1064,13 +1294,13 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min
                                                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
-                                                                                 storm::storage::BitVector const& psiStates) {
+                                                                                 storm::storage::BitVector const& psiStates, uint64_t numberOfThreads) {
     std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
-    result.first = performProb0E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+    result.first = performProb0E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, numberOfThreads);
     // Instead of calling performProb1A, we call the (more easier) performProb0A on the Prob0E states.
     // This is valid because, when minimizing probabilities, states that have prob1 cannot reach a state with prob 0 (and will eventually reach a psiState).
     // States that do not have prob1 will eventually reach a state with prob0.
-    result.second = performProb0A(backwardTransitions, ~psiStates, result.first);
+    result.second = performProb0A(backwardTransitions, ~psiStates, result.first, numberOfThreads);
     return result;
 }
 
@@ -1890,13 +2120,14 @@ template std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<do
 
 template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<double> const& backwardTransitions,
                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                       bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                                       bool useStepBound = false, uint_fast64_t maximalSteps = 0, uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                                storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0);
+                                                storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0,
+                                                uint64_t numberOfThreads);
 
 template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                                storm::storage::BitVector const& psiStates);
+                                                storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::models::sparse::DeterministicModel<double> const& model,
                                                                                        storm::storage::BitVector const& phiStates,
@@ -1904,7 +2135,7 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<double> const& backwardTransitions,
                                                                                        storm::storage::BitVector const& phiStates,
-                                                                                       storm::storage::BitVector const& psiStates);
+                                                                                       storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<double> const& transitionMatrix,
                                             storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
@@ -1924,16 +2155,17 @@ template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStat
 
 template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<double> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                        bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                                        bool useStepBound = false, uint_fast64_t maximalSteps = 0, uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                                 storm::storage::BitVector const& psiStates);
+                                                 storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<double> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                  storm::storage::BitVector const& psiStates,
-                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none,
+                                                 uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb1E(
     storm::models::sparse::NondeterministicModel<double, storm::models::sparse::StandardRewardModel<double>> const& model,
@@ -1943,7 +2175,7 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
                                                                                           std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                                                           storm::storage::SparseMatrix<double> const& backwardTransitions,
                                                                                           storm::storage::BitVector const& phiStates,
-                                                                                          storm::storage::BitVector const& psiStates);
+                                                                                          storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::models::sparse::NondeterministicModel<double, storm::models::sparse::StandardRewardModel<double>> const& model,
@@ -1954,7 +2186,8 @@ template storm::storage::BitVector performProbGreater0A(storm::storage::SparseMa
                                                         storm::storage::SparseMatrix<double> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                         bool useStepBound = false, uint_fast64_t maximalSteps = 0,
-                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none,
+                                                        uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb0E(
     storm::models::sparse::NondeterministicModel<double, storm::models::sparse::StandardRewardModel<double>> const& model,
@@ -1969,7 +2202,7 @@ template storm::storage::BitVector performProb0E(
 template storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<double> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                                 storm::storage::BitVector const& psiStates);
+                                                 storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template storm::storage::BitVector performProb1A(
     storm::models::sparse::NondeterministicModel<double, storm::models::sparse::StandardRewardModel<double>> const& model,
@@ -1984,13 +2217,13 @@ template storm::storage::BitVector performProb1A(
 template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<double> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                                 storm::storage::BitVector const& psiStates);
+                                                 storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<double> const& transitionMatrix,
                                                                                           std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                                                           storm::storage::SparseMatrix<double> const& backwardTransitions,
                                                                                           storm::storage::BitVector const& phiStates,
-                                                                                          storm::storage::BitVector const& psiStates);
+                                                                                          storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::models::sparse::NondeterministicModel<double, storm::models::sparse::StandardRewardModel<double>> const& model,
@@ -2034,14 +2267,15 @@ template std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<st
 
 template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                       bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                                       bool useStepBound = false, uint_fast64_t maximalSteps = 0, uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                storm::storage::BitVector const& statesWithProbabilityGreater0);
+                                                storm::storage::BitVector const& statesWithProbabilityGreater0, uint64_t numberOfThreads);
 
 template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
-                                                storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                                                storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(
     storm::models::sparse::DeterministicModel<storm::RationalNumber> const& model, storm::storage::BitVector const& phiStates,
@@ -2049,7 +2283,7 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                             storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
@@ -2071,16 +2305,18 @@ template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStat
 
 template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                        bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                                        bool useStepBound = false, uint_fast64_t maximalSteps = 0, uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
-                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 uint64_t numberOfThreads);
 
 template storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none,
+                                                 uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb1E(storm::models::sparse::NondeterministicModel<storm::RationalNumber> const& model,
                                                  storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
@@ -2089,7 +2325,7 @@ template storm::storage::BitVector performProb1E(storm::models::sparse::Nondeter
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::models::sparse::NondeterministicModel<storm::RationalNumber> const& model, storm::storage::BitVector const& phiStates,
@@ -2100,7 +2336,8 @@ template storm::storage::BitVector performProbGreater0A(storm::storage::SparseMa
                                                         storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                         bool useStepBound = false, uint_fast64_t maximalSteps = 0,
-                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none,
+                                                        uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb0E(storm::models::sparse::NondeterministicModel<storm::RationalNumber> const& model,
                                                  storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
@@ -2109,17 +2346,19 @@ template storm::storage::BitVector performProb0E(storm::models::sparse::Nondeter
 template storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
-                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 uint64_t numberOfThreads);
 
 template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
-                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::models::sparse::NondeterministicModel<storm::RationalNumber> const& model, storm::storage::BitVector const& phiStates,
@@ -2166,14 +2405,15 @@ template std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<st
 
 template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                       bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                                       bool useStepBound = false, uint_fast64_t maximalSteps = 0, uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                storm::storage::BitVector const& statesWithProbabilityGreater0);
+                                                storm::storage::BitVector const& statesWithProbabilityGreater0, uint64_t numberOfThreads);
 
 template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
-                                                storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                                                storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::models::sparse::DeterministicModel<storm::Interval> const& model,
                                                                                        storm::storage::BitVector const& phiStates,
@@ -2181,7 +2421,7 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
                                                                                        storm::storage::BitVector const& phiStates,
-                                                                                       storm::storage::BitVector const& psiStates);
+                                                                                       storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
                                             storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
@@ -2201,16 +2441,18 @@ template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStat
 
 template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                        bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                                        bool useStepBound = false, uint_fast64_t maximalSteps = 0, uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
-                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 uint64_t numberOfThreads);
 
 template storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none,
+                                                 uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb1E(storm::models::sparse::NondeterministicModel<storm::Interval> const& model,
                                                  storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
@@ -2219,7 +2461,7 @@ template storm::storage::BitVector performProb1E(storm::models::sparse::Nondeter
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::models::sparse::NondeterministicModel<storm::Interval> const& model, storm::storage::BitVector const& phiStates,
@@ -2230,7 +2472,8 @@ template storm::storage::BitVector performProbGreater0A(storm::storage::SparseMa
                                                         storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                         bool useStepBound = false, uint_fast64_t maximalSteps = 0,
-                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none,
+                                                        uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb0E(storm::models::sparse::NondeterministicModel<storm::Interval> const& model,
                                                  storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
@@ -2239,17 +2482,19 @@ template storm::storage::BitVector performProb0E(storm::models::sparse::Nondeter
 template storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
-                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 uint64_t numberOfThreads);
 
 template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions,
-                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::storage::SparseMatrix<storm::Interval> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::Interval> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::models::sparse::NondeterministicModel<storm::Interval> const& model, storm::storage::BitVector const& phiStates,
@@ -2296,14 +2541,15 @@ template std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<st
 
 template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<storm::RationalInterval> const& backwardTransitions,
                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                       bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                                       bool useStepBound = false, uint_fast64_t maximalSteps = 0, uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<storm::RationalInterval> const& backwardTransitions,
                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                storm::storage::BitVector const& statesWithProbabilityGreater0);
+                                                storm::storage::BitVector const& statesWithProbabilityGreater0, uint64_t numberOfThreads);
 
 template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<storm::RationalInterval> const& backwardTransitions,
-                                                storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                                                storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(
     storm::models::sparse::DeterministicModel<storm::RationalInterval> const& model, storm::storage::BitVector const& phiStates,
@@ -2311,7 +2557,7 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(
     storm::storage::SparseMatrix<storm::RationalInterval> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<storm::RationalInterval> const& transitionMatrix,
                                             storm::storage::SparseMatrix<storm::RationalInterval> const& backwardTransitions,
@@ -2337,16 +2583,18 @@ template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStat
 
 template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<storm::RationalInterval> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                        bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                                        bool useStepBound = false, uint_fast64_t maximalSteps = 0, uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<storm::RationalInterval> const& backwardTransitions,
-                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 uint64_t numberOfThreads);
 
 template storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<storm::RationalInterval> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<storm::RationalInterval> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none,
+                                                 uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb1E(storm::models::sparse::NondeterministicModel<storm::RationalInterval> const& model,
                                                  storm::storage::SparseMatrix<storm::RationalInterval> const& backwardTransitions,
@@ -2355,7 +2603,7 @@ template storm::storage::BitVector performProb1E(storm::models::sparse::Nondeter
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::storage::SparseMatrix<storm::RationalInterval> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::RationalInterval> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::models::sparse::NondeterministicModel<storm::RationalInterval> const& model, storm::storage::BitVector const& phiStates,
@@ -2366,7 +2614,8 @@ template storm::storage::BitVector performProbGreater0A(storm::storage::SparseMa
                                                         storm::storage::SparseMatrix<storm::RationalInterval> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                         bool useStepBound = false, uint_fast64_t maximalSteps = 0,
-                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none,
+                                                        uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb0E(storm::models::sparse::NondeterministicModel<storm::RationalInterval> const& model,
                                                  storm::storage::SparseMatrix<storm::RationalInterval> const& backwardTransitions,
@@ -2375,17 +2624,19 @@ template storm::storage::BitVector performProb0E(storm::models::sparse::Nondeter
 template storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<storm::RationalInterval> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<storm::RationalInterval> const& backwardTransitions,
-                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 uint64_t numberOfThreads);
 
 template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<storm::RationalInterval> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<storm::RationalInterval> const& backwardTransitions,
-                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::storage::SparseMatrix<storm::RationalInterval> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::RationalInterval> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::models::sparse::NondeterministicModel<storm::RationalInterval> const& model, storm::storage::BitVector const& phiStates,
@@ -2429,14 +2680,15 @@ template std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<st
 
 template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                        storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                       bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                                       bool useStepBound = false, uint_fast64_t maximalSteps = 0, uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                storm::storage::BitVector const& statesWithProbabilityGreater0);
+                                                storm::storage::BitVector const& statesWithProbabilityGreater0, uint64_t numberOfThreads);
 
 template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
-                                                storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                                                storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(
     storm::models::sparse::DeterministicModel<storm::RationalFunction> const& model, storm::storage::BitVector const& phiStates,
@@ -2444,7 +2696,7 @@ template std::pair<storm::storage::BitVector, storm::storage::BitVector> perform
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates,
                                      storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
@@ -2455,16 +2707,18 @@ template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStat
 
 template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                        bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                                        bool useStepBound = false, uint_fast64_t maximalSteps = 0, uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
-                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 uint64_t numberOfThreads);
 
 template storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                  storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+                                                 boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none,
+                                                 uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb1E(storm::models::sparse::NondeterministicModel<storm::RationalFunction> const& model,
                                                  storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
@@ -2473,7 +2727,7 @@ template storm::storage::BitVector performProb1E(storm::models::sparse::Nondeter
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(
     storm::models::sparse::NondeterministicModel<storm::RationalFunction> const& model, storm::storage::BitVector const& phiStates,
@@ -2484,7 +2738,8 @@ template storm::storage::BitVector performProbGreater0A(storm::storage::SparseMa
                                                         storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
                                                         storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
                                                         bool useStepBound = false, uint_fast64_t maximalSteps = 0,
-                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+                                                        boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none,
+                                                        uint64_t numberOfThreads = 1);
 
 template storm::storage::BitVector performProb0E(storm::models::sparse::NondeterministicModel<storm::RationalFunction> const& model,
                                                  storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
@@ -2492,7 +2747,8 @@ template storm::storage::BitVector performProb0E(storm::models::sparse::Nondeter
 template storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
-                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 uint64_t numberOfThreads);
 
 template storm::storage::BitVector performProb1A(storm::models::sparse::NondeterministicModel<storm::RationalFunction> const& model,
                                                  storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
@@ -2500,12 +2756,13 @@ template storm::storage::BitVector performProb1A(storm::models::sparse::Nondeter
 template storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix,
                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                  storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions,
-                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+                                                 storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
+                                                 uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
     storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-    storm::storage::BitVector const& psiStates);
+    storm::storage::BitVector const& psiStates, uint64_t numberOfThreads);
 
 template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(
     storm::models::sparse::NondeterministicModel<storm::RationalFunction> const& model, storm::storage::BitVector const& phiStates,
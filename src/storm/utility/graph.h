@@ -134,11 +134,14 @@ std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<T> const& t
  * @param psiStates A bit vector of all states satisfying psi.
  * @param useStepBound A flag that indicates whether or not to use the given number of maximal steps for the search.
  * @param maximalSteps The maximal number of steps to reach the psi states.
+ * @param numberOfThreads The number of threads used for the search (0 means 'auto-detect'). With more than one thread, the states of each
+ * level of the backward search are processed concurrently.
  * @return A bit vector with all indices of states that have a probability greater than 0.
  */
 template<typename T>
 storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                              storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                              storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0,
+                                              uint64_t numberOfThreads = 1);
 
 /*!
  * Computes the set of states of the given model for which all paths lead to
@@ -152,11 +155,14 @@ storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> co
  * @param psiStates A bit vector of all states satisfying psi.
  * @param statesWithProbabilityGreater0 A reference to a bit vector of states that possess a positive
  * probability mass of satisfying phi until psi.
+ * @param numberOfThreads The number of threads used for the search (0 means 'auto-detect'). With more than one thread, the states of each
+ * level of the backward search are processed concurrently.
  * @return A bit vector with all indices of states that have a probability greater than 1.
  */
 template<typename T>
 storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                       storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0);
+                                       storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0,
+                                       uint64_t numberOfThreads = 1);
 
 /*!
  * Computes the set of states of the given model for which all paths lead to
@@ -168,11 +174,13 @@ storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& ba
  * @param backwardTransitions The reversed transition relation of the graph structure to search.
  * @param phiStates A bit vector of all states satisfying phi.
  * @param psiStates A bit vector of all states satisfying psi.
+ * @param numberOfThreads The number of threads used for the search (0 means 'auto-detect'). With more than one thread, the states of each
+ * level of the backward search are processed concurrently.
  * @return A bit vector with all indices of states that have a probability greater than 1.
  */
 template<typename T>
 storm::storage::BitVector performProb1(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                       storm::storage::BitVector const& psiStates);
+                                       storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
 
 /*!
  * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi until psi in a
@@ -196,13 +204,15 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(st
  * @param backwardTransitions The backward transitions of the model whose graph structure to search.
  * @param phiStates The set of all states satisfying phi.
  * @param psiStates The set of all states satisfying psi.
+ * @param numberOfThreads The number of threads used for the search (0 means 'auto-detect'). With more than one thread, the states of each
+ * level of the backward search are processed concurrently.
  * @return A pair of bit vectors such that the first bit vector stores the indices of all states
  * with probability 0 and the second stores all indices of states with probability 1.
  */
 template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                               storm::storage::BitVector const& phiStates,
-                                                                              storm::storage::BitVector const& psiStates);
+                                                                              storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
 
 /*!
  * Computes the set of states that has a positive probability of reaching psi states after only passing
@@ -375,15 +385,18 @@ void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm
  * @param psiStates The set of all states satisfying psi.
  * @param useStepBound A flag that indicates whether or not to use the given number of maximal steps for the search.
  * @param maximalSteps The maximal number of steps to reach the psi states.
+ * @param numberOfThreads The number of threads used for the search (0 means 'auto-detect'). With more than one thread, the states of each
+ * level of the backward search are processed concurrently.
  * @return A bit vector that represents all states with probability 0.
  */
 template<typename T>
 storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                               storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+                                               storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0,
+                                               uint64_t numberOfThreads = 1);
 
 template<typename T>
 storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                        storm::storage::BitVector const& psiStates);
+                                        storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
 
 /*!
  * Computes the sets of states that have probability 1 of satisfying phi until psi under at least
@@ -396,6 +409,8 @@ storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<T> const& b
  * @param phiStates The set of all states satisfying phi.
  * @param psiStates The set of all states satisfying psi.
  * @param choiceConstraint If given, only the selected choices are considered.
+ * @param numberOfThreads The number of threads used for the search (0 means 'auto-detect'). With more than one thread, the states of each
+ * level of the backward search are processed concurrently.
  * @return A bit vector that represents all states with probability 1.
  */
 template<typename T>
@@ -403,7 +418,7 @@ storm::storage::BitVector performProb1E(storm::storage::SparseMatrix<T> const& t
                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                         storm::storage::BitVector const& psiStates,
-                                        boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+                                        boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none, uint64_t numberOfThreads = 1);
 
 /*!
  * Computes the sets of states that have probability 1 of satisfying phi until psi under at least
@@ -427,7 +442,7 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max
                                                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
-                                                                                 storm::storage::BitVector const& psiStates);
+                                                                                 storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
 
 /*!
  * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi
@@ -457,6 +472,8 @@ std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max
  * @param useStepBound A flag that indicates whether or not to use the given number of maximal steps for the search.
  * @param maximalSteps The maximal number of steps to reach the psi states.
  * @param choiceConstraint If set, we assume that only the specified choices exist in the model
+ * @param numberOfThreads The number of threads used for the search (0 means 'auto-detect'). With more than one thread, the states of each
+ * level of the backward search are processed concurrently.
  * @return A bit vector that represents all states with probability 0.
  */
 template<typename T>
@@ -464,7 +481,7 @@ storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> c
                                                std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
                                                storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0,
-                                               boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none);
+                                               boost::optional<storm::storage::BitVector> const& choiceConstraint = boost::none, uint64_t numberOfThreads = 1);
 
 /*!
  * Computes the sets of states that have probability 0 of satisfying phi until psi under at least
@@ -486,7 +503,7 @@ template<typename T>
 storm::storage::BitVector performProb0E(storm::storage::SparseMatrix<T> const& transitionMatrix,
                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                        storm::storage::BitVector const& psiStates);
+                                        storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
 
 /*!
  * Computes the sets of states that have probability 1 of satisfying phi until psi under all
@@ -509,14 +526,14 @@ template<typename T>
 storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& transitionMatrix,
                                         std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                         storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-                                        storm::storage::BitVector const& psiStates);
+                                        storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
 
 template<typename T>
 std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<T> const& transitionMatrix,
                                                                                  std::vector<uint_fast64_t> const& nondeterministicChoiceIndices,
                                                                                  storm::storage::SparseMatrix<T> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
-                                                                                 storm::storage::BitVector const& psiStates);
+                                                                                 storm::storage::BitVector const& psiStates, uint64_t numberOfThreads = 1);
 
 /*!
  * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi
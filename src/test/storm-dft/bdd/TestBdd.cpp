@@ -121,6 +121,29 @@ TEST_P(SftBddTest, RRW) {
     expectVectorNear(checker->getAllRRWsAtTimebound(1), param.RRW);
 }
 
+TEST_P(SftBddTest, ImportanceAtTimepointsConcurrent) {
+    auto const &param{TestWithParam::GetParam()};
+    std::vector<double> const timepoints{0.5, 1, 2, 1};
+    checker->setNumberOfThreads(2);
+
+    auto const birnbaumFactors{checker->getAllBirnbaumFactorsAtTimepoints(timepoints, 1)};
+    auto const rrws{checker->getAllRRWsAtTimepoints(timepoints, 1)};
+    ASSERT_EQ(birnbaumFactors.size(), param.birnbaum.size());
+    ASSERT_EQ(rrws.size(), param.RRW.size());
+    for (size_t i{0}; i < birnbaumFactors.size(); ++i) {
+        ASSERT_EQ(birnbaumFactors[i].size(), timepoints.size());
+        expectVectorNear(std::vector<double>{birnbaumFactors[i][1], birnbaumFactors[i][3]}, std::vector<double>{param.birnbaum[i], param.birnbaum[i]});
+        expectVectorNear(std::vector<double>{rrws[i][1], rrws[i][3]}, std::vector<double>{param.RRW[i], param.RRW[i]});
+    }
+
+    // The chunking must not influence the result
+    checker->setNumberOfThreads(1);
+    auto const sequentialBirnbaumFactors{checker->getAllBirnbaumFactorsAtTimepoints(timepoints, 0)};
+    for (size_t i{0}; i < birnbaumFactors.size(); ++i) {
+        expectVectorNear(birnbaumFactors[i], sequentialBirnbaumFactors[i]);
+    }
+}
+
 std::vector<SftTestData> sftTestData{
     {
         "And",
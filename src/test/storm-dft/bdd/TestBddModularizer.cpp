@@ -19,12 +19,14 @@ class BddModularizerTest : public testing::TestWithParam<ModularizerTestData> {
         auto const &param{TestWithParam::GetParam()};
         auto dft{storm::dft::api::loadDFTGalileoFile<double>(param.filepath)};
         checker = std::make_shared<storm::dft::modelchecker::DftModularizationChecker<double>>(dft);
+        concurrentChecker = std::make_shared<storm::dft::modelchecker::DftModularizationChecker<double>>(dft, 4);
 #else
         GTEST_SKIP() << "Library Sylvan not available.";
 #endif
     }
 
     std::shared_ptr<storm::dft::modelchecker::DftModularizationChecker<double>> checker;
+    std::shared_ptr<storm::dft::modelchecker::DftModularizationChecker<double>> concurrentChecker;
 };
 
 TEST_P(BddModularizerTest, ProbabilityAtTimeOne) {
@@ -32,6 +34,13 @@ TEST_P(BddModularizerTest, ProbabilityAtTimeOne) {
     EXPECT_NEAR(checker->getProbabilityAtTimebound(1), param.probabilityAtTimeboundOne, 1e-6);
 }
 
+TEST_P(BddModularizerTest, ProbabilityAtTimeOneConcurrent) {
+    auto const &param{TestWithParam::GetParam()};
+    EXPECT_NEAR(concurrentChecker->getProbabilityAtTimebound(1), param.probabilityAtTimeboundOne, 1e-6);
+    auto const probabilities{concurrentChecker->getProbabilitiesAtTimepoints({0.5, 1, 2})};
+    EXPECT_EQ(checker->getProbabilitiesAtTimepoints({0.5, 1, 2}), probabilities);
+}
+
 std::vector<ModularizerTestData> modularizerTestData{
     {
         "And",
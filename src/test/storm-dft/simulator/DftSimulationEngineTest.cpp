@@ -0,0 +1,76 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-dft/api/storm-dft.h"
+#include "storm-dft/simulator/DFTSimulationEngine.h"
+#include "storm-dft/simulator/ImportanceFunction.h"
+#include "storm-dft/storage/DftSymmetries.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace {
+
+std::pair<std::shared_ptr<storm::dft::storage::DFT<double>>, storm::dft::storage::DFTStateGenerationInfo> prepareDFT(std::string const& file) {
+    // Load, build and prepare DFT
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft =
+        storm::dft::api::prepareForMarkovAnalysis<double>(*(storm::dft::api::loadDFTGalileoFile<double>(file)));
+    EXPECT_TRUE(storm::dft::api::isWellFormed(*dft).first);
+
+    // Set relevant events
+    storm::dft::utility::RelevantEvents relevantEvents = storm::dft::api::computeRelevantEvents({}, {});
+    dft->setRelevantEvents(relevantEvents, false);
+
+    storm::dft::storage::DFTStateGenerationInfo stateGenerationInfo(dft->buildStateGenerationInfo(storm::dft::storage::DftSymmetries()));
+    return std::make_pair(dft, stateGenerationInfo);
+}
+
+TEST(DftSimulationEngineTest, AndUnreliability) {
+    auto [dft, stateGenerationInfo] = prepareDFT(STORM_TEST_RESOURCES_DIR "/dft/and.dft");
+    storm::dft::simulator::DFTSimulationEngine<double>::Options options;
+    options.numberOfThreads = 4;
+    storm::dft::simulator::DFTSimulationEngine<double> engine(*dft, stateGenerationInfo, options);
+
+    auto result = engine.estimateUnreliability(2, 10000);
+    EXPECT_NEAR(result.estimate, 0.3995764009, 0.01);
+    EXPECT_EQ(result.numberOfTraces, 10000ul);
+    EXPECT_EQ(result.numberOfSimulatedTraces, 10000ul);
+    EXPECT_LT(result.lowerBound, result.estimate);
+    EXPECT_GT(result.upperBound, result.estimate);
+    EXPECT_NEAR(result.upperBound - result.lowerBound, 2 * 1.959964 * result.standardError, 1e-6);
+}
+
+TEST(DftSimulationEngineTest, Reproducibility) {
+    auto [dft, stateGenerationInfo] = prepareDFT(STORM_TEST_RESOURCES_DIR "/dft/voting.dft");
+    storm::dft::simulator::DFTSimulationEngine<double>::Options options;
+    options.batchSize = 100;
+    storm::dft::simulator::DFTSimulationEngine<double> sequentialEngine(*dft, stateGenerationInfo, options);
+    options.numberOfThreads = 4;
+    storm::dft::simulator::DFTSimulationEngine<double> parallelEngine(*dft, stateGenerationInfo, options);
+
+    // Results only depend on the seed and not on the number of threads
+    auto sequentialResult = sequentialEngine.estimateUnreliability(1, 5000);
+    auto parallelResult = parallelEngine.estimateUnreliability(1, 5000);
+    EXPECT_EQ(sequentialResult.estimate, parallelResult.estimate);
+    EXPECT_EQ(sequentialResult.standardError, parallelResult.standardError);
+    EXPECT_NEAR(parallelResult.estimate, 0.4511883639, 0.02);
+}
+
+TEST(DftSimulationEngineTest, ImportanceSplitting) {
+    auto [dft, stateGenerationInfo] = prepareDFT(STORM_TEST_RESOURCES_DIR "/dft/and.dft");
+    storm::dft::simulator::DFTSimulationEngine<double>::Options options;
+    options.numberOfThreads = 4;
+    storm::dft::simulator::DFTSimulationEngine<double> engine(*dft, stateGenerationInfo, options);
+    storm::dft::simulator::BECountImportanceFunction<double> importanceFunction(*dft);
+
+    auto result = engine.estimateUnreliability(2, 5000, importanceFunction, {1}, {4});
+    EXPECT_NEAR(result.estimate, 0.3995764009, 0.01);
+    EXPECT_EQ(result.numberOfTraces, 5000ul);
+    EXPECT_GT(result.numberOfSimulatedTraces, result.numberOfTraces);
+
+    // Rare event: (1-exp(-0.05))^2
+    result = engine.estimateUnreliability(0.1, 20000, importanceFunction, {1}, {20});
+    EXPECT_NEAR(result.estimate, 0.0023785690, 0.0005);
+
+    STORM_SILENT_EXPECT_THROW(engine.estimateUnreliability(2, 10, importanceFunction, {1, 1}, {2, 2}), storm::exceptions::InvalidArgumentException);
+}
+
+}  // namespace
@@ -0,0 +1,42 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-dft/storage/DFTStatePool.h"
+
+namespace {
+
+TEST(DFTStatePoolTest, StoreAndRetrieve) {
+    // Use a size which spans multiple words and is not aligned
+    uint64_t const stateSize = 150;
+    storm::dft::storage::DFTStatePool pool(stateSize);
+
+    std::vector<storm::storage::BitVector> states;
+    std::vector<uint64_t> slots;
+    for (uint64_t i = 0; i < 10; ++i) {
+        storm::storage::BitVector state(stateSize);
+        for (uint64_t bit = i; bit < stateSize; bit += i + 1) {
+            state.set(bit);
+        }
+        slots.push_back(pool.add(state));
+        states.push_back(state);
+    }
+    EXPECT_EQ(10ul, pool.size());
+    EXPECT_EQ(stateSize, pool.getStateSize());
+    for (uint64_t i = 0; i < states.size(); ++i) {
+        EXPECT_EQ(states[i], pool.get(slots[i]));
+    }
+
+    // Released slots are reused
+    pool.release(slots[3]);
+    EXPECT_EQ(9ul, pool.size());
+    storm::storage::BitVector full(stateSize, true);
+    uint64_t slot = pool.add(full);
+    EXPECT_EQ(slots[3], slot);
+    EXPECT_EQ(10ul, pool.size());
+    EXPECT_EQ(full, pool.get(slot));
+    // Other states are not affected
+    EXPECT_EQ(states[2], pool.get(slots[2]));
+    EXPECT_EQ(states[4], pool.get(slots[4]));
+}
+
+}  // namespace
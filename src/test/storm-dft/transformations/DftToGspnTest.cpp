@@ -0,0 +1,91 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-dft/api/storm-dft.h"
+#include "storm-gspn/api/storm-gspn.h"
+#include "storm-gspn/builder/ExplicitGspnModelBuilder.h"
+#include "storm-gspn/storage/gspn/GspnBuilder.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm/api/storm.h"
+#include "storm/builder/BuilderOptions.h"
+
+namespace {
+
+std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> buildExplicitModel(storm::gspn::GSPN const& gspn, uint64_t toplevelFailedPlace) {
+    auto const& exprManager = gspn.getExpressionManager();
+    auto failedVariable = exprManager->getVariable(gspn.getPlace(toplevelFailedPlace)->getName());
+    return storm::api::buildExplicitGspnModel(gspn, {}, {{"failed", failedVariable.getExpression() == exprManager->integer(1)}});
+}
+
+double analyzeMTTF(std::string const& file) {
+    auto dft = storm::dft::api::loadDFTGalileoFile<double>(file);
+    auto [gspn, toplevelFailedPlace] = storm::dft::api::transformToGSPN(*dft);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = buildExplicitModel(*gspn, toplevelFailedPlace);
+
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parseProperties("Tmin=? [F \"failed\"]"));
+    auto result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formulas[0], true));
+    return result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()];
+}
+
+void compareWithJani(std::string const& file) {
+    auto dft = storm::dft::api::loadDFTGalileoFile<double>(file);
+    auto [gspn, toplevelFailedPlace] = storm::dft::api::transformToGSPN(*dft);
+    auto explicitModel = buildExplicitModel(*gspn, toplevelFailedPlace);
+
+    auto janiModel = storm::dft::api::transformToJani(*gspn, toplevelFailedPlace);
+    storm::builder::BuilderOptions options;
+    options.setApplyMaximalProgressAssumption();
+    auto janiBasedModel = storm::api::buildSparseModel<double>(*janiModel, options)->as<storm::models::sparse::MarkovAutomaton<double>>();
+
+    EXPECT_EQ(janiBasedModel->getNumberOfStates(), explicitModel->getNumberOfStates());
+    EXPECT_EQ(janiBasedModel->getNumberOfChoices(), explicitModel->getNumberOfChoices());
+    EXPECT_EQ(janiBasedModel->getNumberOfTransitions(), explicitModel->getNumberOfTransitions());
+    EXPECT_EQ(janiBasedModel->getMarkovianStates().getNumberOfSetBits(), explicitModel->getMarkovianStates().getNumberOfSetBits());
+}
+
+TEST(DftToGspnTest, ExplicitBuilderMatchesJani) {
+    compareWithJani(STORM_TEST_RESOURCES_DIR "/dft/and.dft");
+    compareWithJani(STORM_TEST_RESOURCES_DIR "/dft/or.dft");
+    compareWithJani(STORM_TEST_RESOURCES_DIR "/dft/voting.dft");
+    compareWithJani(STORM_TEST_RESOURCES_DIR "/dft/spare.dft");
+}
+
+TEST(DftToGspnTest, ExplicitBuilderMTTF) {
+    EXPECT_NEAR(analyzeMTTF(STORM_TEST_RESOURCES_DIR "/dft/and.dft"), 3, 1e-6);
+    EXPECT_NEAR(analyzeMTTF(STORM_TEST_RESOURCES_DIR "/dft/voting.dft"), 5 / 3.0, 1e-6);
+}
+
+TEST(DftToGspnTest, ExplicitBuilderInfiniteServer) {
+    storm::gspn::GspnBuilder gspnBuilder;
+    gspnBuilder.setGspnName("infinite_server");
+    gspnBuilder.addPlace(2, 2, "p0");
+    gspnBuilder.addPlace(2, 0, "p1");
+    gspnBuilder.addTimedTransition(0, 1.5, boost::none, "t0");
+    gspnBuilder.addInputArc("p0", "t0");
+    gspnBuilder.addOutputArc("t0", "p1");
+    std::unique_ptr<storm::gspn::GSPN> gspn(gspnBuilder.buildGspn());
+
+    storm::builder::ExplicitGspnModelBuilder<double> builder(*gspn);
+    EXPECT_EQ(64ul, builder.getNumberOfBitsPerMarking());
+    auto model = builder.build();
+
+    // Markings (2,0) -> (1,1) -> (0,2) where the last marking is a deadlock
+    ASSERT_EQ(3ul, model->getNumberOfStates());
+    EXPECT_EQ(3ul, model->getNumberOfChoices());
+    EXPECT_EQ(3ul, model->getMarkovianStates().getNumberOfSetBits());
+    EXPECT_TRUE(model->getStates("init").get(0));
+    EXPECT_EQ(1ul, model->getStates("deadlock").getNumberOfSetBits());
+    EXPECT_TRUE(model->getStates("deadlock").get(2));
+    EXPECT_NEAR(3.0, model->getExitRates()[0], 1e-12);
+    EXPECT_NEAR(1.5, model->getExitRates()[1], 1e-12);
+
+    // The atomic expression of the property is added as a label
+    storm::parser::FormulaParser formulaParser(gspn->getExpressionManager());
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parseProperties(formulaParser, "Tmin=? [F p1=2]"));
+    std::shared_ptr<storm::models::sparse::Model<double>> labeledModel = storm::api::buildExplicitGspnModel(*gspn, formulas);
+    auto result = storm::api::verifyWithSparseEngine<double>(labeledModel, storm::api::createTask<double>(formulas[0], true));
+    EXPECT_NEAR(1.0, result->asExplicitQuantitativeCheckResult<double>()[*labeledModel->getInitialStates().begin()], 1e-6);
+}
+
+}  // namespace
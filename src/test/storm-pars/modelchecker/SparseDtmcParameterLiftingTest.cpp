@@ -144,6 +144,43 @@ TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_no_simplification) {
               regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown, true));
 }
 
+TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Prob_ConcurrentPartitioning) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P<=0.84 [F s=5 ]";
+
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<const storm::logic::Formula>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> model =
+        storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+
+    auto modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+    auto region = storm::api::parseRegion<storm::RationalFunction>("0.1<=pL<=0.9,0.1<=pK<=0.9", modelParameters);
+
+    // The coverage threshold is reached in the middle of a batch of regions, which must not affect the resulting partition
+    std::set<storm::RationalFunctionVariable> discreteVariables;
+    auto partition = [&](uint64_t numberOfThreads) {
+        storm::api::RefinementOptions<storm::RationalFunction> options(model, storm::api::createTask<storm::RationalFunction>(formulas[0], true),
+                                                                      TypeParam::regionEngine, storm::modelchecker::RegionSplittingStrategy(),
+                                                                      storm::api::MonotonicitySetting(), discreteVariables);
+        options.numberOfThreads = numberOfThreads;
+        auto refinementChecker = storm::api::initializeRegionRefinementChecker<storm::RationalFunction>(this->env(), options);
+        return refinementChecker->performRegionPartitioning(this->env(), region, storm::utility::convertNumber<storm::RationalFunction>(0.1), 10);
+    };
+    auto sequentialResult = partition(1);
+    auto concurrentResult = partition(4);
+
+    auto const& sequentialRegions = sequentialResult->getRegionResults();
+    auto const& concurrentRegions = concurrentResult->getRegionResults();
+    ASSERT_EQ(sequentialRegions.size(), concurrentRegions.size());
+    for (uint64_t regionIndex = 0; regionIndex < sequentialRegions.size(); ++regionIndex) {
+        EXPECT_EQ(sequentialRegions[regionIndex].first.toString(), concurrentRegions[regionIndex].first.toString());
+        EXPECT_EQ(sequentialRegions[regionIndex].second, concurrentRegions[regionIndex].second);
+    }
+}
+
 TYPED_TEST(SparseDtmcParameterLiftingTest, Brp_Rew) {
     std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp_rewards16_2.pm";
     std::string formulaAsString = "R>2.5 [F ((s=5) | (s=0&srep=3)) ]";
@@ -0,0 +1,110 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm-pars/utility/CompiledRationalFunctions.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+
+namespace {
+
+class CompiledRationalFunctionsTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+#ifndef STORM_HAVE_Z3
+        GTEST_SKIP() << "Z3 not available.";
+#endif
+    }
+
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> buildDtmc(std::string const& programFile, std::string const& formulaAsString) {
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+        return storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    }
+
+    std::vector<std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>> getValuations(
+        std::set<storm::RationalFunctionVariable> const& parameters) const {
+        std::vector<std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>> valuations(1);
+        for (auto const& parameter : parameters) {
+            std::vector<std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient>> newValuations;
+            for (auto const& valuation : valuations) {
+                for (uint64_t i = 1; i < 10; ++i) {
+                    newValuations.push_back(valuation);
+                    newValuations.back()[parameter] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(i) / 10;
+                }
+            }
+            valuations = std::move(newValuations);
+        }
+        return valuations;
+    }
+
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+};
+
+TEST_F(CompiledRationalFunctionsTest, EvaluateResultFunction) {
+    auto dtmc = buildDtmc(STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm", "P=? [F s=5 ]");
+    // The parametric result of the property is a rational function over both parameters.
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>> checker(*dtmc);
+    auto result = checker.check(storm::Environment(), *formulas.front());
+    auto const& resultFunction = result->asExplicitQuantitativeCheckResult<storm::RationalFunction>()[*dtmc->getInitialStates().begin()];
+
+    storm::utility::CompiledRationalFunctions<double> compiledFunctions;
+    EXPECT_EQ(0ull, compiledFunctions.addFunction(resultFunction));
+    EXPECT_EQ(1ull, compiledFunctions.addFunction(storm::utility::convertNumber<storm::RationalFunction>(0.25)));
+    ASSERT_EQ(2ull, compiledFunctions.getNumberOfFunctions());
+    EXPECT_EQ(2ull, compiledFunctions.getParameters().size());
+
+    auto valuations = getValuations(storm::models::sparse::getProbabilityParameters(*dtmc));
+    uint64_t const numberOfPoints = valuations.size();
+    std::vector<double> parameterValues(compiledFunctions.getParameters().size() * numberOfPoints);
+    for (uint64_t point = 0; point < numberOfPoints; ++point) {
+        auto pointParameterValues = compiledFunctions.getParameterValues(valuations[point]);
+        for (uint64_t parameter = 0; parameter < pointParameterValues.size(); ++parameter) {
+            parameterValues[parameter * numberOfPoints + point] = pointParameterValues[parameter];
+        }
+    }
+    std::vector<double> functionValues;
+    compiledFunctions.evaluate(parameterValues, numberOfPoints, functionValues);
+    ASSERT_EQ(2 * numberOfPoints, functionValues.size());
+
+    std::vector<double> singlePointFunctionValues;
+    for (uint64_t point = 0; point < numberOfPoints; ++point) {
+        double expected = storm::utility::convertNumber<double>(resultFunction.evaluate(valuations[point]));
+        EXPECT_NEAR(expected, functionValues[point], 1e-10);
+        EXPECT_EQ(0.25, functionValues[numberOfPoints + point]);
+
+        compiledFunctions.evaluate(compiledFunctions.getParameterValues(valuations[point]), singlePointFunctionValues);
+        ASSERT_EQ(2ull, singlePointFunctionValues.size());
+        EXPECT_NEAR(expected, singlePointFunctionValues[0], 1e-10);
+    }
+}
+
+TEST_F(CompiledRationalFunctionsTest, CheckBatch) {
+    auto dtmc = buildDtmc(STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm", "P=? [F s=5 ]");
+    storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction> checkTask(*formulas.front(), true);
+    auto valuations = getValuations(storm::models::sparse::getProbabilityParameters(*dtmc));
+    uint64_t const initialState = *dtmc->getInitialStates().begin();
+    storm::Environment env;
+
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> sequentialChecker(*dtmc);
+    sequentialChecker.specifyFormula(checkTask);
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> batchChecker(*dtmc);
+    batchChecker.specifyFormula(checkTask);
+    batchChecker.setInstantiationsAreGraphPreserving(true);
+    batchChecker.setNumberOfThreads(2);
+
+    std::vector<storm::utility::Stopwatch> stopwatches;
+    auto results = batchChecker.checkBatch(env, valuations, &stopwatches);
+    ASSERT_EQ(valuations.size(), results.size());
+    ASSERT_EQ(valuations.size(), stopwatches.size());
+    for (uint64_t i = 0; i < valuations.size(); ++i) {
+        double expected = sequentialChecker.check(env, valuations[i])->asExplicitQuantitativeCheckResult<double>()[initialState];
+        EXPECT_NEAR(expected, results[i]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+    }
+}
+}  // namespace
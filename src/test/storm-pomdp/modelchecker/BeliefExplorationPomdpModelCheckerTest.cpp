@@ -120,6 +120,27 @@ class RefineDoubleVIEnvironment {
     }
 };
 
+class ParallelRefineDoubleVIEnvironment {
+   public:
+    typedef double ValueType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+    static bool const isExactModelChecking = false;
+    static ValueType precision() {
+        return storm::utility::convertNumber<ValueType>(0.005);
+    }
+    static PreprocessingType const preprocessingType = PreprocessingType::None;
+    static void adaptOptions(storm::pomdp::modelchecker::BeliefExplorationPomdpModelCheckerOptions<ValueType>& options) {
+        options.refine = true;
+        options.refinePrecision = precision();
+        options.explorationThreads = 2;
+    }
+};
+
 class PreprocessedRefineDoubleVIEnvironment {
    public:
     typedef double ValueType;
@@ -291,8 +312,9 @@ class BeliefExplorationPomdpModelCheckerTest : public ::testing::Test {
 };
 
 typedef ::testing::Types<DefaultDoubleVIEnvironment, SelfloopReductionDefaultDoubleVIEnvironment, QualitativeReductionDefaultDoubleVIEnvironment,
-                         PreprocessedDefaultDoubleVIEnvironment, FineDoubleVIEnvironment, RefineDoubleVIEnvironment, PreprocessedRefineDoubleVIEnvironment,
-                         DefaultDoubleOVIEnvironment, DefaultRationalPIEnvironment, PreprocessedDefaultRationalPIEnvironment>
+                         PreprocessedDefaultDoubleVIEnvironment, FineDoubleVIEnvironment, RefineDoubleVIEnvironment, ParallelRefineDoubleVIEnvironment,
+                         PreprocessedRefineDoubleVIEnvironment, DefaultDoubleOVIEnvironment, DefaultRationalPIEnvironment,
+                         PreprocessedDefaultRationalPIEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(BeliefExplorationPomdpModelCheckerTest, TestingTypes, );
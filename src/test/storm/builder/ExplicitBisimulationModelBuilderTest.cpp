@@ -0,0 +1,75 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/ExplicitBisimulationModelBuilder.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
+
+class ExplicitBisimulationModelBuilderTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+#ifndef STORM_HAVE_Z3
+        GTEST_SKIP() << "Z3 not available.";
+#endif
+    }
+
+    // Builds the quotient during exploration and compares it to the quotient of the full model.
+    template<typename ModelType>
+    void compareWithFullQuotient(storm::prism::Program const& program, uint64_t minimizationThreshold) {
+        storm::builder::BuilderOptions generatorOptions(true, true);
+
+        auto fullModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+        fullModel->reduceToStateBasedRewards();
+        storm::storage::DeterministicModelBisimulationDecomposition<ModelType> decomposition(*fullModel->template as<ModelType>());
+        decomposition.computeBisimulationDecomposition();
+        auto expectedQuotient = decomposition.getQuotient();
+
+        typename storm::builder::ExplicitBisimulationModelBuilder<double>::Options builderOptions;
+        builderOptions.minimizationThreshold = minimizationThreshold;
+        storm::builder::ExplicitBisimulationModelBuilder<double> builder(program, generatorOptions, builderOptions);
+        auto quotient = builder.build();
+
+        EXPECT_EQ(fullModel->getNumberOfStates(), builder.getNumberOfExploredStates());
+        EXPECT_EQ(expectedQuotient->getType(), quotient->getType());
+        EXPECT_EQ(expectedQuotient->getNumberOfStates(), quotient->getNumberOfStates());
+        EXPECT_EQ(expectedQuotient->getNumberOfTransitions(), quotient->getNumberOfTransitions());
+        EXPECT_EQ(expectedQuotient->getInitialStates().getNumberOfSetBits(), quotient->getInitialStates().getNumberOfSetBits());
+        EXPECT_EQ(expectedQuotient->getNumberOfRewardModels(), quotient->getNumberOfRewardModels());
+        EXPECT_EQ(expectedQuotient->getStateLabeling().getLabels(), quotient->getStateLabeling().getLabels());
+        for (auto const& label : quotient->getStateLabeling().getLabels()) {
+            EXPECT_EQ(expectedQuotient->getStates(label).getNumberOfSetBits(), quotient->getStates(label).getNumberOfSetBits()) << "Label " << label;
+        }
+    }
+};
+
+TEST_F(ExplicitBisimulationModelBuilderTest, Dtmc) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    compareWithFullQuotient<storm::models::sparse::Dtmc<double>>(program, 1);
+    compareWithFullQuotient<storm::models::sparse::Dtmc<double>>(program, 1000);
+
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm");
+    compareWithFullQuotient<storm::models::sparse::Dtmc<double>>(program, 1);
+    compareWithFullQuotient<storm::models::sparse::Dtmc<double>>(program, 100);
+
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    compareWithFullQuotient<storm::models::sparse::Dtmc<double>>(program, 1);
+    compareWithFullQuotient<storm::models::sparse::Dtmc<double>>(program, 1000);
+}
+
+TEST_F(ExplicitBisimulationModelBuilderTest, Ctmc) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm", true);
+    compareWithFullQuotient<storm::models::sparse::Ctmc<double>>(program, 1);
+    compareWithFullQuotient<storm::models::sparse::Ctmc<double>>(program, 100);
+}
+
+TEST_F(ExplicitBisimulationModelBuilderTest, Mdp) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    storm::builder::ExplicitBisimulationModelBuilder<double> builder(program);
+    STORM_SILENT_EXPECT_THROW(builder.build(), storm::exceptions::NotSupportedException);
+}
@@ -208,6 +208,32 @@ TEST_F(ExplicitJaniModelBuilderTest, Ma) {
     EXPECT_EQ(1530ul, model->as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates().getNumberOfSetBits());
 }
 
+TEST_F(ExplicitJaniModelBuilderTest, ConcurrentExplorationViaApi) {
+    storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions, concurrentOptions;
+    sequentialOptions.numberOfThreads = 1;
+    concurrentOptions.numberOfThreads = 4;
+    storm::builder::BuilderOptions options(true, true);
+
+    auto janiModel = getJaniModelFromPrism("/dtmc/crowds-5-5.pm");
+    auto expected = storm::api::buildSparseModel<double>(janiModel, options, sequentialOptions);
+    auto model = storm::api::buildSparseModel<double>(janiModel, options, concurrentOptions);
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+    EXPECT_EQ(expected->getTransitionMatrix(), model->getTransitionMatrix());
+    EXPECT_EQ(expected->getStateLabeling(), model->getStateLabeling());
+
+    janiModel = storm::api::parseJaniModel(STORM_TEST_RESOURCES_DIR "/ma/ftwc.jani").first;
+    auto constants = storm::utility::cli::parseConstantDefinitionString(janiModel.getManager(), "N=2,TIME_BOUND=1");
+    janiModel = janiModel.defineUndefinedConstants(constants);
+    expected = storm::api::buildSparseModel<double>(janiModel, options, sequentialOptions);
+    model = storm::api::buildSparseModel<double>(janiModel, options, concurrentOptions);
+    EXPECT_EQ(1536ul, model->getNumberOfStates());
+    EXPECT_EQ(expected->getTransitionMatrix(), model->getTransitionMatrix());
+    EXPECT_EQ(expected->getStateLabeling(), model->getStateLabeling());
+    ASSERT_TRUE(model->isOfType(storm::models::ModelType::MarkovAutomaton));
+    EXPECT_EQ(expected->as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates(),
+              model->as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates());
+}
+
 TEST_F(ExplicitJaniModelBuilderTest, FailComposition) {
     auto janiModel = getJaniModelFromPrism("/mdp/system_composition.nm");
 
@@ -2,6 +2,7 @@
 #include "test/storm_gtest.h"
 
 #include "storm-parsers/parser/PrismParser.h"
+#include "storm/api/builder.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/generator/PrismNextStateGenerator.h"
@@ -266,3 +267,48 @@ TEST_F(ExplicitPrismModelBuilderTest, CallbackActionMask) {
     EXPECT_EQ(13ul, model->getNumberOfStates());
     EXPECT_EQ(20ul, model->getNumberOfTransitions());
 }
+
+TEST_F(ExplicitPrismModelBuilderTest, ConcurrentExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions, concurrentOptions;
+    sequentialOptions.numberOfThreads = 1;
+    concurrentOptions.numberOfThreads = 4;
+
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+    auto expected = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, sequentialOptions).build();
+    auto model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, concurrentOptions).build();
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+    EXPECT_EQ(expected->getTransitionMatrix(), model->getTransitionMatrix());
+    EXPECT_EQ(expected->getStateLabeling(), model->getStateLabeling());
+
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+    generatorOptions = storm::generator::NextStateGeneratorOptions(true, true);
+    generatorOptions.setBuildChoiceLabels();
+    generatorOptions.setBuildStateValuations();
+    expected = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, sequentialOptions).build();
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, concurrentOptions).build();
+    EXPECT_EQ(1038ul, model->getNumberOfStates());
+    EXPECT_EQ(expected->getTransitionMatrix(), model->getTransitionMatrix());
+    EXPECT_EQ(expected->getStateLabeling(), model->getStateLabeling());
+    EXPECT_EQ(expected->getChoiceLabeling(), model->getChoiceLabeling());
+    EXPECT_EQ(expected->getRewardModel("time").getStateActionRewardVector(), model->getRewardModel("time").getStateActionRewardVector());
+    for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+        EXPECT_EQ(expected->getStateValuations().toString(state), model->getStateValuations().toString(state));
+    }
+}
+
+TEST_F(ExplicitPrismModelBuilderTest, ConcurrentExplorationViaApi) {
+    storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions, concurrentOptions;
+    sequentialOptions.numberOfThreads = 1;
+    concurrentOptions.numberOfThreads = 4;
+
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+    storm::builder::BuilderOptions options(true, true);
+    options.setBuildChoiceLabels();
+    auto expected = storm::api::buildSparseModel<double>(program, options, sequentialOptions);
+    auto model = storm::api::buildSparseModel<double>(program, options, concurrentOptions);
+    EXPECT_EQ(1038ul, model->getNumberOfStates());
+    EXPECT_EQ(expected->getTransitionMatrix(), model->getTransitionMatrix());
+    EXPECT_EQ(expected->getStateLabeling(), model->getStateLabeling());
+    EXPECT_EQ(expected->getChoiceLabeling(), model->getChoiceLabeling());
+}
@@ -9,11 +9,13 @@
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/TimeBoundedSolverEnvironment.h"
 #include "storm/logic/Formulas.h"
 #include "storm/modelchecker/csl/HybridCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
@@ -530,6 +532,95 @@ TEST(CtmcCslModelCheckerTest, TransientProbabilities) {
     EXPECT_NEAR(0.595957, result[1], 1e-6);
 }
 
+TEST(CtmcCslModelCheckerTest, TransientProbabilitiesMultipleTimeBounds) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+    matrixBuilder.addNextValue(0, 1, 3.0);
+    matrixBuilder.addNextValue(1, 0, 2.0);
+    matrixBuilder.addNextValue(1, 2, 0.5);
+    matrixBuilder.addNextValue(2, 0, 1.0);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    std::vector<double> exitRates = {3, 2.5, 1};
+    storm::storage::BitVector initialStates(3);
+    initialStates.set(0);
+    storm::storage::BitVector phiStates(3);
+    storm::storage::BitVector psiStates(3);
+    std::vector<double> timeBounds = {0.0, 0.5, 1.0, 4.0, 20.0};
+    storm::Environment env;
+    env.solver().timeBounded().setNumberOfThreads(2);
+    std::vector<std::vector<double>> results = storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(
+        env, matrix, initialStates, phiStates, psiStates, exitRates, timeBounds);
+    ASSERT_EQ(timeBounds.size(), results.size());
+    EXPECT_EQ(1.0, results[0][0]);
+
+    // With a single thread, each individual time bound is computed by the original (multiplier-based) algorithm
+    env.solver().timeBounded().setNumberOfThreads(1);
+    for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+        std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(
+            env, matrix, initialStates, phiStates, psiStates, exitRates, timeBounds[timeBoundIndex]);
+        for (uint64_t state = 0; state < result.size(); ++state) {
+            EXPECT_NEAR(result[state], results[timeBoundIndex][state], 1e-9);
+        }
+    }
+}
+
+TEST(CtmcCslModelCheckerTest, TransientProbabilitiesMultipleChunks) {
+    // A cyclic birth-death chain whose rows span several of the row chunks that are processed concurrently
+    uint64_t const numberOfStates = 3 * 4096 + 100;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder;
+    storm::models::sparse::StateLabeling labeling(numberOfStates);
+    labeling.addLabel("init");
+    labeling.addLabel("goal");
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        uint64_t const predecessor = state == 0 ? numberOfStates - 1 : state - 1;
+        uint64_t const successor = state + 1 == numberOfStates ? 0 : state + 1;
+        matrixBuilder.addNextValue(state, std::min(predecessor, successor), predecessor < successor ? 1.0 : 2.0);
+        matrixBuilder.addNextValue(state, std::max(predecessor, successor), predecessor < successor ? 2.0 : 1.0);
+        if (state % 1000 == 0) {
+            labeling.addLabelToState("init", state);
+        }
+        if (state % 1000 == 999) {
+            labeling.addLabelToState("goal", state);
+        }
+    }
+    storm::models::sparse::Ctmc<double> ctmc(matrixBuilder.build(), labeling);
+    ASSERT_EQ(numberOfStates, ctmc.getNumberOfStates());
+
+    // Time-bounded reachability via the model checker, which uses the batched computation with multiple threads
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parseProperties("P=? [F<=5 \"goal\"]"));
+    storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<double>> checker(ctmc);
+    storm::Environment env;
+    env.solver().timeBounded().setNumberOfThreads(1);
+    auto sequentialResult = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0]));
+    env.solver().timeBounded().setNumberOfThreads(4);
+    auto parallelResult = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0]));
+    auto const& sequentialValues = sequentialResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+    auto const& parallelValues = parallelResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+    ASSERT_EQ(numberOfStates, parallelValues.size());
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        EXPECT_NEAR(sequentialValues[state], parallelValues[state], 1e-9);
+    }
+    EXPECT_EQ(1.0, parallelValues[999]);
+    EXPECT_LT(0.0, parallelValues[0]);
+
+    // Transient probabilities for multiple time bounds at once
+    storm::storage::BitVector allStates(numberOfStates, true);
+    storm::storage::BitVector noStates(numberOfStates);
+    std::vector<double> timeBounds = {0.5, 2.0, 10.0, 40.0};
+    std::vector<std::vector<double>> results = storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(
+        env, ctmc.getTransitionMatrix(), ctmc.getStates("init"), allStates, noStates, ctmc.getExitRateVector(), timeBounds);
+    ASSERT_EQ(timeBounds.size(), results.size());
+    env.solver().timeBounded().setNumberOfThreads(1);
+    for (uint64_t timeBoundIndex = 0; timeBoundIndex < timeBounds.size(); ++timeBoundIndex) {
+        std::vector<double> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeAllTransientProbabilities(
+            env, ctmc.getTransitionMatrix(), ctmc.getStates("init"), allStates, noStates, ctmc.getExitRateVector(), timeBounds[timeBoundIndex]);
+        ASSERT_EQ(numberOfStates, result.size());
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            EXPECT_NEAR(result[state], results[timeBoundIndex][state], 1e-9);
+        }
+    }
+}
+
 TYPED_TEST(CtmcCslModelCheckerTest, LtlProbabilitiesEmbedded) {
 #ifdef STORM_HAVE_LTL_MODELCHECKING_SUPPORT
     std::string formulasString = "P=?  [ X F (!\"down\" U \"fail_sensors\") ]";
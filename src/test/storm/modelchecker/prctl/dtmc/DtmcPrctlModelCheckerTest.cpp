@@ -329,6 +329,41 @@ class SparseTopologicalEigenLUEnvironment {
     }
 };
 
+class SparseTopologicalParallelEigenDoubleLUEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // unused for sparse models
+    static const DtmcEngine engine = DtmcEngine::PrismSparse;
+    static const bool isExact = false;
+    typedef double ValueType;
+    typedef storm::models::sparse::Dtmc<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+        env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Eigen);
+        env.solver().topological().setNumberOfThreads(4);
+        env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+        return env;
+    }
+};
+
+// Exact value types are never solved concurrently, so the requested threads must fall back to the sequential code path
+class SparseTopologicalSequentialFallbackEigenRationalLUEnvironment {
+   public:
+    static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;  // unused for sparse models
+    static const DtmcEngine engine = DtmcEngine::PrismSparse;
+    static const bool isExact = true;
+    typedef storm::RationalNumber ValueType;
+    typedef storm::models::sparse::Dtmc<ValueType> ModelType;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+        env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Eigen);
+        env.solver().topological().setNumberOfThreads(4);
+        env.solver().eigen().setMethod(storm::solver::EigenLinearEquationSolverMethod::SparseLU);
+        return env;
+    }
+};
+
 #ifdef STORM_HAVE_GMM
 class HybridSylvanGmmxxGmresEnvironment {
    public:
@@ -660,7 +695,8 @@ typedef ::testing::Types<
     SparseEigenDGmresEnvironment, SparseEigenDoubleLUEnvironment, SparseEigenRationalLUEnvironment, SparseRationalEliminationEnvironment,
     SparseNativeJacobiEnvironment, SparseNativeWalkerChaeEnvironment, SparseNativeSorEnvironment, SparseNativePowerEnvironment,
     SparseNativeSoundValueIterationEnvironment, SparseNativeOptimisticValueIterationEnvironment, SparseNativeGuessingValueIterationEnvironment,
-    SparseNativeIntervalIterationEnvironment, SparseNativeRationalSearchEnvironment, SparseTopologicalEigenLUEnvironment, HybridCuddNativeJacobiEnvironment,
+    SparseNativeIntervalIterationEnvironment, SparseNativeRationalSearchEnvironment, SparseTopologicalEigenLUEnvironment,
+    SparseTopologicalParallelEigenDoubleLUEnvironment, SparseTopologicalSequentialFallbackEigenRationalLUEnvironment, HybridCuddNativeJacobiEnvironment,
     HybridCuddNativeSoundValueIterationEnvironment, HybridSylvanNativeRationalSearchEnvironment, DdSylvanNativePowerEnvironment,
     JaniDdSylvanNativePowerEnvironment, DdCuddNativeJacobiEnvironment, DdSylvanRationalSearchEnvironment>
     TestingTypes;
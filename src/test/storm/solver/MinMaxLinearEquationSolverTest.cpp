@@ -188,4 +188,49 @@ TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquations) {
     ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
     EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
 }
+
+TEST(MinMaxLinearEquationSolverParallelTest, JacobiSweeps) {
+    // A random-looking system that is large enough to be split into several chunks.
+    uint64_t const numGroups = 50000;
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    std::vector<double> b;
+    for (uint64_t group = 0; group < numGroups; ++group) {
+        builder.newRowGroup(2 * group);
+        auto const succ1 = (group * 7 + 1) % numGroups;
+        auto const succ2 = (succ1 + 1 + group % 97) % numGroups;
+        builder.addNextValue(2 * group, std::min(succ1, succ2), 0.4);
+        builder.addNextValue(2 * group, std::max(succ1, succ2), 0.5);
+        b.push_back(0.1);
+        builder.addNextValue(2 * group + 1, (group + 1) % numGroups, 0.9);
+        b.push_back(0.05);
+    }
+    storm::storage::SparseMatrix<double> A = builder.build();
+
+    storm::Environment env;
+    env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    env.solver().minMax().setMultiplicationStyle(storm::solver::MultiplicationStyle::Regular);
+
+    auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>();
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        env.solver().native().setNumberOfThreads(1);
+        std::vector<double> xSequential(numGroups);
+        auto solver = factory.create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 1.0);
+        ASSERT_NO_THROW(solver->solveEquations(env, dir, xSequential, b));
+
+        env.solver().native().setNumberOfThreads(4);
+        std::vector<double> xParallel(numGroups);
+        solver = factory.create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(0.0, 1.0);
+        ASSERT_NO_THROW(solver->solveEquations(env, dir, xParallel, b));
+
+        // Jacobi sweeps do not depend on the order in which row groups are processed
+        EXPECT_EQ(xSequential, xParallel);
+    }
+}
 }  // namespace
@@ -0,0 +1,115 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <random>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+#include "storm/utility/ThreadPool.h"
+
+namespace {
+std::vector<storm::storage::BitVector> createKeys(uint64_t numberOfKeys, uint64_t bucketSize) {
+    std::mt19937_64 generator(42);
+    std::vector<storm::storage::BitVector> keys;
+    keys.reserve(numberOfKeys);
+    for (uint64_t keyIndex = 0; keyIndex < numberOfKeys; ++keyIndex) {
+        storm::storage::BitVector key(bucketSize);
+        for (uint64_t word = 0; word + 1 < bucketSize / 64; ++word) {
+            key.setBucket(word, generator());
+        }
+        // Make sure that the keys are distinct.
+        key.setBucket(bucketSize / 64 - 1, keyIndex);
+        keys.push_back(std::move(key));
+    }
+    return keys;
+}
+}  // namespace
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(64, 3);
+
+    storm::storage::BitVector first(64);
+    first.set(4);
+    first.set(47);
+    ASSERT_NO_THROW(map.findOrAdd(first, 1));
+
+    storm::storage::BitVector second(64);
+    second.set(8);
+    second.set(18);
+    ASSERT_NO_THROW(map.findOrAdd(second, 2));
+
+    EXPECT_EQ(1ul, map.findOrAdd(first, 3));
+    EXPECT_EQ(2ul, map.findOrAdd(second, 3));
+    EXPECT_EQ(2ul, map.size());
+
+    storm::storage::BitVector third(64);
+    third.set(10);
+    third.set(63);
+    EXPECT_FALSE(map.contains(third));
+    EXPECT_FALSE(map.find(third).has_value());
+
+    auto [thirdValue, inserted] = map.findOrCreate(third, [] { return 3ul; });
+    EXPECT_EQ(3ul, thirdValue);
+    EXPECT_TRUE(inserted);
+    EXPECT_FALSE(map.findOrCreate(third, [] { return 4ul; }).second);
+
+    EXPECT_EQ(1ul, map.getValue(first));
+    EXPECT_EQ(2ul, map.getValue(second));
+    EXPECT_EQ(3ul, map.getValue(third));
+}
+
+TEST(ConcurrentBitVectorHashMapTest, Resize) {
+    // Inserting many keys into a small map triggers multiple (incremental) resizes.
+    auto keys = createKeys(100000, 128);
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 16);
+    storm::storage::BitVectorHashMap<uint64_t> referenceMap(128, 16);
+    for (uint64_t keyIndex = 0; keyIndex < keys.size(); ++keyIndex) {
+        EXPECT_EQ(keyIndex, map.findOrAdd(keys[keyIndex], keyIndex));
+        referenceMap.findOrAdd(keys[keyIndex], keyIndex);
+    }
+    EXPECT_EQ(keys.size(), map.size());
+    EXPECT_LE(keys.size(), map.capacity());
+    for (uint64_t keyIndex = 0; keyIndex < keys.size(); ++keyIndex) {
+        EXPECT_EQ(keyIndex, map.findOrAdd(keys[keyIndex], 0));
+    }
+
+    uint64_t numberOfIteratedKeys = 0;
+    for (auto const& [key, value] : map) {
+        ++numberOfIteratedKeys;
+        EXPECT_EQ(referenceMap.getValue(key), value);
+    }
+    EXPECT_EQ(keys.size(), numberOfIteratedKeys);
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentInsertion) {
+    uint64_t const numberOfWorkers = 4;
+    auto keys = createKeys(50000, 128);
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(128, 16);
+    std::atomic<uint64_t> nextValue{0};
+
+    // Each worker inserts all keys (in a different order). Every key has to obtain a unique value that all workers agree on.
+    std::vector<std::vector<uint64_t>> obtainedValues(numberOfWorkers, std::vector<uint64_t>(keys.size()));
+    storm::utility::ThreadPool threadPool(numberOfWorkers);
+    threadPool.parallelFor(numberOfWorkers, [&](uint64_t taskIndex, uint64_t) {
+        for (uint64_t offset = 0; offset < keys.size(); ++offset) {
+            uint64_t const keyIndex = (offset + taskIndex * keys.size() / numberOfWorkers) % keys.size();
+            obtainedValues[taskIndex][keyIndex] = map.findOrCreate(keys[keyIndex], [&nextValue] { return nextValue.fetch_add(1); }).first;
+        }
+    });
+
+    EXPECT_EQ(keys.size(), map.size());
+    EXPECT_EQ(keys.size(), nextValue.load());
+    storm::storage::BitVector usedValues(keys.size());
+    for (uint64_t keyIndex = 0; keyIndex < keys.size(); ++keyIndex) {
+        uint64_t const value = map.getValue(keys[keyIndex]);
+        ASSERT_LT(value, keys.size());
+        EXPECT_FALSE(usedValues.get(value));
+        usedValues.set(value);
+        for (auto const& workerValues : obtainedValues) {
+            EXPECT_EQ(value, workerValues[keyIndex]);
+        }
+    }
+}
@@ -1,6 +1,8 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <set>
+
 #include "storm-parsers/parser/AutoParser.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -91,3 +93,70 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, ParallelDecomposition) {
+    // Blocks of 100 states that are (mostly) strongly connected. Some blocks are connected to the next block and some states are only reachable.
+    uint64_t const numberOfStates = 20000;
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(numberOfStates, numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        uint64_t const blockStart = (state / 100) * 100;
+        std::set<uint64_t> successors;
+        if (state % 100 != 99) {
+            successors.insert(blockStart + (state * 37 + 11) % 99);
+        }
+        if (state % 7 == 0) {
+            successors.insert(state);
+        }
+        if (state % 50 == 0 && blockStart + 100 < numberOfStates && (state / 100) % 3 != 0) {
+            successors.insert(blockStart + 100 + (state * 13) % 100);
+        }
+        for (auto successor : successors) {
+            matrixBuilder.addNextValue(state, successor, 1.0 / successors.size());
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    auto getSccs = [](storm::storage::StronglyConnectedComponentDecomposition<double> const& decomposition) {
+        std::set<std::vector<uint64_t>> result;
+        for (auto const& scc : decomposition) {
+            result.emplace(scc.begin(), scc.end());
+        }
+        return result;
+    };
+    auto getStateDepths = [&numberOfStates](storm::storage::StronglyConnectedComponentDecomposition<double> const& decomposition) {
+        std::vector<uint64_t> result(numberOfStates);
+        for (uint64_t sccIndex = 0; sccIndex < decomposition.size(); ++sccIndex) {
+            for (auto const& state : decomposition[sccIndex]) {
+                result[state] = decomposition.getSccDepth(sccIndex);
+            }
+        }
+        return result;
+    };
+
+    storm::storage::StronglyConnectedComponentDecompositionOptions options;
+    options.forceTopologicalSort().computeSccDepths();
+    storm::storage::StronglyConnectedComponentDecomposition<double> sequentialDecomposition(matrix, options);
+    options.numberOfThreads(4);
+    storm::storage::StronglyConnectedComponentDecomposition<double> parallelDecomposition(matrix, options);
+    ASSERT_EQ(sequentialDecomposition.size(), parallelDecomposition.size());
+    EXPECT_EQ(getSccs(sequentialDecomposition), getSccs(parallelDecomposition));
+    EXPECT_EQ(getStateDepths(sequentialDecomposition), getStateDepths(parallelDecomposition));
+    // The SCCs need to be sorted topologically
+    auto stateToScc = parallelDecomposition.computeStateToSccIndexMap(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        for (auto const& entry : matrix.getRow(state)) {
+            EXPECT_LE(stateToScc[entry.getColumn()], stateToScc[state]);
+        }
+    }
+
+    storm::storage::BitVector subsystem(numberOfStates, true);
+    for (uint64_t state = 0; state < numberOfStates; state += 3) {
+        subsystem.set(state, false);
+    }
+    storm::storage::StronglyConnectedComponentDecompositionOptions subsystemOptions;
+    subsystemOptions.subsystem(subsystem).dropNaiveSccs().onlyBottomSccs();
+    sequentialDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, subsystemOptions);
+    subsystemOptions.numberOfThreads(4);
+    parallelDecomposition = storm::storage::StronglyConnectedComponentDecomposition<double>(matrix, subsystemOptions);
+    EXPECT_EQ(getSccs(sequentialDecomposition), getSccs(parallelDecomposition));
+}
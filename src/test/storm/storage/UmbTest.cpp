@@ -9,6 +9,7 @@
 #include "storm/adapters/IntervalAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/io/ArchiveReader.h"
 #include "storm/storage/umb/export/SparseModelToUmb.h"
 #include "storm/storage/umb/export/UmbExport.h"
 #include "storm/storage/umb/import/SparseModelFromUmb.h"
@@ -111,7 +112,31 @@ class UmbRoundTripTest : public ::testing::Test {
         validationErrors.clear();
         auto model2 = storm::umb::sparseModelFromUmb<ValueType>(umb2, importOptions);
         assertEqualModel(model2);
+
+        // Uncompressed archives are memory-mapped by default. Check that extracting them yields the same model.
+        if (exportOptions.compression == storm::io::CompressionMode::None) {
+            EXPECT_TRUE(storm::io::openArchive(umbFile).isMemoryMapped());
+            importOptions.useMemoryMapping = false;
+            auto umb3 = storm::umb::importUmb(umbFile, importOptions);
+            ASSERT_TRUE(umb3.validate(validationErrors)) << validationErrors.str();
+            auto model3 = storm::umb::sparseModelFromUmb<ValueType>(umb3, importOptions);
+            assertEqualModel(model3);
+        } else {
+            EXPECT_FALSE(storm::io::openArchive(umbFile).isMemoryMapped());
+        }
         removeUmbFile();
+
+        // Export during exploration: program -> file -> umb -> model
+        if constexpr (std::is_same_v<ValueType, double>) {
+            if (!model->isPartiallyObservable()) {
+                storm::builder::ExplicitModelBuilder<ValueType>(program, generatorOptions).exportToUmb(umbFile, exportOptions);
+                auto umb4 = storm::umb::importUmb(umbFile, importOptions);
+                ASSERT_TRUE(umb4.validate(validationErrors)) << validationErrors.str();
+                auto model4 = storm::umb::sparseModelFromUmb<ValueType>(umb4, importOptions);
+                assertEqualModel(model4);
+                removeUmbFile();
+            }
+        }
     }
 
     virtual void SetUp() override {
@@ -139,6 +164,12 @@ TEST_F(UmbRoundTripTest, brp_dtmc) {
     run<double>(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", "", options);
     options.compression = storm::io::CompressionMode::None;
     run<double>(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", "", options);
+    run<storm::RationalNumber>(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", "", options);
+    options.compression = storm::io::CompressionMode::Xz;
+    options.numberOfThreads = 2;
+    run<double>(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", "", options);
+    options.numberOfThreads = 0;
+    run<storm::RationalNumber>(STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", "", options);
 }
 
 TEST_F(UmbRoundTripTest, embedded_ctmc) {
@@ -156,6 +187,8 @@ TEST_F(UmbRoundTripTest, firewire_mdp) {
     options.allowChoiceOriginsAsActions = true;
     options.allowChoiceLabelingAsActions = false;
     run<double>(STORM_TEST_RESOURCES_DIR "/mdp/firewire3-0.5.nm", "", options);
+    options.compression = storm::io::CompressionMode::None;
+    run<double>(STORM_TEST_RESOURCES_DIR "/mdp/firewire3-0.5.nm", "", options);
 }
 
 TEST_F(UmbRoundTripTest, polling_ma) {
@@ -269,4 +269,51 @@ TEST_F(GraphTestExplicit, ExplicitProb01MinMax) {
                                                                                       model->getStates("collision_max_backoff")));
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
-}
\ No newline at end of file
+}
+
+TEST_F(GraphTestExplicit, ExplicitParallelSearch) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Model<double>> model =
+        storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Dtmc);
+    auto const& dtmc = *model->as<storm::models::sparse::Dtmc<double>>();
+    storm::storage::BitVector allStates(dtmc.getNumberOfStates(), true);
+    auto const backwardTransitions = dtmc.getBackwardTransitions();
+
+    auto expectedProb01 = storm::utility::graph::performProb01(backwardTransitions, allStates, dtmc.getStates("observe0Greater1"));
+    auto expectedBoundedProbGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, allStates, dtmc.getStates("observe0Greater1"), true, 5);
+    auto prob01 = storm::utility::graph::performProb01(backwardTransitions, allStates, dtmc.getStates("observe0Greater1"), 4);
+    auto boundedProbGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, allStates, dtmc.getStates("observe0Greater1"), true, 5, 4);
+    EXPECT_EQ(expectedProb01.first, prob01.first);
+    EXPECT_EQ(expectedProb01.second, prob01.second);
+    EXPECT_EQ(expectedBoundedProbGreater0, boundedProbGreater0);
+    EXPECT_EQ(4409ull, prob01.first.getNumberOfSetBits());
+    EXPECT_EQ(1316ull, prob01.second.getNumberOfSetBits());
+
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm");
+    program = modelDescription.preprocess().asPrismProgram();
+    model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    auto const& mdp = *model->as<storm::models::sparse::Mdp<double>>();
+    allStates = storm::storage::BitVector(mdp.getNumberOfStates(), true);
+
+    auto const& transitionMatrix = mdp.getTransitionMatrix();
+    auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+    auto const mdpBackwardTransitions = mdp.getBackwardTransitions();
+    auto const targetStates = mdp.getStates("collision_max_backoff");
+
+    auto expectedProb01Min = storm::utility::graph::performProb01Min(transitionMatrix, rowGroupIndices, mdpBackwardTransitions, allStates, targetStates);
+    auto expectedProb01Max = storm::utility::graph::performProb01Max(transitionMatrix, rowGroupIndices, mdpBackwardTransitions, allStates, targetStates);
+    auto expectedProb1A = storm::utility::graph::performProb1A(transitionMatrix, rowGroupIndices, mdpBackwardTransitions, allStates, targetStates);
+    auto prob01Min = storm::utility::graph::performProb01Min(transitionMatrix, rowGroupIndices, mdpBackwardTransitions, allStates, targetStates, 4);
+    auto prob01Max = storm::utility::graph::performProb01Max(transitionMatrix, rowGroupIndices, mdpBackwardTransitions, allStates, targetStates, 4);
+    auto prob1A = storm::utility::graph::performProb1A(transitionMatrix, rowGroupIndices, mdpBackwardTransitions, allStates, targetStates, 4);
+    EXPECT_EQ(expectedProb01Min.first, prob01Min.first);
+    EXPECT_EQ(expectedProb01Min.second, prob01Min.second);
+    EXPECT_EQ(expectedProb01Max.first, prob01Max.first);
+    EXPECT_EQ(expectedProb01Max.second, prob01Max.second);
+    EXPECT_EQ(expectedProb1A, prob1A);
+    EXPECT_EQ(993ull, prob01Min.first.getNumberOfSetBits());
+    EXPECT_EQ(16ull, prob01Max.second.getNumberOfSetBits());
+}